@@ -12,6 +12,10 @@ $(OUT_PATH)/$(SRC_PATH)/app_led.o \
 $(OUT_PATH)/$(SRC_PATH)/app_counter.o \
 $(OUT_PATH)/$(SRC_PATH)/app_leak.o \
 $(OUT_PATH)/$(SRC_PATH)/app_battery.o \
+$(OUT_PATH)/$(SRC_PATH)/app_poll.o \
+$(OUT_PATH)/$(SRC_PATH)/app_history.o \
+$(OUT_PATH)/$(SRC_PATH)/app_profile.o \
+$(OUT_PATH)/$(SRC_PATH)/app_energy.o \
 $(OUT_PATH)/$(SRC_PATH)/app_reporting.o \
 $(OUT_PATH)/$(SRC_PATH)/app_dev_config.o \
 $(OUT_PATH)/$(SRC_PATH)/app_endpoint_cfg.o \
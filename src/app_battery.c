@@ -3,6 +3,7 @@
 
 #include "watermeter.h"
 
+static uint8_t low_voltage = false;
 
 // 2200..3100 mv - 0..100%
 static uint8_t get_battery_level(uint16_t battery_mv) {
@@ -28,9 +29,30 @@ int32_t batteryCb(void *arg) {
     printf("Level:       %d\r\n", level);
 #endif
 
+    /* flash is not written below BATTERY_SAFETY_THRESHOLD, save counters while it is possible */
+    if (voltage_raw < LOW_VBAT_MV) {
+        low_voltage = true;
+        counters_flush();
+    } else {
+        low_voltage = false;
+    }
+
     zcl_setAttrVal(WATERMETER_ENDPOINT1, ZCL_CLUSTER_GEN_POWER_CFG, ZCL_ATTRID_BATTERY_VOLTAGE, &voltage);
     zcl_setAttrVal(WATERMETER_ENDPOINT1, ZCL_CLUSTER_GEN_POWER_CFG, ZCL_ATTRID_BATTERY_PERCENTAGE_REMAINING, &level);
 
+    energy_estimate();
+
     return 0;
 }
 
+uint8_t battery_low() {
+    return low_voltage;
+}
+
+/* the voltage now, batteryCb() checks it only every BATTERY_TIMER_INTERVAL */
+uint8_t battery_check() {
+
+    low_voltage = drv_get_adc_data() < LOW_VBAT_MV;
+
+    return low_voltage;
+}
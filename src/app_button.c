@@ -59,13 +59,7 @@ void button_handler() {
             TL_ZB_TIMER_SCHEDULE(delayedMcuResetCb, NULL, TIMEOUT_1SEC);
         } else { /* short pressed < 5 sec. */
             light_blink_start(1, 30, 30);
-            if (g_watermeterCtx.timerPollRateEvt) {
-                TL_ZB_TIMER_CANCEL(&g_watermeterCtx.timerPollRateEvt);
-            }
-            if (!watermeter_config.new_ota) {
-                zb_setPollRate(g_watermeterCtx.short_poll);
-                g_watermeterCtx.timerPollRateEvt = TL_ZB_TIMER_SCHEDULE(poll_rateAppCb, NULL, TIMEOUT_2MIN);
-            }
+            poll_event(POLL_SRC_BUTTON);
 
             if (!g_watermeterCtx.timerForcedReportEvt) {
                 g_watermeterCtx.timerForcedReportEvt = TL_ZB_TIMER_SCHEDULE(forcedReportCb, NULL, TIMEOUT_5SEC);
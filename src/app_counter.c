@@ -1,13 +1,39 @@
 #include "tl_common.h"
 #include "zcl_include.h"
 
+#include "se_custom_attr.h"
 #include "watermeter.h"
 
-#define DEBOUNCE_COUNTER    32                          /* number of polls for debounce       */
+#define DEBOUNCE_TIME       32000                       /* us, level must be stable after last edge, */
+                                                        /* about 32 polls of the old debounce        */
+#define EDGE_QUEUE_SIZE     16                          /* must be a power of 2                     */
+#define EDGE_QUEUE_MASK     (EDGE_QUEUE_SIZE - 1)
+
+#define HOT_CHANNEL         0
+#define COLD_CHANNEL        1
+
+#define FLOW_FRAC           4                           /* flow is kept in 1/16 l/h                 */
+#define FLOW_SHIFT          2                           /* new interval weighs 1/4 in the estimate  */
+#define FLOW_TIMEOUT        (3600 * 1000)               /* ms, no pulse - no flow                   */
+#define FLOW_HOUR           (3600 * 1000 << FLOW_FRAC)  /* an hour in ms, in 1/16 as the flow       */
+#define FLOW_EVAL_TIME      TIMEOUT_TICK_1SEC           /* us, demand update while the water runs   */
 
 static water_counter_t hot_counter;
 static water_counter_t cold_counter;
 
+/* single producer (gpio irq) - single consumer (counters_handler) */
+static counter_edge_t edge_queue[EDGE_QUEUE_SIZE];
+static volatile uint8_t edge_head = 0;
+static volatile uint8_t edge_tail = 0;
+
+/* counters in watermeter_config are ahead of flash, see COUNTERS_FLUSH_TIME */
+static uint8_t flush_pending = false;
+
+/* pulses ahead of flash, a copy is kept in CHK_DEEP_SLEEP over a watchdog or a reset */
+static uint8_t pending_hot = 0;
+static uint8_t pending_cold = 0;
+static uint8_t pending_restored = false;
+
 uint32_t check_counter_overflow(uint32_t check_count) {
     uint32_t count;
 
@@ -23,96 +49,305 @@ uint32_t check_counter_overflow(uint32_t check_count) {
     return count;
 }
 
+static void counter_edge_push(uint8_t channel, uint8_t level) {
+    uint8_t head = edge_head;
+    uint8_t next = (head + 1) & EDGE_QUEUE_MASK;
+
+    /* on overflow the edge is lost, counter_edge_sync() will catch up the level */
+    if (next != edge_tail) {
+        edge_queue[head].tick = clock_time();
+        edge_queue[head].channel = channel;
+        edge_queue[head].level = level;
+        edge_head = next;
+    }
+}
+
+static void hot_counter_irqCb(void) {
+    uint8_t level = drv_gpio_read(HOT_GPIO) ? 1 : 0;
+
+    counter_edge_push(HOT_CHANNEL, level);
+    /* wait for the opposite edge */
+    drv_gpio_irq_risc0_set(HOT_GPIO, level ? FALLING_EDGE : RISING_EDGE);
+}
+
+static void cold_counter_irqCb(void) {
+    uint8_t level = drv_gpio_read(COLD_GPIO) ? 1 : 0;
+
+    counter_edge_push(COLD_CHANNEL, level);
+    /* wait for the opposite edge */
+    drv_gpio_irq_risc1_set(COLD_GPIO, level ? FALLING_EDGE : RISING_EDGE);
+}
+
+static void counter_edge(water_counter_t *water_counter, uint8_t level, uint32_t tick) {
+    /* any edge restarts the debounce window, even if the level looks unchanged */
+    water_counter->level = level;
+    water_counter->edge_time = tick;
+    water_counter->pending = true;
+}
+
+static void counter_edge_sync(water_counter_t *water_counter, uint32_t pin) {
+    uint8_t level = drv_gpio_read(pin) ? 1 : 0;
+
+    /* edge lost during sleep or queue overflow */
+    if (level != water_counter->level) {
+        counter_edge(water_counter, level, clock_time());
+    }
+}
+
+static void counter_debounce(water_counter_t *water_counter) {
+    if (water_counter->pending && clock_time_exceed(water_counter->edge_time, DEBOUNCE_TIME)) {
+        water_counter->pending = false;
+        if (water_counter->level != water_counter->stable) {
+            water_counter->stable = water_counter->level;
+            /* pulse - contact is closed */
+            if (!water_counter->stable) {
+                water_counter->counter++;
+            }
+        }
+    }
+}
+
+static int32_t counters_debounceCb(void *arg) {
+
+    /* only wakes the MCU, counters_handler() ends the window */
+    g_watermeterCtx.timerDebounceEvt = NULL;
+
+    return -1;
+}
+
+/* the MCU sleeps until the window of the edge is over instead of waiting it out awake */
+static void counters_debounceWait() {
+    water_counter_t *water_counter;
+    uint32_t elapsed_us, wait_us = DEBOUNCE_TIME;
+
+    if (g_watermeterCtx.timerDebounceEvt) {
+        /* an edge after it only takes one more wakeup */
+        return;
+    }
+
+    for (uint8_t i = 0; i < 2; i++) {
+        water_counter = i == HOT_CHANNEL ? &hot_counter : &cold_counter;
+        if (water_counter->pending) {
+            elapsed_us = (clock_time() - water_counter->edge_time) / sys_tick_per_us;
+            if (elapsed_us > DEBOUNCE_TIME) elapsed_us = DEBOUNCE_TIME;
+            if (DEBOUNCE_TIME - elapsed_us < wait_us) wait_us = DEBOUNCE_TIME - elapsed_us;
+        }
+    }
+
+    if (hot_counter.pending || cold_counter.pending) {
+        /* the window is over by 1 ms at most */
+        g_watermeterCtx.timerDebounceEvt = TL_ZB_TIMER_SCHEDULE(counters_debounceCb, NULL, wait_us / 1000 + 1);
+    }
+}
+
+/* gpio irq configuration is lost in deep sleep, it must be restored after each wakeup */
+void init_counters_irq() {
+
+    drv_gpio_irq_config(GPIO_IRQ_RISC0_MODE, HOT_GPIO, drv_gpio_read(HOT_GPIO) ? FALLING_EDGE : RISING_EDGE, hot_counter_irqCb);
+    drv_gpio_irq_risc0_en(HOT_GPIO);
+
+    drv_gpio_irq_config(GPIO_IRQ_RISC1_MODE, COLD_GPIO, drv_gpio_read(COLD_GPIO) ? FALLING_EDGE : RISING_EDGE, cold_counter_irqCb);
+    drv_gpio_irq_risc1_en(COLD_GPIO);
+}
+
 /* reg_deep_sleep is                                                */
 /* 0x01: input level on HOT_PIN before deep sleep                   */
 /* 0x02: input level on COLD_PIN before deep sleep                  */
 /* 0x04: 1 - deep sleep, watchdog or soft_reset,  0 - new start MCU */
+/* 0x18: hot pulses not yet in flash, 0..3                          */
+/* 0x60: cold pulses not yet in flash, 0..3                         */
 
 void init_counters() {
 
     uint8_t reg_deep_sleep = analog_read(CHK_DEEP_SLEEP);
 
-    hot_counter.counter = 0;
-    cold_counter.counter = 0;
+    memset(&hot_counter, 0, sizeof(water_counter_t));
+    memset(&cold_counter, 0, sizeof(water_counter_t));
+
+    edge_head = edge_tail = 0;
+
+    hot_counter.level = hot_counter.stable = drv_gpio_read(HOT_GPIO) ? 1 : 0;
+    cold_counter.level = cold_counter.stable = drv_gpio_read(COLD_GPIO) ? 1 : 0;
 
     if (reg_deep_sleep & 0x04) {
         /* wakeup from deep sleep */
 
-        if (!drv_gpio_read(HOT_GPIO)) {
-            hot_counter.debounce = DEBOUNCE_COUNTER;
-            if (reg_deep_sleep & 0x01) {
-                hot_counter.counter++;
-            }
-        } else {
-            hot_counter.debounce = 1;
+        if (!hot_counter.stable && (reg_deep_sleep & 0x01)) {
+            hot_counter.counter++;
         }
 
-        if (!drv_gpio_read(COLD_GPIO)) {
-            cold_counter.debounce = DEBOUNCE_COUNTER;
-            if (reg_deep_sleep & 0x02) {
-                cold_counter.counter++;
-            }
-        } else {
-            cold_counter.debounce = 1;
+        if (!cold_counter.stable && (reg_deep_sleep & 0x02)) {
+            cold_counter.counter++;
         }
+    }
 
-    } else {
-        /* new start MCU */
-        if (!drv_gpio_read(HOT_GPIO)) {
-            hot_counter.debounce = DEBOUNCE_COUNTER;
-        } else {
-            hot_counter.debounce = 1;
-        }
+    /* the pulses of the window lost with the RAM, counted again by counters_handler() */
+    hot_counter.counter += (reg_deep_sleep >> CHK_PENDING_HOT) & CHK_PENDING_MAX;
+    cold_counter.counter += (reg_deep_sleep >> CHK_PENDING_COLD) & CHK_PENDING_MAX;
 
-        if (!drv_gpio_read(COLD_GPIO)) {
-            cold_counter.debounce = DEBOUNCE_COUNTER;
-        } else {
-            cold_counter.debounce = 1;
-        }
-    }
+    pending_hot = pending_cold = 0;
+    pending_restored = true;
 
     reg_deep_sleep = 0;
     analog_write(CHK_DEEP_SLEEP, reg_deep_sleep);
+
+    init_counters_irq();
 }
 
-uint8_t counters_handler() {
+static void counters_pendingWrite() {
+    uint8_t reg_deep_sleep = analog_read(CHK_DEEP_SLEEP) & ~CHK_PENDING_MASK;
 
-    uint8_t save_config = false;
-    uint64_t water_counter = 0;
+    reg_deep_sleep |= pending_hot << CHK_PENDING_HOT;
+    reg_deep_sleep |= pending_cold << CHK_PENDING_COLD;
 
-#if 0
-    gpio_setup_up_down_resistor(HOT_GPIO, PM_PIN_PULLUP_10K);
-    gpio_setup_up_down_resistor(COLD_GPIO, PM_PIN_PULLUP_10K);
-#endif
+    analog_write(CHK_DEEP_SLEEP, reg_deep_sleep);
+}
 
-    if (!drv_gpio_read(HOT_GPIO)) {
-        if (hot_counter.debounce != DEBOUNCE_COUNTER) {
-            hot_counter.debounce++;
-            if (hot_counter.debounce == DEBOUNCE_COUNTER) {
-                hot_counter.counter++;
-            }
+/* the counters are in flash, called by write_config() and write_counters().           */
+/* a reset between the flash write and the register write counts these pulses twice   */
+void counters_saved() {
+
+    /* at start the register is read by init_counters() after init_config() */
+    if (!pending_restored || (!pending_hot && !pending_cold)) {
+        return;
+    }
+
+    pending_hot = pending_cold = 0;
+    counters_pendingWrite();
+}
+
+static int32_t counters_flushCb(void *arg) {
+
+    g_watermeterCtx.timerFlushEvt = NULL;
+    counters_flush();
+
+    return -1;
+}
+
+/* l/h in 1/16 for the volume of pulses in dt_ms, no 64-bit math */
+static uint32_t flow_rate(uint32_t dt_ms, uint8_t pulses) {
+    uint32_t liters = watermeter_config.liters_per_pulse * pulses;     /* < 2^15 */
+    uint32_t whole = FLOW_HOUR / dt_ms;
+    uint32_t rem = FLOW_HOUR % dt_ms;
+
+    if (whole >= 0xFFFFFFFF / liters) {
+        return 0xFFFFFFFF;
+    }
+
+    /* rem < dt_ms, both are scaled down to keep liters * rem in 32 bits */
+    while (dt_ms > 0x1FFFF) {
+        dt_ms >>= 1;
+        rem >>= 1;
+    }
+
+    return liters * whole + liters * rem / dt_ms;
+}
+
+/* clock_time() wraps after 268 sec, pulses are timed by the 32k timer running in deep sleep */
+static void flow_pulse(water_counter_t *water_counter, uint8_t endpoint, uint8_t pulses) {
+    uint32_t tick = pm_get_32k_tick();
+    uint32_t dt_ms = (tick - water_counter->pulse_tick) / tick_32k_tick_per_ms;
+    uint32_t demand;
+
+    /* the first pulse after a stop only starts the interval */
+    if (water_counter->flowing && dt_ms && dt_ms < FLOW_TIMEOUT) {
+        uint32_t rate = flow_rate(dt_ms, pulses);
+
+        if (water_counter->flow) {
+            water_counter->flow = water_counter->flow - (water_counter->flow >> FLOW_SHIFT) + (rate >> FLOW_SHIFT);
+        } else {
+            water_counter->flow = rate;
         }
-    } else {
-        if (hot_counter.debounce != 1) {
-            hot_counter.debounce--;
+
+        demand = water_counter->flow >> FLOW_FRAC;
+        if (demand > water_counter->demand_max) {
+            water_counter->demand_max = demand;
+            zcl_setAttrVal(endpoint, ZCL_CLUSTER_SE_METERING, ZCL_ATTRID_CURRENT_MAX_DEMAND_DELIVERD, (uint8_t*)&demand);
+        }
+        if (demand && (!water_counter->demand_min || demand < water_counter->demand_min)) {
+            water_counter->demand_min = demand;
+            zcl_setAttrVal(endpoint, ZCL_CLUSTER_SE_METERING, ZCL_ATTRID_CUSTOM_MIN_DEMAND_DELIVERD, (uint8_t*)&demand);
         }
     }
 
-    if (!drv_gpio_read(COLD_GPIO)) {
-        if (cold_counter.debounce != DEBOUNCE_COUNTER) {
-            cold_counter.debounce++;
-            if (cold_counter.debounce == DEBOUNCE_COUNTER) {
-                cold_counter.counter++;
+    water_counter->flowing = true;
+    water_counter->pulse_tick = tick;
+}
+
+static void flow_update(water_counter_t *water_counter, uint8_t endpoint) {
+    uint32_t demand = 0;
+    uint32_t dt_ms;
+
+    water_counter->eval_time = clock_time();
+
+    if (water_counter->flowing) {
+        dt_ms = (pm_get_32k_tick() - water_counter->pulse_tick) / tick_32k_tick_per_ms;
+        if (dt_ms >= FLOW_TIMEOUT) {
+            water_counter->flowing = false;
+            water_counter->flow = 0;
+        } else {
+            demand = water_counter->flow;
+            /* no next pulse yet - the flow is lower than that */
+            if (dt_ms && flow_rate(dt_ms, 1) < demand) {
+                demand = flow_rate(dt_ms, 1);
             }
+            demand >>= FLOW_FRAC;
         }
-    } else {
-        if (cold_counter.debounce != 1) {
-            cold_counter.debounce--;
-        }
     }
 
+    if (demand != water_counter->demand) {
+        water_counter->demand = demand;
+#if UART_PRINTF_MODE && DEBUG_COUNTER
+        printf("demand ep%d - %d l/h\r\n", endpoint, demand);
+#endif /* UART_PRINTF_MODE */
+        zcl_setAttrVal(endpoint, ZCL_CLUSTER_SE_METERING, ZCL_ATTRID_INSTANTANEOUS_DEMAND, (uint8_t*)&demand);
+    }
+}
+
+void counters_demandReset(uint8_t endpoint) {
+    water_counter_t *water_counter = endpoint == WATERMETER_ENDPOINT1 ? &hot_counter : &cold_counter;
+
+    water_counter->demand_min = water_counter->demand_max = 0;
+    zcl_setAttrVal(endpoint, ZCL_CLUSTER_SE_METERING, ZCL_ATTRID_CURRENT_MAX_DEMAND_DELIVERD, (uint8_t*)&water_counter->demand_max);
+    zcl_setAttrVal(endpoint, ZCL_CLUSTER_SE_METERING, ZCL_ATTRID_CUSTOM_MIN_DEMAND_DELIVERD, (uint8_t*)&water_counter->demand_min);
+}
+
+/* must be called before anything that loses RAM - reset, deep sleep without retention */
+void counters_flush() {
+
+    if (g_watermeterCtx.timerFlushEvt) {
+        TL_ZB_TIMER_CANCEL(&g_watermeterCtx.timerFlushEvt);
+    }
+
+    if (flush_pending) {
+        flush_pending = false;
+        write_counters();
+    }
+}
+
+uint8_t counters_handler() {
+
+    uint8_t save_config = false;
+    uint64_t water_counter = 0;
+
+    while (edge_tail != edge_head) {
+        counter_edge_t *edge = &edge_queue[edge_tail];
+        counter_edge(edge->channel == HOT_CHANNEL ? &hot_counter : &cold_counter, edge->level, edge->tick);
+        edge_tail = (edge_tail + 1) & EDGE_QUEUE_MASK;
+    }
+
+    counter_edge_sync(&hot_counter, HOT_GPIO);
+    counter_edge_sync(&cold_counter, COLD_GPIO);
+
+    counter_debounce(&hot_counter);
+    counter_debounce(&cold_counter);
+    counters_debounceWait();
+
     if (hot_counter.counter) {
         save_config = true;
+        flow_pulse(&hot_counter, WATERMETER_ENDPOINT1, hot_counter.counter);
+        flowleak_pulse(HOT_CHANNEL);
+        pending_hot += hot_counter.counter;
         /* detect hot counter overflow */
         watermeter_config.counter_hot_water =
                 check_counter_overflow(watermeter_config.counter_hot_water +
@@ -127,6 +362,9 @@ uint8_t counters_handler() {
 
     if (cold_counter.counter) {
         save_config = true;
+        flow_pulse(&cold_counter, WATERMETER_ENDPOINT2, cold_counter.counter);
+        flowleak_pulse(COLD_CHANNEL);
+        pending_cold += cold_counter.counter;
         /* detect cold counter overflow */
         watermeter_config.counter_cold_water =
                 check_counter_overflow(watermeter_config.counter_cold_water +
@@ -139,30 +377,43 @@ uint8_t counters_handler() {
         zcl_setAttrVal(WATERMETER_ENDPOINT2, ZCL_CLUSTER_SE_METERING, ZCL_ATTRID_CURRENT_SUMMATION_DELIVERD, (uint8_t*)&water_counter);
     }
 
-    if (save_config) {
-        write_config();
-        zb_setPollRate(g_watermeterCtx.short_poll);
-        if (g_watermeterCtx.timerPollRateEvt) {
-            TL_ZB_TIMER_CANCEL(&g_watermeterCtx.timerPollRateEvt);
-        }
-        g_watermeterCtx.timerPollRateEvt = TL_ZB_TIMER_SCHEDULE(poll_rateAppCb, NULL, TIMEOUT_30SEC);
+    if (save_config || (hot_counter.flowing && clock_time_exceed(hot_counter.eval_time, FLOW_EVAL_TIME))) {
+        flow_update(&hot_counter, WATERMETER_ENDPOINT1);
+    }
+    if (save_config || (cold_counter.flowing && clock_time_exceed(cold_counter.eval_time, FLOW_EVAL_TIME))) {
+        flow_update(&cold_counter, WATERMETER_ENDPOINT2);
     }
 
-#if 0
-    gpio_setup_up_down_resistor(HOT_GPIO, PM_PIN_PULLUP_1M);
-    gpio_setup_up_down_resistor(COLD_GPIO, PM_PIN_PULLUP_1M);
-#endif
-
-    if (counters_idle()) {
-        sleep_ms(1);
+    if (save_config) {
+        flush_pending = true;
+        if (!COUNTERS_FLUSH_TIME || battery_low() ||
+                pending_hot > CHK_PENDING_MAX || pending_cold > CHK_PENDING_MAX) {
+            /* the register holds 3 pulses of a counter, with the next one they go to flash */
+            counters_flush();
+        } else if (!g_watermeterCtx.timerFlushEvt) {
+            /* a window is not opened on a weak battery, a brown-out would lose it */
+            if (battery_check()) {
+                counters_flush();
+            } else {
+                counters_pendingWrite();
+                /* the window is not restarted by next pulses */
+                g_watermeterCtx.timerFlushEvt = TL_ZB_TIMER_SCHEDULE(counters_flushCb, NULL, COUNTERS_FLUSH_TIME);
+            }
+        } else {
+            counters_pendingWrite();
+        }
+        poll_event(POLL_SRC_FLOW);
     }
 
     return save_config;
 }
 
 uint8_t counters_idle() {
-    if ((hot_counter.debounce != 1 && hot_counter.debounce != DEBOUNCE_COUNTER) ||
-        (cold_counter.debounce != 1 && cold_counter.debounce != DEBOUNCE_COUNTER)) {
+    if (edge_tail != edge_head) {
+        return true;
+    }
+    /* the debounce window is slept through, see counters_debounceWait() */
+    if ((hot_counter.pending || cold_counter.pending) && !g_watermeterCtx.timerDebounceEvt) {
         return true;
     }
     return false;
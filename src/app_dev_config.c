@@ -1,59 +1,57 @@
 #include "tl_common.h"
 #include "zcl_include.h"
+#include "ota.h"
 
 #include "watermeter.h"
 
 #define ID_CONFIG           0x0FED1410
 #define TOP_MASK            0xFFFFFFFF
 
+/* the journal of counters follows the full config in the same flash page */
+#define JOURNAL_OFFSET      32
+#define JOURNAL_RECORDS     ((FLASH_PAGE_SIZE - JOURNAL_OFFSET) / sizeof(watermeter_journal_t))
+#define JOURNAL_DELTA_MAX   0xFFFF
+
+#define CONFIG_PAGE_EMPTY   0                           /* erased or not a config   */
+#define CONFIG_PAGE_VALID   1
+#define CONFIG_PAGE_BROKEN  2                           /* ID_CONFIG, bad crc       */
+
 watermeter_config_t watermeter_config;
 
 static uint8_t  default_config = false;
 static uint32_t config_addr_start = 0;
 static uint32_t config_addr_end = 0;
 
+static uint8_t  journal_count = 0;              /* records in the current page  */
+static uint32_t journal_hot_water = 0;          /* counters saved in flash      */
+static uint32_t journal_cold_water = 0;
+
 uint32_t mcuBootAddrGet(void);
 
+/* the last 2 bytes of the record are crc */
 static uint16_t checksum(const uint8_t *src_buffer, uint8_t len) {
 
-    const uint16_t generator = 0xa010;
-
-    uint16_t crc = 0xffff;
-
-    len -= 2;
-
-    for (const uint8_t *ptr = src_buffer; ptr < src_buffer + len; ptr++) {
-        crc ^= *ptr;
-
-        for (uint8_t bit = 8; bit > 0; bit--) {
-            if (crc & 1)
-                crc = (crc >> 1) ^ generator;
-            else
-                crc >>= 1;
-        }
-    }
-
-    return crc;
+    return xcrc16(src_buffer, len - 2, 0xffff);
 }
 
 static void get_user_data_addr(uint8_t print) {
 #ifdef ZCL_OTA
     if (mcuBootAddrGet()) {
         config_addr_start = BEGIN_USER_DATA1;
-        config_addr_end = END_USER_DATA1;
+        config_addr_end = END_USER_DATA1 - HISTORY_SIZE;
 #if UART_PRINTF_MODE
         if (print) printf("OTA mode enabled. MCU boot from address: 0x%x\r\n", BEGIN_USER_DATA2);
 #endif /* UART_PRINTF_MODE */
     } else {
         config_addr_start = BEGIN_USER_DATA2;
-        config_addr_end = END_USER_DATA2;
+        config_addr_end = END_USER_DATA2 - HISTORY_SIZE;
 #if UART_PRINTF_MODE
         if (print) printf("OTA mode enabled. MCU boot from address: 0x%x\r\n", BEGIN_USER_DATA1);
 #endif /* UART_PRINTF_MODE */
     }
 #else
     config_addr_start = BEGIN_USER_DATA2;
-    config_addr_end = END_USER_DATA2;
+    config_addr_end = END_USER_DATA2 - HISTORY_SIZE;
 
 #if UART_PRINTF_MODE
     if (print) printf("OTA mode desabled. MCU boot from address: 0x%x\r\n", BEGIN_USER_DATA1);
@@ -68,16 +66,159 @@ static void get_user_data_addr(uint8_t print) {
 
 }
 
+/* the slot holds the partial OTA image, it is lost once the config is written there */
+static void drop_ota_checkpoint() {
+#ifdef ZCL_OTA
+    ota_clientInfoReset();
+#endif
+}
+
 static void clear_user_data(uint32_t flash_addr) {
 
     uint32_t flash_data_size = flash_addr + USER_DATA_SIZE;
 
+    drop_ota_checkpoint();
+
     while(flash_addr < flash_data_size) {
         flash_erase_sector(flash_addr);
         flash_addr += FLASH_SECTOR_SIZE;
     }
 }
 
+/* the history log follows the config ring */
+static void clear_history() {
+
+    for (uint32_t flash_addr = config_addr_end; flash_addr < config_addr_end + HISTORY_SIZE; flash_addr += FLASH_SECTOR_SIZE) {
+        flash_erase_sector(flash_addr);
+    }
+}
+
+/* pages from config_addr_start are written one after another with top + 1 */
+static uint8_t read_config_page(uint32_t flash_addr, watermeter_config_t *config) {
+
+    flash_read_page(flash_addr, sizeof(watermeter_config_t), (uint8_t*)config);
+
+    if (config->id != ID_CONFIG) {
+        return CONFIG_PAGE_EMPTY;
+    }
+
+    if (checksum((uint8_t*)config, sizeof(watermeter_config_t)) != config->crc) {
+        return CONFIG_PAGE_BROKEN;
+    }
+
+    return CONFIG_PAGE_VALID;
+}
+
+/* follow the chain page by page, used only if a broken page was found */
+static uint32_t scan_config_page(watermeter_config_t *config_curr) {
+    watermeter_config_t config_next;
+    uint32_t flash_addr = config_addr_start;
+
+    while (flash_addr + FLASH_PAGE_SIZE < config_addr_end) {
+        if (read_config_page(flash_addr + FLASH_PAGE_SIZE, &config_next) != CONFIG_PAGE_VALID ||
+                config_next.top != ((config_curr->top + 1) & TOP_MASK)) {
+            break;
+        }
+        memcpy(config_curr, &config_next, sizeof(watermeter_config_t));
+        flash_addr += FLASH_PAGE_SIZE;
+    }
+
+    return flash_addr;
+}
+
+/*
+ * config_curr - config from the first page on input, the newest config on output.
+ * Returns the flash address of the newest config.
+ * Page N of the chain holds top of the first page + N, pages after the chain are
+ * erased or hold older configs, so the end of the chain is found by binary search.
+ */
+static uint32_t find_config_page(watermeter_config_t *config_curr) {
+    watermeter_config_t config_next;
+    uint32_t lo = 0;                                                        /* last page in the chain   */
+    uint32_t hi = (config_addr_end - config_addr_start) / FLASH_PAGE_SIZE;  /* first page out the chain */
+    uint32_t mid;
+    uint8_t page;
+
+    while (hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        page = read_config_page(config_addr_start + mid * FLASH_PAGE_SIZE, &config_next);
+        if (page == CONFIG_PAGE_BROKEN) {
+#if UART_PRINTF_MODE && DEBUG_CONFIG
+            printf("Broken config in flash address - 0x%x\r\n", config_addr_start + mid * FLASH_PAGE_SIZE);
+#endif /* UART_PRINTF_MODE */
+            /* restart from the first page */
+            flash_read_page(config_addr_start, sizeof(watermeter_config_t), (uint8_t*)config_curr);
+            return scan_config_page(config_curr);
+        }
+        if (page == CONFIG_PAGE_VALID && config_next.top == ((config_curr->top + (mid - lo)) & TOP_MASK)) {
+            memcpy(config_curr, &config_next, sizeof(watermeter_config_t));
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return config_addr_start + lo * FLASH_PAGE_SIZE;
+}
+
+static void journal_reset() {
+    journal_count = 0;
+    journal_hot_water = watermeter_config.counter_hot_water;
+    journal_cold_water = watermeter_config.counter_cold_water;
+}
+
+static uint32_t journal_delta(uint32_t counter, uint32_t saved) {
+    if (counter >= saved) {
+        return counter - saved;
+    }
+    /* counter overflow */
+    return counter + COUNTERS_OVERFLOW - saved;
+}
+
+static uint8_t journal_erased(watermeter_journal_t *record) {
+    uint8_t *ptr = (uint8_t*)record;
+
+    for (uint8_t i = 0; i < sizeof(watermeter_journal_t); i++) {
+        if (ptr[i] != 0xFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* apply the journal of the current page, at most JOURNAL_RECORDS records */
+static void journal_restore() {
+    watermeter_journal_t journal[JOURNAL_RECORDS];
+    uint8_t i;
+
+    flash_read_page(watermeter_config.flash_addr_start + JOURNAL_OFFSET, sizeof(journal), (uint8_t*)journal);
+
+    for (i = 0; i < JOURNAL_RECORDS; i++) {
+        if (journal_erased(&journal[i]) ||
+                checksum((uint8_t*)&journal[i], sizeof(watermeter_journal_t)) != journal[i].crc) {
+            break;
+        }
+        watermeter_config.counter_hot_water =
+                check_counter_overflow(watermeter_config.counter_hot_water + journal[i].hot_water);
+        watermeter_config.counter_cold_water =
+                check_counter_overflow(watermeter_config.counter_cold_water + journal[i].cold_water);
+    }
+
+    journal_hot_water = watermeter_config.counter_hot_water;
+    journal_cold_water = watermeter_config.counter_cold_water;
+
+    if (i < JOURNAL_RECORDS && !journal_erased(&journal[i])) {
+        /* broken record, the next save starts a new page */
+        journal_count = JOURNAL_RECORDS;
+    } else {
+        journal_count = i;
+    }
+
+#if UART_PRINTF_MODE && DEBUG_CONFIG
+    printf("Restored %d journal records\r\n", i);
+#endif /* UART_PRINTF_MODE */
+}
+
 static void init_default_config() {
     memset(&watermeter_config, 0, sizeof(watermeter_config_t));
     watermeter_config.id = ID_CONFIG;
@@ -106,8 +247,7 @@ static void write_restore_config() {
 }
 
 void init_config(uint8_t print) {
-    watermeter_config_t config_curr, config_next, config_restore;
-    uint8_t find_config = false;
+    watermeter_config_t config_curr, config_restore;
     nv_sts_t st = NV_SUCC;
 
     get_user_data_addr(print);
@@ -132,18 +272,29 @@ void init_config(uint8_t print) {
     }
 
     if (config_restore.new_ota) {
-        config_restore.new_ota = false;
         config_restore.flash_addr_start = config_addr_start;
         config_restore.flash_addr_end = config_addr_end;
         memcpy(&watermeter_config, &config_restore, sizeof(watermeter_config_t));
+#ifdef ZCL_OTA
+        /* the slot keeps the partial image, the download is resumed from the checkpoint,
+         * the config stays in NV until the download is finished or abandoned */
+        if (ota_clientInfoResumable()) {
+#if UART_PRINTF_MODE && DEBUG_CONFIG
+            printf("OTA download is resumed, config is in NV.\r\n");
+#endif /* UART_PRINTF_MODE */
+            return;
+        }
+#endif
+        watermeter_config.new_ota = false;
+        /* left from the time this slot was used before the previous update */
+        drop_ota_checkpoint();
+        clear_history();
         default_config = true;
         write_config();
         return;
     }
 
-    uint32_t flash_addr = config_addr_start;
-
-    flash_read_page(flash_addr, sizeof(watermeter_config_t), (uint8_t*)&config_curr);
+    flash_read_page(config_addr_start, sizeof(watermeter_config_t), (uint8_t*)&config_curr);
 
     if (config_curr.id != ID_CONFIG) {
 #if UART_PRINTF_MODE && DEBUG_CONFIG
@@ -154,44 +305,25 @@ void init_config(uint8_t print) {
         return;
     }
 
-    flash_addr += FLASH_PAGE_SIZE;
-
-    while(flash_addr < config_addr_end) {
-        flash_read_page(flash_addr, sizeof(watermeter_config_t), (uint8_t*)&config_next);
-        crc = checksum((uint8_t*)&config_next, sizeof(watermeter_config_t));
-        if (config_next.id == ID_CONFIG && crc == config_next.crc) {
-            if ((config_curr.top + 1) == config_next.top || (config_curr.top == TOP_MASK && config_next.top == 0)) {
-                memcpy(&config_curr, &config_next, sizeof(watermeter_config_t));
-                flash_addr += FLASH_PAGE_SIZE;
-                continue;
-            }
-            find_config = true;
-            break;
-        }
-        find_config = true;
-        break;
-    }
+    /* the newest config may be on the last page as well */
+    uint32_t flash_addr = find_config_page(&config_curr);
 
-    if (find_config) {
-        memcpy(&watermeter_config, &config_curr, sizeof(watermeter_config_t));
-        watermeter_config.flash_addr_start = flash_addr-FLASH_PAGE_SIZE;
-#if UART_PRINTF_MODE && DEBUG_CONFIG
-        printf("Read config from flash address - 0x%x\r\n", watermeter_config.flash_addr_start);
-#endif /* UART_PRINTF_MODE */
-    } else {
+    memcpy(&watermeter_config, &config_curr, sizeof(watermeter_config_t));
+    watermeter_config.flash_addr_start = flash_addr;
 #if UART_PRINTF_MODE && DEBUG_CONFIG
-        printf("No active saved config! Reinit.\r\n");
+    printf("Read config from flash address - 0x%x\r\n", watermeter_config.flash_addr_start);
 #endif /* UART_PRINTF_MODE */
-        clear_user_data(config_addr_start);
-        init_default_config();
-    }
+    journal_restore();
 }
 
 void write_config() {
+    PROFILE_START(PROF_FLASH);
+
     if (default_config) {
         write_restore_config();
         flash_erase(watermeter_config.flash_addr_start);
         flash_write(watermeter_config.flash_addr_start, sizeof(watermeter_config_t), (uint8_t*)&(watermeter_config));
+        journal_reset();
         default_config = false;
 #if UART_PRINTF_MODE && DEBUG_CONFIG
         printf("Save config to flash address - 0x%x\r\n", watermeter_config.flash_addr_start);
@@ -209,6 +341,7 @@ void write_config() {
             watermeter_config.top &= TOP_MASK;
             watermeter_config.crc = checksum((uint8_t*)&(watermeter_config), sizeof(watermeter_config_t));
             flash_write(watermeter_config.flash_addr_start, sizeof(watermeter_config_t), (uint8_t*)&(watermeter_config));
+            journal_reset();
 #if UART_PRINTF_MODE && DEBUG_CONFIG
             printf("Save config to flash address - 0x%x\r\n", watermeter_config.flash_addr_start);
 #endif /* UART_PRINTF_MODE */
@@ -217,5 +350,54 @@ void write_config() {
         }
     }
 
+    PROFILE_STOP(PROF_FLASH);
+
+    counters_saved();
+}
+
+uint32_t get_history_addr() {
+
+    return config_addr_end;
 }
 
+/* save only the counters increment, the full config is saved when the page journal is full */
+void write_counters() {
+    watermeter_journal_t record;
+    uint32_t hot_water, cold_water;
+
+    if (default_config || watermeter_config.new_ota || journal_count >= JOURNAL_RECORDS) {
+        write_config();
+        return;
+    }
+
+    hot_water = journal_delta(watermeter_config.counter_hot_water, journal_hot_water);
+    cold_water = journal_delta(watermeter_config.counter_cold_water, journal_cold_water);
+
+    if (!hot_water && !cold_water) {
+        counters_saved();
+        return;
+    }
+
+    if (hot_water > JOURNAL_DELTA_MAX || cold_water > JOURNAL_DELTA_MAX) {
+        write_config();
+        return;
+    }
+
+    record.hot_water = hot_water;
+    record.cold_water = cold_water;
+    record.crc = checksum((uint8_t*)&record, sizeof(watermeter_journal_t));
+
+    PROFILE_START(PROF_FLASH);
+    flash_write(watermeter_config.flash_addr_start + JOURNAL_OFFSET + journal_count * sizeof(watermeter_journal_t),
+            sizeof(watermeter_journal_t), (uint8_t*)&record);
+    PROFILE_STOP(PROF_FLASH);
+
+    journal_count++;
+    journal_hot_water = watermeter_config.counter_hot_water;
+    journal_cold_water = watermeter_config.counter_cold_water;
+    counters_saved();
+
+#if UART_PRINTF_MODE && DEBUG_CONFIG
+    printf("Save journal record %d to flash address - 0x%x\r\n", journal_count, watermeter_config.flash_addr_start);
+#endif /* UART_PRINTF_MODE */
+}
@@ -21,7 +21,9 @@
 
 #define ZCL_UINT8       ZCL_DATA_TYPE_UINT8
 #define ZCL_UINT16      ZCL_DATA_TYPE_UINT16
+#define ZCL_UINT24      ZCL_DATA_TYPE_UINT24
 #define ZCL_UINT32      ZCL_DATA_TYPE_UINT32
+#define ZCL_INT24       ZCL_DATA_TYPE_INT24
 #define ZCL_UINT48      ZCL_DATA_TYPE_UINT48
 #define ZCL_ENUM8       ZCL_DATA_TYPE_ENUM8
 #define ZCL_ENUM16      ZCL_DATA_TYPE_ENUM16
@@ -30,6 +32,7 @@
 #define ZCL_BOOLEAN     ZCL_DATA_TYPE_BOOLEAN
 #define ZCL_CHAR_STR    ZCL_DATA_TYPE_CHAR_STR
 #define ZCL_IEEE_ADDR   ZCL_DATA_TYPE_IEEE_ADDR
+#define ZCL_OCTET_STR   ZCL_DATA_TYPE_OCTET_STR
 
 /**
  *  @brief Definition for Incoming cluster / Sever Cluster
@@ -254,12 +257,28 @@ zcl_powerAttr_t g_zcl_powerAttrs =
 {
     .batteryVoltage    = 30,   //in 100 mV units, 0xff - unknown
     .batteryPercentage = 0x64, //in 0,5% units, 0xff - unknown
+    .batteryAHrRating  = ENERGY_CAPACITY_DEF,
+    .energyRemaining   = ENERGY_REMAINING_UNKNOWN,
 };
 
 const zclAttrInfo_t powerCfg_attrTbl[] =
 {
     { ZCL_ATTRID_BATTERY_VOLTAGE,               ZCL_UINT8,  RR, (uint8_t*)&g_zcl_powerAttrs.batteryVoltage},
     { ZCL_ATTRID_BATTERY_PERCENTAGE_REMAINING,  ZCL_UINT8,  RR, (uint8_t*)&g_zcl_powerAttrs.batteryPercentage},
+    { ZCL_ATTRID_BATTERY_A_HR_RATING,           ZCL_UINT16, RW, (uint8_t*)&g_zcl_powerAttrs.batteryAHrRating},
+    { ZCL_ATTRID_CUSTOM_ENERGY_CONSUMED,        ZCL_UINT32, RW, (uint8_t*)&g_zcl_powerAttrs.energyConsumed},
+    { ZCL_ATTRID_CUSTOM_ENERGY_AVERAGE,         ZCL_UINT16, R,  (uint8_t*)&g_zcl_powerAttrs.energyAverage},
+    { ZCL_ATTRID_CUSTOM_ENERGY_REMAINING,       ZCL_UINT16, R,  (uint8_t*)&g_zcl_powerAttrs.energyRemaining},
+    { ZCL_ATTRID_CUSTOM_ENERGY_TIME + ENERGY_ACTIVE,     ZCL_UINT32, R,  (uint8_t*)&g_zcl_powerAttrs.energyTime[ENERGY_ACTIVE]},
+    { ZCL_ATTRID_CUSTOM_ENERGY_TIME + ENERGY_RX,         ZCL_UINT32, R,  (uint8_t*)&g_zcl_powerAttrs.energyTime[ENERGY_RX]},
+    { ZCL_ATTRID_CUSTOM_ENERGY_TIME + ENERGY_TX,         ZCL_UINT32, R,  (uint8_t*)&g_zcl_powerAttrs.energyTime[ENERGY_TX]},
+    { ZCL_ATTRID_CUSTOM_ENERGY_TIME + ENERGY_SUSPEND,    ZCL_UINT32, R,  (uint8_t*)&g_zcl_powerAttrs.energyTime[ENERGY_SUSPEND]},
+    { ZCL_ATTRID_CUSTOM_ENERGY_TIME + ENERGY_DEEP,       ZCL_UINT32, R,  (uint8_t*)&g_zcl_powerAttrs.energyTime[ENERGY_DEEP]},
+    { ZCL_ATTRID_CUSTOM_ENERGY_CURRENT + ENERGY_ACTIVE,  ZCL_UINT16, RW, (uint8_t*)&g_zcl_powerAttrs.energyCurrent[ENERGY_ACTIVE]},
+    { ZCL_ATTRID_CUSTOM_ENERGY_CURRENT + ENERGY_RX,      ZCL_UINT16, RW, (uint8_t*)&g_zcl_powerAttrs.energyCurrent[ENERGY_RX]},
+    { ZCL_ATTRID_CUSTOM_ENERGY_CURRENT + ENERGY_TX,      ZCL_UINT16, RW, (uint8_t*)&g_zcl_powerAttrs.energyCurrent[ENERGY_TX]},
+    { ZCL_ATTRID_CUSTOM_ENERGY_CURRENT + ENERGY_SUSPEND, ZCL_UINT16, RW, (uint8_t*)&g_zcl_powerAttrs.energyCurrent[ENERGY_SUSPEND]},
+    { ZCL_ATTRID_CUSTOM_ENERGY_CURRENT + ENERGY_DEEP,    ZCL_UINT16, RW, (uint8_t*)&g_zcl_powerAttrs.energyCurrent[ENERGY_DEEP]},
     { ZCL_ATTRID_GLOBAL_CLUSTER_REVISION,       ZCL_UINT16, R,  (uint8_t*)&zcl_attr_global_clusterRevision},
 };
 
@@ -363,6 +382,8 @@ zcl_watermeterCfgAttr_t g_zcl_watermeterCfgAttrs = {
     .hot_water_preset = 0,
     .cold_water_preset = 0,
     .water_step_preset = LITERS_PER_PULSE,
+    .poll_state = POLL_STATE_LONG,
+    .poll_interval = 0,
 };
 
 zcl_se_meteringAttr_t g_zcl_se_metering1Attrs = {
@@ -370,6 +391,10 @@ zcl_se_meteringAttr_t g_zcl_se_metering1Attrs = {
     .unit = 0x07,                   // 0x07 - Litres
     .summationFormatting = 0x40,    // 0b0100000 - 7bit - 0, 3-6bit - 8, 0-2bit - 0 = 0x40
     .deviceType = 2,                // 2 - Water Metering
+    .demandFormatting = 0x40,       // l/h, no fractional digits
+    .instantaneousDemand = 0,
+    .maxDemand = 0,
+    .minDemand = 0,
 };
 
 zcl_se_meteringAttr_t g_zcl_se_metering2Attrs = {
@@ -377,15 +402,23 @@ zcl_se_meteringAttr_t g_zcl_se_metering2Attrs = {
     .unit = 0x07,                   // 0x07 - Litres
     .summationFormatting = 0x40,    // 0b0100000 - 7bit - 0, 3-6bit - 8, 0-2bit - 0 = 0x40
     .deviceType = 2,                // 2 - Water Metering
+    .demandFormatting = 0x40,       // l/h, no fractional digits
+    .instantaneousDemand = 0,
+    .maxDemand = 0,
+    .minDemand = 0,
 };
 
 /* Attribute record list */
 const zclAttrInfo_t zcl_hotWater_attrTbl[] = {
     { ZCL_ATTRID_CURRENT_SUMMATION_DELIVERD,    ZCL_UINT48, RR, (uint8_t*)&g_zcl_watermeterAttrs.hot_water_counter},
+    { ZCL_ATTRID_CURRENT_MAX_DEMAND_DELIVERD,   ZCL_UINT24,     RW, (uint8_t*)&g_zcl_se_metering1Attrs.maxDemand            },
     { ZCL_ATTRID_STATUS,                        ZCL_BITMAP8,    R, (uint8_t*)&g_zcl_se_metering1Attrs.status                },
     { ZCL_ATTRID_UNIT_OF_MEASURE,               ZCL_ENUM8,      R, (uint8_t*)&g_zcl_se_metering1Attrs.unit                  },
     { ZCL_ATTRID_SUMMATION_FORMATTING,          ZCL_BITMAP8,    R, (uint8_t*)&g_zcl_se_metering1Attrs.summationFormatting   },
+    { ZCL_ATTRID_DEMAND_FORMATTING,             ZCL_BITMAP8,    R, (uint8_t*)&g_zcl_se_metering1Attrs.demandFormatting      },
     { ZCL_ATTRID_METERING_DEVICE_TYPE,          ZCL_BITMAP8,    R, (uint8_t*)&g_zcl_se_metering1Attrs.deviceType            },
+    { ZCL_ATTRID_INSTANTANEOUS_DEMAND,          ZCL_INT24,      RR, (uint8_t*)&g_zcl_se_metering1Attrs.instantaneousDemand  },
+    { ZCL_ATTRID_CUSTOM_MIN_DEMAND_DELIVERD,    ZCL_UINT24,     RW, (uint8_t*)&g_zcl_se_metering1Attrs.minDemand            },
     { ZCL_ATTRID_GLOBAL_CLUSTER_REVISION,       ZCL_UINT16, R,  (uint8_t*)&zcl_attr_global_clusterRevision},
 };
 
@@ -393,10 +426,14 @@ const zclAttrInfo_t zcl_hotWater_attrTbl[] = {
 
 const zclAttrInfo_t zcl_coldWater_attrTbl[] = {
     { ZCL_ATTRID_CURRENT_SUMMATION_DELIVERD,    ZCL_UINT48, RR, (uint8_t*)&g_zcl_watermeterAttrs.cold_water_counter},
+    { ZCL_ATTRID_CURRENT_MAX_DEMAND_DELIVERD,   ZCL_UINT24,     RW, (uint8_t*)&g_zcl_se_metering2Attrs.maxDemand            },
     { ZCL_ATTRID_STATUS,                        ZCL_BITMAP8,    R, (uint8_t*)&g_zcl_se_metering2Attrs.status                },
     { ZCL_ATTRID_UNIT_OF_MEASURE,               ZCL_ENUM8,      R, (uint8_t*)&g_zcl_se_metering2Attrs.unit                  },
     { ZCL_ATTRID_SUMMATION_FORMATTING,          ZCL_BITMAP8,    R, (uint8_t*)&g_zcl_se_metering2Attrs.summationFormatting   },
+    { ZCL_ATTRID_DEMAND_FORMATTING,             ZCL_BITMAP8,    R, (uint8_t*)&g_zcl_se_metering2Attrs.demandFormatting      },
     { ZCL_ATTRID_METERING_DEVICE_TYPE,          ZCL_BITMAP8,    R, (uint8_t*)&g_zcl_se_metering2Attrs.deviceType            },
+    { ZCL_ATTRID_INSTANTANEOUS_DEMAND,          ZCL_INT24,      RR, (uint8_t*)&g_zcl_se_metering2Attrs.instantaneousDemand  },
+    { ZCL_ATTRID_CUSTOM_MIN_DEMAND_DELIVERD,    ZCL_UINT24,     RW, (uint8_t*)&g_zcl_se_metering2Attrs.minDemand            },
     { ZCL_ATTRID_GLOBAL_CLUSTER_REVISION,       ZCL_UINT16, R,  (uint8_t*)&zcl_attr_global_clusterRevision},
 };
 
@@ -406,6 +443,35 @@ const zclAttrInfo_t zcl_watermeterCfg_attrTbl[] = {
     { ZCL_ATTRID_CUSTOM_HOT_WATER_PRESET,   ZCL_UINT32, RW, (uint8_t*)&g_zcl_watermeterCfgAttrs.hot_water_preset},
     { ZCL_ATTRID_CUSTOM_COLD_WATER_PRESET,  ZCL_UINT32, RW, (uint8_t*)&g_zcl_watermeterCfgAttrs.cold_water_preset},
     { ZCL_ATTRID_CUSTOM_WATER_STEP_PRESET,  ZCL_UINT16, RW, (uint8_t*)&g_zcl_watermeterCfgAttrs.water_step_preset},
+    { ZCL_ATTRID_CUSTOM_POLL_STATE,         ZCL_ENUM8,  R,  (uint8_t*)&g_zcl_watermeterCfgAttrs.poll_state},
+    { ZCL_ATTRID_CUSTOM_POLL_INTERVAL,      ZCL_UINT32, R,  (uint8_t*)&g_zcl_watermeterCfgAttrs.poll_interval},
+    { ZCL_ATTRID_CUSTOM_POLL_TIME_LONG,     ZCL_UINT32, R,  (uint8_t*)&g_zcl_watermeterCfgAttrs.poll_time[POLL_STATE_LONG]},
+    { ZCL_ATTRID_CUSTOM_POLL_TIME_SHORT,    ZCL_UINT32, R,  (uint8_t*)&g_zcl_watermeterCfgAttrs.poll_time[POLL_STATE_SHORT]},
+    { ZCL_ATTRID_CUSTOM_POLL_TIME_FAST,     ZCL_UINT32, R,  (uint8_t*)&g_zcl_watermeterCfgAttrs.poll_time[POLL_STATE_FAST]},
+    { ZCL_ATTRID_CUSTOM_POLL_TIME_OTA,      ZCL_UINT32, R,  (uint8_t*)&g_zcl_watermeterCfgAttrs.poll_time[POLL_STATE_OTA]},
+    { ZCL_ATTRID_CUSTOM_HISTORY_SEQ,        ZCL_UINT16, R,  (uint8_t*)&g_zcl_watermeterCfgAttrs.history_seq},
+    { ZCL_ATTRID_CUSTOM_LEAK_TIME,          ZCL_UINT16, RW, (uint8_t*)&g_zcl_watermeterCfgAttrs.leak_time},
+    { ZCL_ATTRID_CUSTOM_LEAK_GAP,           ZCL_UINT16, RW, (uint8_t*)&g_zcl_watermeterCfgAttrs.leak_gap},
+    { ZCL_ATTRID_CUSTOM_LEAK_STATUS,        ZCL_BITMAP8, R, (uint8_t*)&g_zcl_watermeterCfgAttrs.leak_status},
+    { ZCL_ATTRID_CUSTOM_LEAK_RUN_HOT,       ZCL_UINT32, R,  (uint8_t*)&g_zcl_watermeterCfgAttrs.leak_run[0]},
+    { ZCL_ATTRID_CUSTOM_LEAK_RUN_COLD,      ZCL_UINT32, R,  (uint8_t*)&g_zcl_watermeterCfgAttrs.leak_run[1]},
+    { ZCL_ATTRID_CUSTOM_LEAK_PAUSE_HOT,     ZCL_UINT16, R,  (uint8_t*)&g_zcl_watermeterCfgAttrs.leak_pause[0]},
+    { ZCL_ATTRID_CUSTOM_LEAK_PAUSE_COLD,    ZCL_UINT16, R,  (uint8_t*)&g_zcl_watermeterCfgAttrs.leak_pause[1]},
+#if DEBUG_BUF_STATS
+    { ZCL_ATTRID_CUSTOM_BUF_STATS,          ZCL_OCTET_STR, R, (uint8_t*)&g_zcl_watermeterCfgAttrs.buf_stats},
+#endif
+#if DEBUG_PROFILE
+    { ZCL_ATTRID_CUSTOM_PROF_STATS + PROF_AWAKE,      ZCL_OCTET_STR, R, (uint8_t*)&g_zcl_watermeterCfgAttrs.prof_stats[PROF_AWAKE]},
+    { ZCL_ATTRID_CUSTOM_PROF_STATS + PROF_STACK,      ZCL_OCTET_STR, R, (uint8_t*)&g_zcl_watermeterCfgAttrs.prof_stats[PROF_STACK]},
+    { ZCL_ATTRID_CUSTOM_PROF_STATS + PROF_APP_TASK,   ZCL_OCTET_STR, R, (uint8_t*)&g_zcl_watermeterCfgAttrs.prof_stats[PROF_APP_TASK]},
+    { ZCL_ATTRID_CUSTOM_PROF_STATS + PROF_BUTTON,     ZCL_OCTET_STR, R, (uint8_t*)&g_zcl_watermeterCfgAttrs.prof_stats[PROF_BUTTON]},
+    { ZCL_ATTRID_CUSTOM_PROF_STATS + PROF_COUNTERS,   ZCL_OCTET_STR, R, (uint8_t*)&g_zcl_watermeterCfgAttrs.prof_stats[PROF_COUNTERS]},
+    { ZCL_ATTRID_CUSTOM_PROF_STATS + PROF_WATERLEAK,  ZCL_OCTET_STR, R, (uint8_t*)&g_zcl_watermeterCfgAttrs.prof_stats[PROF_WATERLEAK]},
+    { ZCL_ATTRID_CUSTOM_PROF_STATS + PROF_REPORT,     ZCL_OCTET_STR, R, (uint8_t*)&g_zcl_watermeterCfgAttrs.prof_stats[PROF_REPORT]},
+    { ZCL_ATTRID_CUSTOM_PROF_STATS + PROF_POLL,       ZCL_OCTET_STR, R, (uint8_t*)&g_zcl_watermeterCfgAttrs.prof_stats[PROF_POLL]},
+    { ZCL_ATTRID_CUSTOM_PROF_STATS + PROF_NV_COMPACT, ZCL_OCTET_STR, R, (uint8_t*)&g_zcl_watermeterCfgAttrs.prof_stats[PROF_NV_COMPACT]},
+    { ZCL_ATTRID_CUSTOM_PROF_STATS + PROF_FLASH,      ZCL_OCTET_STR, R, (uint8_t*)&g_zcl_watermeterCfgAttrs.prof_stats[PROF_FLASH]},
+#endif
     { ZCL_ATTRID_GLOBAL_CLUSTER_REVISION,   ZCL_UINT16, R,  (uint8_t*)&zcl_attr_global_clusterRevision},
 };
 
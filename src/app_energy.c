@@ -0,0 +1,208 @@
+#include "tl_common.h"
+#include "zcl_include.h"
+
+#include "watermeter.h"
+
+#define ENERGY_AWAKE_MAX    TIMEOUT_TICK_30SEC          /* us, clock_time() wraps after 268 sec         */
+#define ENERGY_CHUNK        60000                       /* ms, chunk * current fits 32 bits             */
+#define ENERGY_WINDOW       (24 * 3600)                 /* sec, the average current is of the last day  */
+#define ENERGY_WINDOW_MIN   3600                        /* sec, the first estimate after the boot       */
+#define ENERGY_SAVE_STEP    1000                        /* uAh, consumed is saved in NV so often        */
+
+typedef struct {
+    uint32_t consumed;                  /* uAh  */
+    uint32_t time[ENERGY_MAX];          /* sec  */
+    uint16_t current[ENERGY_MAX];       /* uA   */
+    uint16_t capacity;                  /* 10 mAh */
+    uint16_t average;                   /* 0.1 uA */
+} energy_cfg_t;
+
+typedef struct {
+    uint32_t awake_start;               /* clock_time() of the awake interval       */
+    uint32_t sleep_start;               /* 32k tick before the sleep                */
+    uint32_t sleep_ticks;               /* not yet counted in ms                    */
+    uint32_t us[ENERGY_MAX];            /* not yet counted in ms                    */
+    uint32_t ms[ENERGY_MAX];            /* not yet counted in the time attribute    */
+    uint32_t uAms;                      /* charge not yet counted in uAs            */
+    uint32_t uAs;                       /* not yet counted in uAh                   */
+    uint32_t window_uAs;                /* charge and time of the current window    */
+    uint32_t window_s;
+    uint32_t saved;                     /* consumed uAh in NV                       */
+} energy_ctx_t;
+
+static energy_ctx_t energy;
+
+/* no 64-bit math, the time is split into chunks */
+static void energy_charge(uint32_t ms, uint16_t current) {
+    uint32_t part, uAs;
+
+    while (ms) {
+        part = ms > ENERGY_CHUNK ? ENERGY_CHUNK : ms;
+        ms -= part;
+
+        energy.uAms += part * current;
+        uAs = energy.uAms / 1000;
+        energy.uAms %= 1000;
+
+        energy.window_uAs += uAs;
+        energy.uAs += uAs;
+        g_zcl_powerAttrs.energyConsumed += energy.uAs / 3600;
+        energy.uAs %= 3600;
+    }
+}
+
+static void energy_add(uint8_t state, uint32_t ms) {
+
+    energy_charge(ms, g_zcl_powerAttrs.energyCurrent[state]);
+
+    ms += energy.ms[state];
+    g_zcl_powerAttrs.energyTime[state] += ms / 1000;
+    energy.window_s += ms / 1000;
+    energy.ms[state] = ms % 1000;
+}
+
+static void energy_addUs(uint8_t state, uint32_t us) {
+
+    us += energy.us[state];
+    energy.us[state] = us % 1000;
+    energy_add(state, us / 1000);
+}
+
+/* the awake interval up to now, the radio time is a part of it */
+static void energy_awake() {
+    uint32_t rf_time[RF_STATE_OFF + 1];
+    uint32_t now = clock_time();
+    uint32_t us = (now - energy.awake_start) / sys_tick_per_us;
+    uint32_t rx, tx;
+
+    energy.awake_start = now;
+    rf_stateTimeGet(rf_time);
+
+    rx = rf_time[RF_STATE_RX] + rf_time[RF_STATE_ED];
+    tx = rf_time[RF_STATE_TX];
+
+    energy_addUs(ENERGY_RX, rx);
+    energy_addUs(ENERGY_TX, tx);
+    energy_addUs(ENERGY_ACTIVE, us > rx + tx ? us - rx - tx : 0);
+}
+
+void energy_init() {
+    energy_cfg_t cfg;
+
+    memset(&energy, 0, sizeof(energy_ctx_t));
+
+    g_zcl_powerAttrs.batteryAHrRating = ENERGY_CAPACITY_DEF;
+    g_zcl_powerAttrs.energyConsumed = 0;
+    g_zcl_powerAttrs.energyAverage = 0;
+    g_zcl_powerAttrs.energyRemaining = ENERGY_REMAINING_UNKNOWN;
+    memset(g_zcl_powerAttrs.energyTime, 0, sizeof(g_zcl_powerAttrs.energyTime));
+    g_zcl_powerAttrs.energyCurrent[ENERGY_ACTIVE] = ENERGY_ACTIVE_DEF;
+    g_zcl_powerAttrs.energyCurrent[ENERGY_RX] = ENERGY_RX_DEF;
+    g_zcl_powerAttrs.energyCurrent[ENERGY_TX] = ENERGY_TX_DEF;
+    g_zcl_powerAttrs.energyCurrent[ENERGY_SUSPEND] = ENERGY_SUSPEND_DEF;
+    g_zcl_powerAttrs.energyCurrent[ENERGY_DEEP] = ENERGY_DEEP_DEF;
+
+    if (nv_flashReadNew(1, NV_MODULE_APP, NV_ITEM_APP_ENERGY, sizeof(energy_cfg_t), (uint8_t*)&cfg) == NV_SUCC) {
+        g_zcl_powerAttrs.batteryAHrRating = cfg.capacity;
+        g_zcl_powerAttrs.energyConsumed = cfg.consumed;
+        g_zcl_powerAttrs.energyAverage = cfg.average;
+        memcpy(g_zcl_powerAttrs.energyTime, cfg.time, sizeof(cfg.time));
+        memcpy(g_zcl_powerAttrs.energyCurrent, cfg.current, sizeof(cfg.current));
+    }
+
+    energy.saved = g_zcl_powerAttrs.energyConsumed;
+    energy.awake_start = clock_time();
+    rf_stateTimeGet(NULL);
+
+    energy_estimate();
+}
+
+/* from app_task(), a long awake interval is counted in parts */
+void energy_handler() {
+
+    if (clock_time_exceed(energy.awake_start, ENERGY_AWAKE_MAX)) {
+        energy_awake();
+    }
+}
+
+/* just before drv_pm_lowPowerEnter() */
+void energy_sleep() {
+
+    energy_awake();
+    energy.sleep_start = pm_get_32k_tick();
+}
+
+/* ENERGY_SUSPEND - after drv_pm_lowPowerEnter(), ENERGY_DEEP - from user_init() with retention */
+void energy_wakeup(uint8_t state) {
+    uint32_t ticks = pm_get_32k_tick() - energy.sleep_start + energy.sleep_ticks;
+
+    energy.sleep_ticks = ticks % tick_32k_tick_per_ms;
+    energy_add(state, ticks / tick_32k_tick_per_ms);
+
+    /* neither the CPU nor the radio were on while sleeping */
+    energy.awake_start = clock_time();
+    rf_stateTimeGet(NULL);
+}
+
+/* from batteryCb(), the average current and the remaining battery life */
+void energy_estimate() {
+    uint32_t capacity, left, average, hours;
+
+    energy_awake();
+
+    if (energy.window_s >= ENERGY_WINDOW || (!g_zcl_powerAttrs.energyAverage && energy.window_s >= ENERGY_WINDOW_MIN)) {
+        /* 0.1 uA */
+        average = energy.window_uAs / energy.window_s * 10 + energy.window_uAs % energy.window_s * 10 / energy.window_s;
+        g_zcl_powerAttrs.energyAverage = average < ENERGY_AVERAGE_MAX ? average : ENERGY_AVERAGE_MAX;
+        if (energy.window_s >= ENERGY_WINDOW) {
+            energy.window_uAs = 0;
+            energy.window_s = 0;
+        }
+    }
+
+    /* uAh */
+    capacity = g_zcl_powerAttrs.batteryAHrRating * 10000;
+    left = capacity > g_zcl_powerAttrs.energyConsumed ? capacity - g_zcl_powerAttrs.energyConsumed : 0;
+
+    if (!capacity || !g_zcl_powerAttrs.energyAverage) {
+        g_zcl_powerAttrs.energyRemaining = ENERGY_REMAINING_UNKNOWN;
+    } else {
+        average = g_zcl_powerAttrs.energyAverage;
+        hours = left / average * 10 + left % average * 10 / average;
+        g_zcl_powerAttrs.energyRemaining = hours / 24 < ENERGY_REMAINING_UNKNOWN ? hours / 24 : ENERGY_REMAINING_UNKNOWN - 1;
+    }
+
+#if UART_PRINTF_MODE && DEBUG_ENERGY
+    printf("Energy consumed: %d uAh, average: %d x 0.1 uA, remaining: %d days\r\n",
+            g_zcl_powerAttrs.energyConsumed, g_zcl_powerAttrs.energyAverage, g_zcl_powerAttrs.energyRemaining);
+    printf("Energy time active: %d, rx: %d, tx: %d, suspend: %d, deep: %d sec\r\n",
+            g_zcl_powerAttrs.energyTime[ENERGY_ACTIVE], g_zcl_powerAttrs.energyTime[ENERGY_RX], g_zcl_powerAttrs.energyTime[ENERGY_TX],
+            g_zcl_powerAttrs.energyTime[ENERGY_SUSPEND], g_zcl_powerAttrs.energyTime[ENERGY_DEEP]);
+#endif /* UART_PRINTF_MODE */
+
+    if (g_zcl_powerAttrs.energyConsumed - energy.saved >= ENERGY_SAVE_STEP) {
+        energy_save();
+    }
+}
+
+void energy_save() {
+    energy_cfg_t cfg;
+
+    cfg.consumed = g_zcl_powerAttrs.energyConsumed;
+    cfg.capacity = g_zcl_powerAttrs.batteryAHrRating;
+    cfg.average = g_zcl_powerAttrs.energyAverage;
+    memcpy(cfg.time, g_zcl_powerAttrs.energyTime, sizeof(cfg.time));
+    memcpy(cfg.current, g_zcl_powerAttrs.energyCurrent, sizeof(cfg.current));
+
+    nv_flashWriteNew(1, NV_MODULE_APP, NV_ITEM_APP_ENERGY, sizeof(energy_cfg_t), (uint8_t*)&cfg);
+
+    energy.saved = g_zcl_powerAttrs.energyConsumed;
+}
+
+/* capacity, consumed (0 - a new battery) or the current model is written */
+void energy_cfgSave() {
+
+    energy.saved = g_zcl_powerAttrs.energyConsumed;
+    energy_estimate();
+    energy_save();
+}
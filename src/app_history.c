@@ -0,0 +1,307 @@
+#include "tl_common.h"
+#include "zcl_include.h"
+
+#include "watermeter.h"
+
+#define ID_HISTORY          0x0FED1422
+#define HISTORY_RECORDS     (FLASH_SECTOR_SIZE / sizeof(history_record_t) - 1)   /* the first one is the header */
+#define HISTORY_DELTA_MAX   0xFFFF
+#define HISTORY_PROFILE_MAX 16                          /* intervals per Get Profile Response, fits with APS security */
+
+/* Get Profile Response status */
+#define PROFILE_SUCCESS             0x00
+#define PROFILE_UNDEFINED_CHANNEL   0x01
+#define PROFILE_UNSUP_CHANNEL       0x02
+#define PROFILE_INVALID_END_TIME    0x03
+#define PROFILE_MORE_PERIODS        0x04
+#define PROFILE_NO_INTERVALS        0x05
+
+static uint32_t history_addr_start = 0;
+static uint32_t history_addr_end = 0;
+static uint32_t history_addr = 0;               /* next record, a sector boundary - a new sector is needed */
+static uint32_t history_sector = 0;             /* sector of the newest record                              */
+static uint8_t  history_empty = true;           /* no records yet                                           */
+static uint16_t history_seq = 0;                /* seq of the next record                                   */
+static uint32_t history_hot_water = 0;          /* counters at the beginning of the interval                */
+static uint32_t history_cold_water = 0;
+
+/* the last 2 bytes of the record are crc */
+static uint16_t checksum(const uint8_t *src_buffer, uint8_t len) {
+
+    return xcrc16(src_buffer, len - 2, 0xffff);
+}
+
+static uint8_t read_header(uint32_t sector, history_header_t *header) {
+
+    flash_read_page(sector, sizeof(history_header_t), (uint8_t*)header);
+
+    return header->id == ID_HISTORY && checksum((uint8_t*)header, sizeof(history_header_t)) == header->crc;
+}
+
+static uint8_t record_erased(uint32_t flash_addr) {
+    history_record_t record;
+    uint8_t *ptr = (uint8_t*)&record;
+
+    flash_read_page(flash_addr, sizeof(history_record_t), ptr);
+
+    for (uint8_t i = 0; i < sizeof(history_record_t); i++) {
+        if (ptr[i] != 0xFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint32_t prev_sector(uint32_t sector) {
+
+    if (sector == history_addr_start) {
+        sector = history_addr_end;
+    }
+    return sector - FLASH_SECTOR_SIZE;
+}
+
+/*
+ * The newest sector has the highest seq in the header, records of a sector are
+ * written one after another, so the first erased one is found by binary search.
+ * A broken record is not erased and only takes its seq.
+ */
+static void history_scan() {
+    history_header_t header;
+    uint16_t newest_seq = 0;
+    uint32_t lo, hi, mid;
+
+    history_empty = true;
+
+    for (uint32_t sector = history_addr_start; sector < history_addr_end; sector += FLASH_SECTOR_SIZE) {
+        if (read_header(sector, &header) && (history_empty || (int16_t)(header.seq - newest_seq) > 0)) {
+            history_sector = sector;
+            newest_seq = header.seq;
+            history_empty = false;
+        }
+    }
+
+    if (history_empty) {
+        history_addr = history_addr_start;
+        history_seq = 0;
+        return;
+    }
+
+    lo = 0;                                     /* last used slot, the header   */
+    hi = HISTORY_RECORDS + 1;                   /* first erased slot            */
+
+    while (hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if (record_erased(history_sector + mid * sizeof(history_record_t))) {
+            hi = mid;
+        } else {
+            lo = mid;
+        }
+    }
+
+    /* the header only, records are in the previous sector if it is just before */
+    if (lo == 0) {
+        history_empty = !read_header(prev_sector(history_sector), &header) ||
+                (uint16_t)(newest_seq - header.seq) != HISTORY_RECORDS;
+    }
+
+    history_addr = history_sector + (lo + 1) * sizeof(history_record_t);
+    history_seq = newest_seq + lo;
+}
+
+/* the flash address of the record, 0 - not in the log */
+static uint32_t history_find(uint16_t seq) {
+    history_header_t header;
+    uint32_t sector = history_sector;
+    uint32_t count = (history_addr - history_sector) / sizeof(history_record_t) - 1;
+    uint16_t next_seq = 0;
+    uint16_t offset;
+
+    for (uint8_t i = 0; i < HISTORY_SECTORS; i++) {
+        if (!read_header(sector, &header)) {
+            return 0;
+        }
+        /* an older sector is valid only if it is full and just before the next one */
+        if (i && (uint16_t)(next_seq - header.seq) != HISTORY_RECORDS) {
+            return 0;
+        }
+        offset = seq - header.seq;
+        if (offset < count) {
+            return sector + (offset + 1) * sizeof(history_record_t);
+        }
+        next_seq = header.seq;
+        count = HISTORY_RECORDS;
+        sector = prev_sector(sector);
+    }
+
+    return 0;
+}
+
+static uint32_t history_delta(uint32_t counter, uint32_t saved) {
+    uint32_t delta;
+
+    if (counter >= saved) {
+        delta = counter - saved;
+    } else {
+        /* counter overflow */
+        delta = counter + COUNTERS_OVERFLOW - saved;
+    }
+
+    return delta > HISTORY_DELTA_MAX ? HISTORY_DELTA_MAX : delta;
+}
+
+static void history_append() {
+    history_header_t header;
+    history_record_t record;
+
+    PROFILE_START(PROF_FLASH);
+
+    if (history_addr % FLASH_SECTOR_SIZE == 0) {
+        if (history_addr == history_addr_end) {
+            history_addr = history_addr_start;
+        }
+        flash_erase(history_addr);
+        header.id = ID_HISTORY;
+        header.seq = history_seq;
+        header.crc = checksum((uint8_t*)&header, sizeof(history_header_t));
+        flash_write(history_addr, sizeof(history_header_t), (uint8_t*)&header);
+        history_sector = history_addr;
+        history_addr += sizeof(history_header_t);
+    }
+
+    record.hot_water = history_delta(watermeter_config.counter_hot_water, history_hot_water);
+    record.cold_water = history_delta(watermeter_config.counter_cold_water, history_cold_water);
+    record.seq = history_seq;
+    record.crc = checksum((uint8_t*)&record, sizeof(history_record_t));
+
+    flash_write(history_addr, sizeof(history_record_t), (uint8_t*)&record);
+    PROFILE_STOP(PROF_FLASH);
+
+    history_addr += sizeof(history_record_t);
+    history_seq++;
+    history_empty = false;
+    history_hot_water = watermeter_config.counter_hot_water;
+    history_cold_water = watermeter_config.counter_cold_water;
+
+    g_zcl_watermeterCfgAttrs.history_seq = history_seq;
+
+#if UART_PRINTF_MODE && DEBUG_HISTORY
+    printf("History record %d, hot: %d, cold: %d\r\n", record.seq, record.hot_water, record.cold_water);
+#endif /* UART_PRINTF_MODE */
+}
+
+static int32_t history_timerCb(void *arg) {
+
+    /* the region is being overwritten by the new image */
+    if (watermeter_config.new_ota) {
+        return 0;
+    }
+
+    history_append();
+
+    return 0;
+}
+
+void history_init(uint32_t flash_addr) {
+
+    history_addr_start = flash_addr;
+    history_addr_end = flash_addr + HISTORY_SIZE;
+
+    history_scan();
+    history_preset();
+
+    g_zcl_watermeterCfgAttrs.history_seq = history_seq;
+
+#if UART_PRINTF_MODE && DEBUG_HISTORY
+    printf("History from flash address - 0x%x, next record: %d\r\n", history_addr, history_seq);
+#endif /* UART_PRINTF_MODE */
+
+    if (g_watermeterCtx.timerHistoryEvt) {
+        TL_ZB_TIMER_CANCEL(&g_watermeterCtx.timerHistoryEvt);
+    }
+    g_watermeterCtx.timerHistoryEvt = TL_ZB_TIMER_SCHEDULE(history_timerCb, NULL, HISTORY_INTERVAL);
+}
+
+/* new counters values, the current interval starts from them */
+void history_preset() {
+
+    history_hot_water = watermeter_config.counter_hot_water;
+    history_cold_water = watermeter_config.counter_cold_water;
+}
+
+/*
+ * Get Profile on the hot (EP1) or cold (EP2) water endpoint.
+ * There is no real time clock, so EndTime is the seq of an interval instead of UTC:
+ * 0 - the newest one, the seq of the next interval is the attribute on EP3.
+ * Intervals are sent from EndTime back, the newest first.
+ */
+uint8_t history_getProfile(uint8_t endpoint, zclIncomingAddrInfo_t *pAddrInfo, zcl_metering_getProfileCmd_t *pCmd) {
+    zcl_metering_getProfileRspCmd_t rsp;
+    history_record_t record;
+    uint8_t intervals[HISTORY_PROFILE_MAX * 3];
+    uint8_t periods = pCmd->numberOfPeriods;
+    uint16_t end = history_seq - 1;
+    uint32_t value, flash_addr;
+
+    memset(&rsp, 0, sizeof(zcl_metering_getProfileRspCmd_t));
+    rsp.profileIntervalPeriod = HISTORY_PERIOD;
+    rsp.intervals = intervals;
+
+    if (pCmd->intervalChannel > 1) {
+        rsp.status = PROFILE_UNDEFINED_CHANNEL;
+    } else if (pCmd->intervalChannel == 1) {
+        /* consumption received */
+        rsp.status = PROFILE_UNSUP_CHANNEL;
+    } else if (history_empty) {
+        rsp.status = PROFILE_NO_INTERVALS;
+    } else if (pCmd->endTime > 0xFFFF || (pCmd->endTime && (int16_t)((uint16_t)pCmd->endTime - end) > 0)) {
+        rsp.status = PROFILE_INVALID_END_TIME;
+    } else {
+        if (pCmd->endTime) {
+            end = pCmd->endTime;
+        }
+        if (periods > HISTORY_PROFILE_MAX) {
+            periods = HISTORY_PROFILE_MAX;
+            rsp.status = PROFILE_MORE_PERIODS;
+        }
+        for (uint8_t i = 0; i < periods; i++) {
+            flash_addr = history_find(end - i);
+            if (!flash_addr) {
+                break;
+            }
+            flash_read_page(flash_addr, sizeof(history_record_t), (uint8_t*)&record);
+            value = 0;
+            if (checksum((uint8_t*)&record, sizeof(history_record_t)) == record.crc && record.seq == (uint16_t)(end - i)) {
+                value = endpoint == WATERMETER_ENDPOINT1 ? record.hot_water : record.cold_water;
+            }
+            intervals[i * 3]     = U32_BYTE0(value);
+            intervals[i * 3 + 1] = U32_BYTE1(value);
+            intervals[i * 3 + 2] = U32_BYTE2(value);
+            rsp.numberOfPeriodsDelived++;
+        }
+        if (!rsp.numberOfPeriodsDelived) {
+            rsp.status = PROFILE_NO_INTERVALS;
+        } else {
+            rsp.endTime = end;
+        }
+    }
+
+#if UART_PRINTF_MODE && DEBUG_HISTORY
+    printf("Get profile ep: %d, end: %d, periods: %d, status: %d\r\n", endpoint, end, rsp.numberOfPeriodsDelived, rsp.status);
+#endif /* UART_PRINTF_MODE */
+
+    epInfo_t dstEpInfo;
+    TL_SETSTRUCTCONTENT(dstEpInfo, 0);
+
+    dstEpInfo.dstAddrMode = APS_SHORT_DSTADDR_WITHEP;
+    dstEpInfo.dstAddr.shortAddr = pAddrInfo->srcAddr;
+    dstEpInfo.dstEp = pAddrInfo->srcEp;
+    dstEpInfo.profileId = pAddrInfo->profileId;
+    dstEpInfo.txOptions = APS_TX_OPT_ACK_TX;
+    if (pAddrInfo->apsSec) {
+        dstEpInfo.txOptions |= APS_TX_OPT_SECURITY_ENABLED;
+    }
+
+    zcl_metering_getProfileRsp(endpoint, &dstEpInfo, TRUE, pAddrInfo->seqNum, &rsp);
+
+    return ZCL_STA_CMD_HAS_RESP;
+}
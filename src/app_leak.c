@@ -332,3 +332,166 @@ uint8_t waterleak_idle() {
     return false;
 }
 
+
+/*
+ * Continuous flow - a dripping tap or a toilet cistern does not stop for hours.
+ * A run is a series of pulses without a pause of leak_gap, the alarm is raised
+ * when a run is longer than leak_time and cleared when the water stops.
+ */
+
+#define FLOWLEAK_TIME_DEF   1440                        /* min, no pause of FLOWLEAK_GAP_DEF for a day  */
+#define FLOWLEAK_GAP_DEF    60                          /* min                                          */
+#define FLOWLEAK_GAP_MAX    1440                        /* min, the 32k tick wraps after 37 hours       */
+#define FLOWLEAK_MIN        (60 * 1000)                 /* ms                                           */
+
+typedef struct {
+    uint16_t leak_time;
+    uint16_t leak_gap;
+} flowleak_cfg_t;
+
+static flowleak_t flowleak[FLOWLEAK_CHANNELS];
+static ev_timer_event_t *flowleak_timerEvt = NULL;
+
+static void flowleak_notify() {
+    uint16_t len;
+    epInfo_t dstEpInfo;
+    zoneStatusChangeNoti_t statusChangeNotification;
+
+    zcl_getAttrVal(WATERMETER_ENDPOINT4, ZCL_CLUSTER_SS_IAS_ZONE, ZCL_ATTRID_ZONE_STATUS, &len, (u8*)&statusChangeNotification.zoneStatus);
+    zcl_getAttrVal(WATERMETER_ENDPOINT4, ZCL_CLUSTER_SS_IAS_ZONE, ZCL_ATTRID_ZONE_ID, &len, &statusChangeNotification.zoneId);
+
+    if (g_zcl_watermeterCfgAttrs.leak_status) {
+        statusChangeNotification.zoneStatus |= ZONE_STATUS_BIT_ALARM2;
+    } else {
+        statusChangeNotification.zoneStatus &= ~ZONE_STATUS_BIT_ALARM2;
+    }
+    zcl_setAttrVal(WATERMETER_ENDPOINT4, ZCL_CLUSTER_SS_IAS_ZONE, ZCL_ATTRID_ZONE_STATUS, (u8*)&statusChangeNotification.zoneStatus);
+
+    if (zb_isDeviceJoinedNwk()) {
+        fillIASAddress(&dstEpInfo);
+        statusChangeNotification.extStatus = 0;
+        statusChangeNotification.delay = 0;
+        zcl_iasZone_statusChangeNotificationCmd(WATERMETER_ENDPOINT4, &dstEpInfo, TRUE, &statusChangeNotification);
+    }
+}
+
+static void flowleak_attrUpdate(uint8_t channel) {
+
+    g_zcl_watermeterCfgAttrs.leak_run[channel] = flowleak[channel].run_ms / FLOWLEAK_MIN;
+    g_zcl_watermeterCfgAttrs.leak_pause[channel] = flowleak[channel].gap_max_ms / FLOWLEAK_MIN;
+}
+
+static void flowleak_stop(uint8_t channel) {
+
+    flowleak[channel].running = false;
+    flowleak[channel].run_ms = 0;
+    flowleak[channel].gap_max_ms = 0;
+    flowleak_attrUpdate(channel);
+
+    if (g_zcl_watermeterCfgAttrs.leak_status & BIT(channel)) {
+#if UART_PRINTF_MODE && DEBUG_WATERLEAK
+        printf("Continuous flow channel %d stopped\r\n", channel);
+#endif /* UART_PRINTF_MODE */
+        g_zcl_watermeterCfgAttrs.leak_status &= ~BIT(channel);
+        flowleak_notify();
+    }
+}
+
+/* the next pause end, the water has stopped if there was no pulse before it */
+static int32_t flowleak_timerCb(void *arg) {
+    uint32_t gap_ms = g_zcl_watermeterCfgAttrs.leak_gap * FLOWLEAK_MIN;
+    uint32_t next_ms = 0;
+    uint32_t dt_ms;
+
+    for (uint8_t channel = 0; channel < FLOWLEAK_CHANNELS; channel++) {
+        if (!flowleak[channel].running) continue;
+        dt_ms = (pm_get_32k_tick() - flowleak[channel].pulse_tick) / tick_32k_tick_per_ms;
+        if (dt_ms >= gap_ms) {
+            flowleak_stop(channel);
+        } else if (!next_ms || gap_ms - dt_ms < next_ms) {
+            next_ms = gap_ms - dt_ms;
+        }
+    }
+
+    if (!next_ms) {
+        flowleak_timerEvt = NULL;
+        return -1;
+    }
+
+    return next_ms;
+}
+
+void flowleak_init() {
+    flowleak_cfg_t cfg;
+
+    memset(flowleak, 0, sizeof(flowleak));
+
+    g_zcl_watermeterCfgAttrs.leak_time = FLOWLEAK_TIME_DEF;
+    g_zcl_watermeterCfgAttrs.leak_gap = FLOWLEAK_GAP_DEF;
+
+    if (nv_flashReadNew(1, NV_MODULE_APP, NV_ITEM_APP_LEAK_CFG, sizeof(flowleak_cfg_t), (uint8_t*)&cfg) == NV_SUCC) {
+        g_zcl_watermeterCfgAttrs.leak_time = cfg.leak_time;
+        g_zcl_watermeterCfgAttrs.leak_gap = cfg.leak_gap;
+    }
+}
+
+/* leak_time or leak_gap is written */
+void flowleak_cfgSave() {
+    flowleak_cfg_t cfg;
+
+    if (!g_zcl_watermeterCfgAttrs.leak_gap) {
+        g_zcl_watermeterCfgAttrs.leak_gap = 1;
+    } else if (g_zcl_watermeterCfgAttrs.leak_gap > FLOWLEAK_GAP_MAX) {
+        g_zcl_watermeterCfgAttrs.leak_gap = FLOWLEAK_GAP_MAX;
+    }
+
+    cfg.leak_time = g_zcl_watermeterCfgAttrs.leak_time;
+    cfg.leak_gap = g_zcl_watermeterCfgAttrs.leak_gap;
+
+    nv_flashWriteNew(1, NV_MODULE_APP, NV_ITEM_APP_LEAK_CFG, sizeof(flowleak_cfg_t), (uint8_t*)&cfg);
+
+    /* disabled, otherwise the alarm is checked with the next pulse */
+    if (!g_zcl_watermeterCfgAttrs.leak_time && g_zcl_watermeterCfgAttrs.leak_status) {
+        g_zcl_watermeterCfgAttrs.leak_status = 0;
+        flowleak_notify();
+    }
+}
+
+/* called by counters_handler() on each pulse of the channel */
+void flowleak_pulse(uint8_t channel) {
+    flowleak_t *fl = &flowleak[channel];
+    uint32_t tick = pm_get_32k_tick();
+    uint32_t gap_ms = g_zcl_watermeterCfgAttrs.leak_gap * FLOWLEAK_MIN;
+    uint32_t dt_ms;
+
+    if (fl->running) {
+        dt_ms = (tick - fl->pulse_tick) / tick_32k_tick_per_ms;
+        if (dt_ms < gap_ms) {
+            fl->run_ms += dt_ms;
+            if (dt_ms > fl->gap_max_ms) {
+                fl->gap_max_ms = dt_ms;
+            }
+        } else {
+            /* the timer has not been run yet */
+            flowleak_stop(channel);
+        }
+    }
+
+    fl->running = true;
+    fl->pulse_tick = tick;
+    flowleak_attrUpdate(channel);
+
+    if (g_zcl_watermeterCfgAttrs.leak_time && !(g_zcl_watermeterCfgAttrs.leak_status & BIT(channel)) &&
+            fl->run_ms >= (uint32_t)g_zcl_watermeterCfgAttrs.leak_time * FLOWLEAK_MIN) {
+#if UART_PRINTF_MODE && DEBUG_WATERLEAK
+        printf("Continuous flow channel %d for %d min\r\n", channel, fl->run_ms / FLOWLEAK_MIN);
+#endif /* UART_PRINTF_MODE */
+        g_zcl_watermeterCfgAttrs.leak_status |= BIT(channel);
+        flowleak_notify();
+    }
+
+    /* a running timer ends the pause of the other channel first, then finds the next one */
+    if (!flowleak_timerEvt) {
+        flowleak_timerEvt = TL_ZB_TIMER_SCHEDULE(flowleak_timerCb, NULL, gap_ms);
+    }
+}
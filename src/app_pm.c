@@ -43,7 +43,12 @@ void app_wakeupPinLevelChange() {
 void app_lowPowerEnter() {
 
     app_wakeupPinLevelChange();
+    PROFILE_SLEEP();
+    energy_sleep();
     drv_pm_lowPowerEnter();
+    /* returns after suspend only, deep sleep with retention starts from user_init() */
+    energy_wakeup(ENERGY_SUSPEND);
+    PROFILE_WAKEUP();
 }
 
 int32_t no_joinedCb(void *arg) {
@@ -60,6 +65,9 @@ int32_t no_joinedCb(void *arg) {
         printf("Without network more then 30 minutes! Deep sleep ...\r\n");
 #endif
 
+        counters_flush();
+        energy_save();
+
         app_wakeupPinLevelChange();
 
         apsCleanToStopSecondClock();
@@ -87,8 +95,9 @@ void set_regDeepSleep() {
     /* 0x01: input level on HOT_PIN before deep sleep                   */
     /* 0x02: input level on COLD_PIN before deep sleep                  */
     /* 0x04: 1 - deep sleep, watchdog or soft_reset,  0 - new start MCU */
+    /* 0x78: pending pulses, kept as they are                           */
 
-    reg_deep_sleep = 0x04;
+    reg_deep_sleep = (analog_read(CHK_DEEP_SLEEP) & CHK_PENDING_MASK) | 0x04;
     if (drv_gpio_read(HOT_GPIO))  reg_deep_sleep |= 0x01;
     if (drv_gpio_read(COLD_GPIO)) reg_deep_sleep |= 0x02;
 
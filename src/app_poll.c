@@ -0,0 +1,201 @@
+#include "tl_common.h"
+#include "zcl_include.h"
+
+#include "watermeter.h"
+
+#define POLL_BACKOFF_EMPTY  4                           /* empty polls before the short poll is doubled */
+#define POLL_BACKOFF_MAX    3                           /* short_poll << 3 at most                      */
+#define POLL_SHORT_MAX      7000                        /* ms, below macTransactionPersistenceTime,     */
+                                                        /* frames for us are not dropped by the parent  */
+#define POLL_NO_ACK_MAX     3                           /* parent does not answer, interval << 3 at most */
+#define POLL_ACTIVE_MAX     TIMEOUT_1MIN                /* holds are checked at least so often,         */
+                                                        /* clock_time() wraps after 268 sec             */
+
+typedef struct {
+    uint32_t event_time[POLL_SRC_MAX];  /* clock_time() of the last event           */
+    uint32_t time_ms[POLL_STATE_MAX];   /* not yet counted in the attributes        */
+    uint8_t  active;                    /* bit per poll_src_t, hold not expired     */
+    uint8_t  ota;
+    uint8_t  fast;
+    uint8_t  state;
+    uint8_t  backoff;                   /* short_poll << backoff                    */
+    uint8_t  empty;                     /* empty polls in a row                     */
+    uint8_t  no_ack;                    /* unanswered polls in a row                */
+} poll_ctrl_t;
+
+static poll_ctrl_t poll_ctrl;
+
+/* how long the short poll is held after the event, ms */
+static const uint32_t poll_hold[POLL_SRC_MAX] = {
+    TIMEOUT_30SEC,      /* POLL_SRC_JOIN    - interview, binding, configure reporting   */
+    TIMEOUT_30SEC,      /* POLL_SRC_FLOW    - attribute read after the report           */
+    TIMEOUT_2MIN,       /* POLL_SRC_BUTTON  - the user is configuring the device        */
+    TIMEOUT_2MIN,       /* POLL_SRC_OTA     - upgrade end, image notify                 */
+    TIMEOUT_15SEC,      /* POLL_SRC_RX      - more may follow                           */
+    TIMEOUT_5SEC,       /* POLL_SRC_TX      - response is waited for                    */
+};
+
+static uint32_t poll_interval(uint8_t state) {
+    uint32_t interval;
+#ifdef ZCL_POLL_CTRL
+    zcl_pollCtrlAttr_t *pPollCtrlAttr = zcl_pollCtrlAttrGet();
+#endif
+
+    switch (state) {
+        case POLL_STATE_OTA:
+            interval = QUEUE_POLL_RATE;
+            break;
+#ifdef ZCL_POLL_CTRL
+        case POLL_STATE_FAST:
+            interval = pPollCtrlAttr->shortPollInterval * POLL_RATE_QUARTERSECONDS;
+            break;
+#endif
+        case POLL_STATE_SHORT:
+            interval = g_watermeterCtx.short_poll << poll_ctrl.backoff;
+            if (poll_ctrl.backoff && interval > POLL_SHORT_MAX) {
+                interval = max2(g_watermeterCtx.short_poll, POLL_SHORT_MAX);
+            }
+            break;
+        default:
+            return g_watermeterCtx.long_poll;
+    }
+
+    /* no use to poll fast a parent that does not answer */
+    if (poll_ctrl.no_ack) {
+        interval <<= poll_ctrl.no_ack;
+        if (interval > POLL_ACTIVE_MAX) {
+            interval = POLL_ACTIVE_MAX;
+        }
+    }
+
+    if (interval > g_watermeterCtx.long_poll) {
+        interval = g_watermeterCtx.long_poll;
+    }
+
+    return interval;
+}
+
+static void poll_attrUpdate() {
+
+    g_zcl_watermeterCfgAttrs.poll_state = poll_ctrl.state;
+    g_zcl_watermeterCfgAttrs.poll_interval = g_watermeterCtx.current_poll;
+
+    for (uint8_t i = 0; i < POLL_STATE_MAX; i++) {
+        g_zcl_watermeterCfgAttrs.poll_time[i] += poll_ctrl.time_ms[i] / 1000;
+        poll_ctrl.time_ms[i] %= 1000;
+    }
+}
+
+void poll_init() {
+
+    memset(&poll_ctrl, 0, sizeof(poll_ctrl_t));
+    g_watermeterCtx.current_poll = 0;
+
+#ifdef ZCL_POLL_CTRL
+    zcl_pollCtrlAttr_t *pPollCtrlAttr = zcl_pollCtrlAttrGet();
+    pPollCtrlAttr->longPollInterval = g_watermeterCtx.long_poll / POLL_RATE_QUARTERSECONDS;
+#endif
+}
+
+void poll_event(uint8_t src) {
+
+    if (src >= POLL_SRC_MAX) return;
+
+    /* water running for an hour keeps the backoff, anything else resets it */
+    if (src != POLL_SRC_FLOW || poll_ctrl.state == POLL_STATE_LONG) {
+        poll_ctrl.backoff = 0;
+        poll_ctrl.empty = 0;
+    }
+
+    poll_ctrl.event_time[src] = clock_time();
+    poll_ctrl.active |= BIT(src);
+}
+
+void poll_ota(uint8_t active) {
+
+    poll_ctrl.ota = active;
+
+    if (!active) {
+        poll_event(POLL_SRC_OTA);
+    }
+}
+
+void poll_fast(uint8_t active) {
+
+    poll_ctrl.fast = active;
+}
+
+void poll_handler() {
+
+    uint8_t state = POLL_STATE_LONG;
+    uint32_t interval;
+
+    if (!zb_isDeviceJoinedNwk()) return;
+
+    /* hysteresis - up at once, down when the last hold is expired */
+    for (uint8_t src = 0; src < POLL_SRC_MAX; src++) {
+        if ((poll_ctrl.active & BIT(src)) &&
+                clock_time_exceed(poll_ctrl.event_time[src], poll_hold[src] * 1000)) {
+            poll_ctrl.active &= ~BIT(src);
+        }
+    }
+
+    if (poll_ctrl.ota) {
+        state = POLL_STATE_OTA;
+    } else if (poll_ctrl.fast) {
+        state = POLL_STATE_FAST;
+    } else if (poll_ctrl.active) {
+        state = POLL_STATE_SHORT;
+    }
+
+    if (state != poll_ctrl.state) {
+#if UART_PRINTF_MODE && DEBUG_POLL
+        printf("Poll state %d -> %d\r\n", poll_ctrl.state, state);
+#endif /* UART_PRINTF_MODE */
+        poll_ctrl.state = state;
+    }
+
+    interval = poll_interval(state);
+
+    if (interval != g_watermeterCtx.current_poll) {
+#if UART_PRINTF_MODE && DEBUG_POLL
+        printf("Poll interval %d ms\r\n", interval);
+#endif /* UART_PRINTF_MODE */
+        g_watermeterCtx.current_poll = interval;
+        zb_setPollRate(interval);
+        poll_attrUpdate();
+    }
+}
+
+/* confirm of each data request to the parent */
+void poll_syncCnfHandler(nlme_sync_cnf_t *pSyncCnf) {
+
+    poll_ctrl.time_ms[poll_ctrl.state] += g_watermeterCtx.current_poll;
+
+    switch (pSyncCnf->status) {
+        case MAC_SUCCESS:
+            /* parent had data for us */
+            poll_ctrl.no_ack = 0;
+            poll_event(POLL_SRC_RX);
+            break;
+        case MAC_STA_NO_DATA:
+            poll_ctrl.no_ack = 0;
+            if (poll_ctrl.state == POLL_STATE_SHORT && ++poll_ctrl.empty >= POLL_BACKOFF_EMPTY) {
+                poll_ctrl.empty = 0;
+                if (poll_ctrl.backoff < POLL_BACKOFF_MAX) {
+                    poll_ctrl.backoff++;
+                }
+            }
+            break;
+        case MAC_STA_NO_ACK:
+        case MAC_STA_CHANNEL_ACCESS_FAILURE:
+            if (poll_ctrl.no_ack < POLL_NO_ACK_MAX) {
+                poll_ctrl.no_ack++;
+            }
+            break;
+        default:
+            break;
+    }
+
+    poll_attrUpdate();
+}
@@ -0,0 +1,72 @@
+#include "tl_common.h"
+#include "zcl_include.h"
+
+#include "watermeter.h"
+
+#if DEBUG_PROFILE
+
+#define PROFILE_DUMP_TIME   TIMEOUT_TICK_30SEC          /* us, printf of the table */
+
+static prof_entry_t prof_stat[PROF_MAX];
+static uint16_t prof_us[PROF_MAX];                      /* not yet counted in total_ms */
+static uint32_t awake_start = 0;
+
+#if UART_PRINTF_MODE
+static uint32_t dump_time = 0;
+
+static const char *prof_name[PROF_MAX] = {
+    "awake",
+    "stack",
+    "app_task",
+    "button",
+    "counters",
+    "waterleak",
+    "report",
+    "poll",
+    "nv_compact",
+    "flash",
+};
+#endif /* UART_PRINTF_MODE */
+
+void profile_add(uint8_t region, uint32_t start) {
+    uint32_t us = (clock_time() - start) / sys_tick_per_us;
+    prof_entry_t *stat = &prof_stat[region];
+
+    stat->count++;
+    if (us > stat->max_us) {
+        stat->max_us = us;
+    }
+    /* no 64-bit math, 32-bit us are 71 minutes only */
+    us += prof_us[region];
+    stat->total_ms += us / 1000;
+    prof_us[region] = us % 1000;
+
+    /* no read callback in ZCL, keep the attribute up to date */
+    g_zcl_watermeterCfgAttrs.prof_stats[region][0] = sizeof(prof_entry_t);
+    memcpy(g_zcl_watermeterCfgAttrs.prof_stats[region] + 1, stat, sizeof(prof_entry_t));
+}
+
+/* after drv_pm_lowPowerEnter() and after the wakeup from deep sleep with retention */
+void profile_wakeup() {
+
+    awake_start = clock_time();
+}
+
+void profile_sleep() {
+
+    profile_add(PROF_AWAKE, awake_start);
+}
+
+void profile_handler() {
+#if UART_PRINTF_MODE
+    if (clock_time_exceed(dump_time, PROFILE_DUMP_TIME)) {
+        dump_time = clock_time();
+        printf("Profile: region, count, total ms, max us\r\n");
+        for (uint8_t i = 0; i < PROF_MAX; i++) {
+            printf("%s, %d, %d, %d\r\n", prof_name[i], prof_stat[i].count, prof_stat[i].total_ms, prof_stat[i].max_us);
+        }
+    }
+#endif /* UART_PRINTF_MODE */
+}
+
+#endif /* DEBUG_PROFILE */
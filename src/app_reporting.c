@@ -5,12 +5,135 @@
 
 #define BUILD_U48(b0, b1, b2, b3, b4, b5)   ( (uint64_t)((((uint64_t)(b5) & 0x0000000000ff) << 40) + (((uint64_t)(b4) & 0x0000000000ff) << 32) + (((uint64_t)(b3) & 0x0000000000ff) << 24) + (((uint64_t)(b2) & 0x0000000000ff) << 16) + (((uint64_t)(b1) & 0x0000000000ff) << 8) + ((uint64_t)(b0) & 0x00000000FF)) )
 
+#define REPORT_BATCH_TIME   100                             /* ms, reports within this time are sent together */
+#define REPORT_BATCH_NUM    (ZCL_REPORTING_TABLE_NUM + 4)   /* reporting table and forced report              */
+#define REPORT_PAYLOAD_MAX  (APS_MAXPACKET_LENGTH - 3)      /* without ZCL header                             */
+
+typedef struct {
+    epInfo_t         dstEpInfo;
+    reportCfgInfo_t *pEntry;                                /* NULL for forced report                         */
+    uint16_t         clusterId;
+    uint16_t         attrId;
+    uint8_t          endpoint;
+} report_batch_t;
+
 app_reporting_t app_reporting[ZCL_REPORTING_TABLE_NUM];
 
+static uint8_t report_bindNum = 0;
+
+static report_batch_t report_batch[REPORT_BATCH_NUM];
+static uint8_t report_batch_num = 0;
+static ev_timer_event_t *timerReportBatchEvt = NULL;
+
 /**********************************************************************
  * Custom reporting application
  */
 
+static uint8_t report_batchSame(report_batch_t *a, report_batch_t *b) {
+    return a->endpoint == b->endpoint && a->clusterId == b->clusterId &&
+            !memcmp(&a->dstEpInfo, &b->dstEpInfo, sizeof(epInfo_t));
+}
+
+/* one Report Attributes frame per endpoint, cluster and destination */
+static void report_batchFlush() {
+    uint32_t cmd_buf[(sizeof(zclReportCmd_t) + REPORT_BATCH_NUM * sizeof(zclReport_t) + 3) / 4];
+    zclReportCmd_t *pReportCmd = (zclReportCmd_t*)cmd_buf;
+    uint8_t done[REPORT_BATCH_NUM];
+    uint16_t len, attrLen;
+
+    if (timerReportBatchEvt) {
+        TL_ZB_TIMER_CANCEL(&timerReportBatchEvt);
+    }
+
+    memset(done, 0, sizeof(done));
+
+    for (uint8_t i = 0; i < report_batch_num; i++) {
+        if (done[i]) continue;
+
+        pReportCmd->numAttr = 0;
+        len = 0;
+
+        for (uint8_t j = i; j < report_batch_num; j++) {
+            report_batch_t *pBatch = &report_batch[j];
+
+            if (done[j] || !report_batchSame(&report_batch[i], pBatch)) continue;
+
+            zclAttrInfo_t *pAttrEntry = zcl_findAttribute(pBatch->endpoint, pBatch->clusterId, pBatch->attrId);
+            if (!pAttrEntry) {
+                //should not happen.
+                ZB_EXCEPTION_POST(SYS_EXCEPTTION_ZB_ZCL_ENTRY);
+                done[j] = true;
+                continue;
+            }
+
+            attrLen = zcl_getAttrSize(pAttrEntry->type, pAttrEntry->data);
+
+            /* does not fit, it goes to the next frame */
+            if (pReportCmd->numAttr && len + 3 + attrLen > REPORT_PAYLOAD_MAX) continue;
+
+            if (pBatch->pEntry) {
+                //store for next compare
+                memcpy(pBatch->pEntry->prevData, pAttrEntry->data, (attrLen>8) ? (8):(attrLen));
+            }
+
+            pReportCmd->attrList[pReportCmd->numAttr].attrID = pAttrEntry->id;
+            pReportCmd->attrList[pReportCmd->numAttr].dataType = pAttrEntry->type;
+            pReportCmd->attrList[pReportCmd->numAttr].attrData = pAttrEntry->data;
+            pReportCmd->numAttr++;
+            len += 3 + attrLen;
+            done[j] = true;
+        }
+
+        if (pReportCmd->numAttr) {
+#if UART_PRINTF_MODE && DEBUG_REPORTING
+            printf("Report has been sent. endPoint: %d, clusterID: 0x%x, attributes: %d, len: %d\r\n",
+                    report_batch[i].endpoint, report_batch[i].clusterId, pReportCmd->numAttr, len);
+#endif
+            zcl_sendReportAttrsCmd(report_batch[i].endpoint, &report_batch[i].dstEpInfo, TRUE, ZCL_FRAME_SERVER_CLIENT_DIR,
+                    report_batch[i].clusterId, pReportCmd);
+        }
+    }
+
+    report_batch_num = 0;
+}
+
+static int32_t report_batchFlushCb(void *arg) {
+
+    timerReportBatchEvt = NULL;
+    report_batchFlush();
+
+    return -1;
+}
+
+static void report_batchAdd(uint8_t endpoint, epInfo_t *dstEpInfo, uint16_t clusterId, uint16_t attrId, reportCfgInfo_t *pEntry) {
+    report_batch_t *pBatch;
+
+    for (uint8_t i = 0; i < report_batch_num; i++) {
+        pBatch = &report_batch[i];
+        if (pBatch->attrId == attrId && pBatch->endpoint == endpoint && pBatch->clusterId == clusterId &&
+                !memcmp(&pBatch->dstEpInfo, dstEpInfo, sizeof(epInfo_t))) {
+            /* already queued, the value is taken when sending */
+            if (pEntry) pBatch->pEntry = pEntry;
+            return;
+        }
+    }
+
+    if (report_batch_num == REPORT_BATCH_NUM) {
+        report_batchFlush();
+    }
+
+    pBatch = &report_batch[report_batch_num++];
+    memcpy(&pBatch->dstEpInfo, dstEpInfo, sizeof(epInfo_t));
+    pBatch->pEntry = pEntry;
+    pBatch->clusterId = clusterId;
+    pBatch->attrId = attrId;
+    pBatch->endpoint = endpoint;
+
+    if (!timerReportBatchEvt) {
+        timerReportBatchEvt = TL_ZB_TIMER_SCHEDULE(report_batchFlushCb, NULL, REPORT_BATCH_TIME);
+    }
+}
+
 static void reportAttr(reportCfgInfo_t *pEntry) {
     if(!zb_bindingTblSearched(pEntry->clusterID, pEntry->endPoint)){
         return;
@@ -22,22 +145,7 @@ static void reportAttr(reportCfgInfo_t *pEntry) {
     dstEpInfo.dstAddrMode = APS_DSTADDR_EP_NOTPRESETNT;
     dstEpInfo.profileId = pEntry->profileID;
 
-    zclAttrInfo_t *pAttrEntry = zcl_findAttribute(pEntry->endPoint, pEntry->clusterID, pEntry->attrID);
-    if(!pAttrEntry){
-        //should not happen.
-        ZB_EXCEPTION_POST(SYS_EXCEPTTION_ZB_ZCL_ENTRY);
-        return;
-    }
-
-    u16 len = zcl_getAttrSize(pAttrEntry->type, pAttrEntry->data);
-
-    len = (len>8) ? (8):(len);
-
-    //store for next compare
-    memcpy(pEntry->prevData, pAttrEntry->data, len);
-
-    zcl_sendReportCmd(pEntry->endPoint, &dstEpInfo,  TRUE, ZCL_FRAME_SERVER_CLIENT_DIR,
-                      pEntry->clusterID, pAttrEntry->id, pAttrEntry->type, pAttrEntry->data);
+    report_batchAdd(pEntry->endPoint, &dstEpInfo, pEntry->clusterID, pEntry->attrID, pEntry);
 }
 
 static uint8_t app_reportableChangeValueChk(uint8_t dataType, uint8_t *curValue, uint8_t *prevValue, uint8_t *reportableChange) {
@@ -123,9 +231,10 @@ static int32_t app_reportMaxAttrTimerCb(void *arg) {
     return 0;
 }
 
-static void app_reportAttrTimerStart() {
+static void app_reportAttrTimerStart(uint32_t dirty) {
     if(zcl_reportingEntryActiveNumGet()) {
         for(uint8_t i = 0; i < ZCL_REPORTING_TABLE_NUM; i++) {
+            if (!(dirty & BIT(i))) continue;
             reportCfgInfo_t *pEntry = &reportingTab.reportCfgInfo[i];
             app_reporting[i].pEntry = pEntry;
             if(pEntry->used && (pEntry->maxInterval != 0xFFFF) && (pEntry->minInterval || pEntry->maxInterval)){
@@ -159,13 +268,14 @@ static void app_reportAttrTimerStart() {
     }
 }
 
-static void app_reportNoMinLimit(void) {
+static void app_reportNoMinLimit(uint32_t dirty) {
 
     if(zcl_reportingEntryActiveNumGet()) {
         zclAttrInfo_t *pAttrEntry = NULL;
         uint16_t len = 0;
 
         for(uint8_t i = 0; i < ZCL_REPORTING_TABLE_NUM; i++){
+            if (!(dirty & BIT(i))) continue;
             reportCfgInfo_t *pEntry = &reportingTab.reportCfgInfo[i];
             if(pEntry->used && (pEntry->maxInterval == 0 || ((pEntry->maxInterval != 0xFFFF) && (pEntry->minInterval == 0)))) {
 //                printf("app_reportNoMinLimit()\r\n");
@@ -233,12 +343,23 @@ void app_report_handler(void) {
 
         if (g_watermeterCtx.timerStopReportEvt) return;
 
+        /* only entries with a changed value or config, all of them if the binding table is changed */
+        uint32_t dirty = zcl_reportingDirtyGet();
+        uint8_t bindNum = aps_bindingTblEntryNum();
+
+        if (bindNum != report_bindNum) {
+            report_bindNum = bindNum;
+            dirty = (uint32_t)((1ULL << ZCL_REPORTING_TABLE_NUM) - 1);
+        }
+
+        if (!dirty) return;
+
         if(zcl_reportingEntryActiveNumGet()) {
 
-            app_reportNoMinLimit();
+            app_reportNoMinLimit(dirty);
 
             //start report timers
-            app_reportAttrTimerStart();
+            app_reportAttrTimerStart(dirty);
         }
     }
 }
@@ -262,27 +383,16 @@ int32_t forcedReportCb(void *arg) {
         dstEpInfo.dstEp = WATERMETER_ENDPOINT1;
         dstEpInfo.dstAddr.shortAddr = 0xfffc;
 #endif
-        zclAttrInfo_t *pAttrEntry;
-        pAttrEntry = zcl_findAttribute(WATERMETER_ENDPOINT1, ZCL_CLUSTER_GEN_POWER_CFG, ZCL_ATTRID_BATTERY_VOLTAGE);
-        zcl_sendReportCmd(WATERMETER_ENDPOINT1, &dstEpInfo,  TRUE, ZCL_FRAME_SERVER_CLIENT_DIR,
-                ZCL_CLUSTER_GEN_POWER_CFG, pAttrEntry->id, pAttrEntry->type, pAttrEntry->data);
-
-        pAttrEntry = zcl_findAttribute(WATERMETER_ENDPOINT1, ZCL_CLUSTER_GEN_POWER_CFG, ZCL_ATTRID_BATTERY_PERCENTAGE_REMAINING);
-        zcl_sendReportCmd(WATERMETER_ENDPOINT1, &dstEpInfo,  TRUE, ZCL_FRAME_SERVER_CLIENT_DIR,
-                ZCL_CLUSTER_GEN_POWER_CFG, pAttrEntry->id, pAttrEntry->type, pAttrEntry->data);
-
-        pAttrEntry = zcl_findAttribute(WATERMETER_ENDPOINT1, ZCL_CLUSTER_SE_METERING, ZCL_ATTRID_CURRENT_SUMMATION_DELIVERD);
-        zcl_sendReportCmd(WATERMETER_ENDPOINT1, &dstEpInfo,  TRUE, ZCL_FRAME_SERVER_CLIENT_DIR,
-                ZCL_CLUSTER_SE_METERING, pAttrEntry->id, pAttrEntry->type, pAttrEntry->data);
+        report_batchAdd(WATERMETER_ENDPOINT1, &dstEpInfo, ZCL_CLUSTER_GEN_POWER_CFG, ZCL_ATTRID_BATTERY_VOLTAGE, NULL);
+        report_batchAdd(WATERMETER_ENDPOINT1, &dstEpInfo, ZCL_CLUSTER_GEN_POWER_CFG, ZCL_ATTRID_BATTERY_PERCENTAGE_REMAINING, NULL);
+        report_batchAdd(WATERMETER_ENDPOINT1, &dstEpInfo, ZCL_CLUSTER_SE_METERING, ZCL_ATTRID_CURRENT_SUMMATION_DELIVERD, NULL);
 
 #if FIND_AND_BIND_SUPPORT
         dstEpInfo.dstAddrMode = APS_DSTADDR_EP_NOTPRESETNT;
 #else
         dstEpInfo.dstEp = WATERMETER_ENDPOINT2;
 #endif
-        pAttrEntry = zcl_findAttribute(WATERMETER_ENDPOINT2, ZCL_CLUSTER_SE_METERING, ZCL_ATTRID_CURRENT_SUMMATION_DELIVERD);
-        zcl_sendReportCmd(WATERMETER_ENDPOINT2, &dstEpInfo,  TRUE, ZCL_FRAME_SERVER_CLIENT_DIR,
-                ZCL_CLUSTER_SE_METERING, pAttrEntry->id, pAttrEntry->type, pAttrEntry->data);
+        report_batchAdd(WATERMETER_ENDPOINT2, &dstEpInfo, ZCL_CLUSTER_SE_METERING, ZCL_ATTRID_CURRENT_SUMMATION_DELIVERD, NULL);
 
     }
 
@@ -24,6 +24,7 @@
  *******************************************************************************************************/
 
 #include "zb_common.h"
+#include "app_profile.h"
 
 extern void user_init(bool isRetention);
 
@@ -70,7 +71,9 @@ int main(void){
 		drv_wd_clear();
 #endif
 
+		PROFILE_START(PROF_STACK);
 		tl_zbTaskProcedure();
+		PROFILE_STOP(PROF_STACK);
 
 #if	(MODULE_WATCHDOG_ENABLE)
 		drv_wd_clear();
@@ -3,8 +3,11 @@
 
 #define MAX_VBAT_MV             3100                        /* 3100 mV - > battery = 100%         */
 #define MIN_VBAT_MV             BATTERY_SAFETY_THRESHOLD    /* 2200 mV - > battery = 0%           */
+#define LOW_VBAT_MV             2400                        /* 2400 mV - > save counters at once  */
 #define BATTERY_TIMER_INTERVAL  TIMEOUT_15MIN
 
 int32_t batteryCb(void *arg);
+uint8_t battery_low();
+uint8_t battery_check();
 
 #endif /* SRC_INCLUDE_APP_BATTERY_H_ */
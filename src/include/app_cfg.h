@@ -47,6 +47,9 @@ extern "C" {
 #define LONG_POLL           REPORTING_MIN
 #define TIMEOUT_NET         TIMEOUT_30MIN
 
+/* for saving counters, pulses within this time are saved to flash at once, 0 - every pulse */
+#define COUNTERS_FLUSH_TIME TIMEOUT_1MIN
+
 /**********************************************************************
  * Product Information
  */
@@ -72,7 +75,12 @@ extern "C" {
 #define DEBUG_BATTERY                   OFF
 #define DEBUG_PM                        OFF
 #define DEBUG_OTA                       OFF
+#define DEBUG_POLL                      OFF
+#define DEBUG_HISTORY                   OFF
+#define DEBUG_ENERGY                    OFF
 #define DEBUG_STA_STATUS                OFF
+#define DEBUG_BUF_STATS                 OFF     /* ev buffer statistics in the ZCL attribute on EP3 */
+#define DEBUG_PROFILE                   OFF     /* awake time by region in the ZCL attributes on EP3 */
 
 /* PM */
 #define PM_ENABLE						ON
@@ -129,6 +137,8 @@ extern "C" {
     #define BEGIN_USER_DATA2            0x40000
     #define END_USER_DATA2              (BEGIN_USER_DATA2 + USER_DATA_SIZE)
     #define NV_ITEM_APP_USER_CFG        (NV_ITEM_APP_GP_TRANS_TABLE + 1)    // see sdk/proj/drivers/drv_nv.h
+    #define NV_ITEM_APP_LEAK_CFG        (NV_ITEM_APP_USER_CFG + 1)          // continuous flow thresholds
+    #define NV_ITEM_APP_ENERGY          (NV_ITEM_APP_LEAK_CFG + 1)          // battery charge estimate
 #elif defined(MCU_CORE_8278)
     #define FLASH_CAP_SIZE_1M           1
     #define BOARD                       BOARD_8278_DONGLE//BOARD_8278_EVK
@@ -211,6 +221,8 @@ extern "C" {
 #define ZCL_POWER_CFG_SUPPORT           ON
 #define ZCL_METERING_SUPPORT            ON
 #define ZCL_OTA_SUPPORT                 ON
+#define OTA_IMAGE_PAGE_SIZE             512     /* bytes, 0 - image block request only  */
+#define OTA_IMAGE_PAGE_RSP_SPACING      250     /* ms, not faster than QUEUE_POLL_RATE  */
 #if TOUCHLINK_SUPPORT
 #define ZCL_ZLL_COMMISSIONING_SUPPORT   ON
 #endif
@@ -2,13 +2,33 @@
 #define SRC_INCLUDE_APP_COUNTER_H_
 
 typedef struct _water_conter_t {
-    uint8_t  counter;
-    uint8_t  debounce;
+    uint32_t edge_time;     /* clock_time() of the last edge    */
+    uint8_t  counter;       /* debounced pulses, not yet saved  */
+    uint8_t  level;         /* last seen level                  */
+    uint8_t  stable;        /* debounced level                  */
+    uint8_t  pending;       /* waiting for DEBOUNCE_TIME        */
+    uint8_t  flowing;       /* pulse_tick is recent             */
+    uint32_t pulse_tick;    /* 32k tick of the last pulse       */
+    uint32_t flow;          /* moving estimate, 1/16 l/h        */
+    uint32_t demand;        /* l/h, published                   */
+    uint32_t demand_min;    /* l/h since reset, 0 - none yet    */
+    uint32_t demand_max;
+    uint32_t eval_time;     /* clock_time() of the last update  */
 } water_counter_t;
 
+typedef struct {
+    uint32_t tick;          /* clock_time() of the edge         */
+    uint8_t  channel;
+    uint8_t  level;         /* level after the edge             */
+} counter_edge_t;
+
 void init_counters();
+void init_counters_irq();
 uint8_t counters_handler();
 uint32_t check_counter_overflow(uint32_t check_count);
 uint8_t counters_idle();
+void counters_flush();
+void counters_saved();
+void counters_demandReset(uint8_t endpoint);
 
 #endif /* SRC_INCLUDE_APP_COUNTER_H_ */
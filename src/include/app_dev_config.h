@@ -14,9 +14,18 @@ typedef struct __attribute__((packed)) _watermeter_config_t {
     uint16_t crc;
 } watermeter_config_t;
 
+/* counters increment since the previous record, follows the config in the same page */
+typedef struct __attribute__((packed)) _watermeter_journal_t {
+    uint16_t hot_water;              /* liters of hot water              */
+    uint16_t cold_water;             /* liters of cold water             */
+    uint16_t crc;
+} watermeter_journal_t;
+
 extern watermeter_config_t watermeter_config;
 
 void init_config(uint8_t print);
 void write_config();
+void write_counters();
+uint32_t get_history_addr();
 
 #endif /* SRC_INCLUDE_APP_DEV_CONFIG_H_ */
@@ -42,6 +42,12 @@ typedef struct{
 #endif
     uint8_t  batteryVoltage;      //0x20
     uint8_t  batteryPercentage;   //0x21
+    uint16_t batteryAHrRating;    //0x32, in 10 mAh units
+    uint32_t energyConsumed;      //custom, see app_energy.c, uAh
+    uint16_t energyAverage;       //0.1 uA
+    uint16_t energyRemaining;     //days, 0xffff - unknown
+    uint32_t energyTime[ENERGY_MAX];     //sec in each energy_state_t
+    uint16_t energyCurrent[ENERGY_MAX];  //uA, the model
 }zcl_powerAttr_t;
 
 typedef struct {
@@ -53,6 +59,21 @@ typedef struct {
     uint32_t hot_water_preset;
     uint32_t cold_water_preset;
     uint16_t water_step_preset;
+    uint8_t  poll_state;                    /* poll_state_t                 */
+    uint32_t poll_interval;                 /* ms                           */
+    uint32_t poll_time[POLL_STATE_MAX];     /* sec in each poll_state_t     */
+    uint16_t history_seq;                   /* next Get Profile interval    */
+    uint16_t leak_time;                     /* min of flow for the alarm, 0 - off   */
+    uint16_t leak_gap;                      /* min without pulses ends the flow     */
+    uint8_t  leak_status;                   /* bit per channel, hot - 0, cold - 1   */
+    uint32_t leak_run[FLOWLEAK_CHANNELS];   /* min of the current flow              */
+    uint16_t leak_pause[FLOWLEAK_CHANNELS]; /* min, the longest pause in it         */
+#if DEBUG_BUF_STATS
+    uint8_t  buf_stats[1 + sizeof(ev_buf_stats_t)];
+#endif
+#if DEBUG_PROFILE
+    uint8_t  prof_stats[PROF_MAX][1 + sizeof(prof_entry_t)];
+#endif
 } zcl_watermeterCfgAttr_t;
 
 typedef struct {
@@ -60,6 +81,10 @@ typedef struct {
     uint8_t     unit;                   // 0x07 - Litres
     uint8_t     summationFormatting;    // 0b0100000 - 7bit - 0, 3-6bit - 8, 0-2bit - 0 = 0x40
     uint8_t     deviceType;             // 2 - Water Metering
+    uint8_t     demandFormatting;       // the same as summationFormatting, l/h
+    int32_t     instantaneousDemand;    // l/h, INT24
+    uint32_t    maxDemand;              // l/h since reset, UINT24
+    uint32_t    minDemand;              // l/h since reset, 0 - no flow yet
 } zcl_se_meteringAttr_t;
 
 /**
@@ -109,6 +134,7 @@ extern uint8_t WATERMETER_EP5_CB_CLUSTER_NUM;
 extern zcl_basicAttr_t          g_zcl_basicAttrs;
 extern zcl_identifyAttr_t       g_zcl_identifyAttrs;
 extern zcl_pollCtrlAttr_t       g_zcl_pollCtrlAttrs;
+extern zcl_powerAttr_t          g_zcl_powerAttrs;
 extern zcl_watermeterAttr_t     g_zcl_watermeterAttrs;
 extern zcl_watermeterCfgAttr_t  g_zcl_watermeterCfgAttrs;
 extern zcl_iasZoneAttr_t        g_zcl_iasZoneAttrs;
@@ -0,0 +1,41 @@
+#ifndef SRC_INCLUDE_APP_ENERGY_H_
+#define SRC_INCLUDE_APP_ENERGY_H_
+
+/*
+ * Battery charge estimate - time in each power state multiplied by the current of the state.
+ * Currents are a model of the board, uA, they may be corrected with the attributes.
+ */
+typedef enum {
+    ENERGY_ACTIVE = 0,          /* CPU is awake, radio is off           */
+    ENERGY_RX,                  /* radio in RX or ED                    */
+    ENERGY_TX,
+    ENERGY_SUSPEND,
+    ENERGY_DEEP,                /* deep sleep with RAM retention        */
+    ENERGY_MAX
+} energy_state_t;
+
+#define ENERGY_CAPACITY_DEF     250                     /* 10 mAh, 2 x AA alkaline              */
+#define ENERGY_ACTIVE_DEF       3000                    /* uA, TLSR8258 at 48 MHz               */
+#define ENERGY_RX_DEF           5300
+#define ENERGY_TX_DEF           4800                    /* 0 dBm                                */
+#define ENERGY_SUSPEND_DEF      60
+#define ENERGY_DEEP_DEF         2                       /* 32K retention and the board          */
+#define ENERGY_AVERAGE_MAX      0xFFFE                  /* 0.1 uA                               */
+#define ENERGY_REMAINING_UNKNOWN 0xFFFF
+
+/* custom attributes of the Power Configuration cluster on EP1 */
+#define ZCL_ATTRID_CUSTOM_ENERGY_CONSUMED   0xF000      /* uAh since the battery was replaced   */
+#define ZCL_ATTRID_CUSTOM_ENERGY_AVERAGE    0xF001      /* 0.1 uA, the last day                 */
+#define ZCL_ATTRID_CUSTOM_ENERGY_REMAINING  0xF002      /* days                                 */
+#define ZCL_ATTRID_CUSTOM_ENERGY_TIME       0xF003      /* + energy_state_t, sec                */
+#define ZCL_ATTRID_CUSTOM_ENERGY_CURRENT    0xF010      /* + energy_state_t, uA                 */
+
+void energy_init();
+void energy_handler();
+void energy_sleep();
+void energy_wakeup(uint8_t state);
+void energy_estimate();
+void energy_save();
+void energy_cfgSave();
+
+#endif /* SRC_INCLUDE_APP_ENERGY_H_ */
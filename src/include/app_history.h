@@ -0,0 +1,32 @@
+#ifndef SRC_INCLUDE_APP_HISTORY_H_
+#define SRC_INCLUDE_APP_HISTORY_H_
+
+/*
+ * Hourly consumption log at the end of the USER_DATA region, after the config ring.
+ * The region is the OTA slot of the next image, so the log is lost after an update.
+ * The image must be less than USER_DATA_SIZE - HISTORY_SIZE.
+ */
+#define HISTORY_SECTORS         8
+#define HISTORY_SIZE            (HISTORY_SECTORS * FLASH_SECTOR_SIZE)
+#define HISTORY_INTERVAL        TIMEOUT_1HOUR
+#define HISTORY_PERIOD          1               /* ProfileIntervalPeriod - 60 minutes   */
+
+/* the first record of each sector */
+typedef struct __attribute__((packed)) _history_header_t {
+    uint32_t id;                     /* ID_HISTORY                       */
+    uint16_t seq;                    /* seq of the first record          */
+    uint16_t crc;
+} history_header_t;
+
+typedef struct __attribute__((packed)) _history_record_t {
+    uint16_t hot_water;              /* liters of hot water per interval */
+    uint16_t cold_water;             /* liters of cold water             */
+    uint16_t seq;                    /* interval number                  */
+    uint16_t crc;
+} history_record_t;
+
+void history_init(uint32_t flash_addr);
+void history_preset();
+uint8_t history_getProfile(uint8_t endpoint, zclIncomingAddrInfo_t *pAddrInfo, zcl_metering_getProfileCmd_t *pCmd);
+
+#endif /* SRC_INCLUDE_APP_HISTORY_H_ */
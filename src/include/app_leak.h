@@ -1,8 +1,20 @@
 #ifndef SRC_INCLUDE_APP_LEAK_H_
 #define SRC_INCLUDE_APP_LEAK_H_
 
+#define FLOWLEAK_CHANNELS   2                           /* hot and cold water, as EP1 and EP2 */
+
+typedef struct {
+    uint32_t pulse_tick;    /* 32k tick of the last pulse       */
+    uint32_t run_ms;        /* flow without a pause of leak_gap */
+    uint32_t gap_max_ms;    /* longest pause in the run         */
+    uint8_t  running;
+} flowleak_t;
+
 void waterleak_handler();
 uint8_t waterleak_idle();
 void fillIASAddress(epInfo_t* pdstEpInfo);
+void flowleak_init();
+void flowleak_cfgSave();
+void flowleak_pulse(uint8_t channel);
 
 #endif /* SRC_INCLUDE_APP_LEAK_H_ */
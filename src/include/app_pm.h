@@ -3,6 +3,12 @@
 
 #define CHK_DEEP_SLEEP       DEEP_ANA_REG1
 
+/* bits 3-6 of CHK_DEEP_SLEEP - pulses not yet in flash, see app_counter.c */
+#define CHK_PENDING_MAX      0x03
+#define CHK_PENDING_HOT      3
+#define CHK_PENDING_COLD     5
+#define CHK_PENDING_MASK     ((CHK_PENDING_MAX << CHK_PENDING_HOT) | (CHK_PENDING_MAX << CHK_PENDING_COLD))
+
 #if PM_ENABLE
 
 void app_wakeupPinConfig();
@@ -0,0 +1,31 @@
+#ifndef SRC_INCLUDE_APP_POLL_H_
+#define SRC_INCLUDE_APP_POLL_H_
+
+/* poll interval in use, the highest one wins */
+typedef enum {
+    POLL_STATE_LONG = 0,        /* nothing going on, long_poll              */
+    POLL_STATE_SHORT,           /* some activity, short_poll with backoff   */
+    POLL_STATE_FAST,            /* Poll Control fast poll                   */
+    POLL_STATE_OTA,             /* image download, QUEUE_POLL_RATE          */
+    POLL_STATE_MAX
+} poll_state_t;
+
+/* activity keeping the short poll, see poll_hold[] */
+typedef enum {
+    POLL_SRC_JOIN = 0,          /* joined or rejoined                       */
+    POLL_SRC_FLOW,              /* water pulse                              */
+    POLL_SRC_BUTTON,            /* short press                              */
+    POLL_SRC_OTA,               /* after the download                       */
+    POLL_SRC_RX,                /* data from the parent                     */
+    POLL_SRC_TX,                /* request sent, waiting for the response   */
+    POLL_SRC_MAX
+} poll_src_t;
+
+void poll_init();
+void poll_event(uint8_t src);
+void poll_ota(uint8_t active);
+void poll_fast(uint8_t active);
+void poll_handler();
+void poll_syncCnfHandler(nlme_sync_cnf_t *pSyncCnf);
+
+#endif /* SRC_INCLUDE_APP_POLL_H_ */
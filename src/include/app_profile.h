@@ -0,0 +1,47 @@
+#ifndef SRC_INCLUDE_APP_PROFILE_H_
+#define SRC_INCLUDE_APP_PROFILE_H_
+
+/* awake time by region, only with DEBUG_PROFILE, regions may be nested */
+typedef enum {
+    PROF_AWAKE = 0,             /* from wakeup to drv_pm_lowPowerEnter()    */
+    PROF_STACK,                 /* tl_zbTaskProcedure()                     */
+    PROF_APP_TASK,              /* app_task(), the regions below are in it  */
+    PROF_BUTTON,
+    PROF_COUNTERS,
+    PROF_WATERLEAK,
+    PROF_REPORT,
+    PROF_POLL,
+    PROF_NV_COMPACT,
+    PROF_FLASH,                 /* config, journal and history writes       */
+    PROF_MAX
+} prof_region_t;
+
+/* the ZCL attribute of the region */
+typedef struct __attribute__((packed)) {
+    uint32_t count;
+    uint32_t total_ms;
+    uint32_t max_us;
+} prof_entry_t;
+
+#if DEBUG_PROFILE
+
+#define PROFILE_START(region)   uint32_t prof_start_##region = clock_time()
+#define PROFILE_STOP(region)    profile_add(region, prof_start_##region)
+#define PROFILE_WAKEUP()        profile_wakeup()
+#define PROFILE_SLEEP()         profile_sleep()
+
+void profile_add(uint8_t region, uint32_t start);
+void profile_wakeup();
+void profile_sleep();
+void profile_handler();
+
+#else
+
+#define PROFILE_START(region)
+#define PROFILE_STOP(region)
+#define PROFILE_WAKEUP()
+#define PROFILE_SLEEP()
+
+#endif /* DEBUG_PROFILE */
+
+#endif /* SRC_INCLUDE_APP_PROFILE_H_ */
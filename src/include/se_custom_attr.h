@@ -6,6 +6,29 @@
 #define ZCL_ATTRID_CUSTOM_HOT_WATER_PRESET  0xF000
 #define ZCL_ATTRID_CUSTOM_COLD_WATER_PRESET 0xF001
 #define ZCL_ATTRID_CUSTOM_WATER_STEP_PRESET 0xF002
+/* poll controller, see app_poll.c */
+#define ZCL_ATTRID_CUSTOM_POLL_STATE        0xF003
+#define ZCL_ATTRID_CUSTOM_POLL_INTERVAL     0xF004
+#define ZCL_ATTRID_CUSTOM_POLL_TIME_LONG    0xF005
+#define ZCL_ATTRID_CUSTOM_POLL_TIME_SHORT   0xF006
+#define ZCL_ATTRID_CUSTOM_POLL_TIME_FAST    0xF007
+#define ZCL_ATTRID_CUSTOM_POLL_TIME_OTA     0xF008
+/* seq of the next history interval, see app_history.c */
+#define ZCL_ATTRID_CUSTOM_HISTORY_SEQ       0xF009
+/* continuous flow alarm, see app_leak.c */
+#define ZCL_ATTRID_CUSTOM_LEAK_TIME         0xF020
+#define ZCL_ATTRID_CUSTOM_LEAK_GAP          0xF021
+#define ZCL_ATTRID_CUSTOM_LEAK_STATUS       0xF022
+#define ZCL_ATTRID_CUSTOM_LEAK_RUN_HOT      0xF023
+#define ZCL_ATTRID_CUSTOM_LEAK_RUN_COLD     0xF024
+#define ZCL_ATTRID_CUSTOM_LEAK_PAUSE_HOT    0xF025
+#define ZCL_ATTRID_CUSTOM_LEAK_PAUSE_COLD   0xF026
+/* EP1 and EP2, lowest flow since reset, pair of ZCL_ATTRID_CURRENT_MAX_DEMAND_DELIVERD */
+#define ZCL_ATTRID_CUSTOM_MIN_DEMAND_DELIVERD 0xF010
+/* octet string with ev_buf_stats_t, only with DEBUG_BUF_STATS */
+#define ZCL_ATTRID_CUSTOM_BUF_STATS         0xF0F0
+/* octet string with prof_entry_t, 0xF0F1 + prof_region_t, only with DEBUG_PROFILE */
+#define ZCL_ATTRID_CUSTOM_PROF_STATS        0xF0F1
 
 #endif /* ZCL_METERING_SUPPORT */
 
@@ -37,6 +37,12 @@
  */
 #define NV_ENABLE                               1
 
+/**
+ *  @brief  NVRAM: RAM copy of the NV index, built by nv_init()
+ */
+#define NV_INDEX_CACHE_ENABLE                   1
+#define NV_INDEX_CACHE_ITEM_NUM                 8
+
 /**
  *  @brief  Security
  */
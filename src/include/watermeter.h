@@ -8,6 +8,10 @@
 #include "app_counter.h"
 #include "app_leak.h"
 #include "app_battery.h"
+#include "app_energy.h"
+#include "app_poll.h"
+#include "app_history.h"
+#include "app_profile.h"
 #include "app_reporting.h"
 #include "app_endpoint_cfg.h"
 #include "app_utility.h"
@@ -24,14 +28,16 @@ typedef struct {
     ev_timer_event_t *bdbFBTimerEvt;
     ev_timer_event_t *timerForcedReportEvt;
     ev_timer_event_t *timerStopReportEvt;
-    ev_timer_event_t *timerPollRateEvt;
     ev_timer_event_t *timerBatteryEvt;
     ev_timer_event_t *timerLedEvt;
     ev_timer_event_t *timerNoJoinedEvt;
+    ev_timer_event_t *timerFlushEvt;
+    ev_timer_event_t *timerDebounceEvt;
+    ev_timer_event_t *timerHistoryEvt;
 
     uint32_t short_poll;
     uint32_t long_poll;
-    uint32_t current_poll;
+    uint32_t current_poll;     /* set by poll_handler() */
 
     button_t button;
 
@@ -8,10 +8,12 @@ static uint32_t last_light = 0;
 
 app_ctx_t g_watermeterCtx = {
         .bdbFBTimerEvt = NULL,
-        .timerPollRateEvt = NULL,
         .timerForcedReportEvt = NULL,
         .timerStopReportEvt = NULL,
         .timerNoJoinedEvt = NULL,
+        .timerFlushEvt = NULL,
+        .timerDebounceEvt = NULL,
+        .timerHistoryEvt = NULL,
         .short_poll = POLL_RATE * 3,
         .long_poll = POLL_RATE * LONG_POLL,
         .oriSta = false,
@@ -41,7 +43,7 @@ const zdo_appIndCb_t appCbLst = {
     app_leaveCnfHandler,//leave cnf cb
     NULL,//nwk update ind cb
     NULL,//permit join ind cb
-    NULL,//nlme sync cnf cb
+    poll_syncCnfHandler,//nlme sync cnf cb
     NULL,//tc join ind cb
     NULL,//tc detects that the frame counter is near limit
 };
@@ -103,6 +105,9 @@ bdb_commissionSetting_t g_bdbCommissionSetting = {
  */
 void stack_init(void)
 {
+    /* Build the NV index cache before the stack reads its tables */
+    nv_init(0);
+
     /* Initialize ZB stack */
     zb_init();
 
@@ -155,7 +160,11 @@ void user_app_init(void)
 
     init_config(true);
     init_counters();
+    history_init(get_history_addr());
     init_button();
+    poll_init();
+    flowleak_init();
+    energy_init();
 
     batteryCb(NULL);
     g_watermeterCtx.timerBatteryEvt = TL_ZB_TIMER_SCHEDULE(batteryCb, NULL, BATTERY_TIMER_INTERVAL);
@@ -174,10 +183,25 @@ void user_app_init(void)
 
 void app_task(void) {
 
+    PROFILE_START(PROF_APP_TASK);
+
+    PROFILE_START(PROF_BUTTON);
     button_handler();
+    PROFILE_STOP(PROF_BUTTON);
+
+    PROFILE_START(PROF_COUNTERS);
     counters_handler();
+    PROFILE_STOP(PROF_COUNTERS);
+
+    PROFILE_START(PROF_WATERLEAK);
     waterleak_handler();
+    PROFILE_STOP(PROF_WATERLEAK);
 
+#if DEBUG_BUF_STATS
+    /* no read callback in ZCL, keep the attribute up to date */
+    g_zcl_watermeterCfgAttrs.buf_stats[0] = sizeof(ev_buf_stats_t);
+    memcpy(g_zcl_watermeterCfgAttrs.buf_stats + 1, ev_buf_statsGet(), sizeof(ev_buf_stats_t));
+#endif
 
     if(bdb_isIdle()) {
         if (clock_time_exceed(last_light, TIMEOUT_TICK_5SEC)) {
@@ -191,18 +215,41 @@ void app_task(void) {
             }
             last_light = clock_time();
         }
+
+        PROFILE_START(PROF_REPORT);
         app_report_handler();
-#if PM_ENABLE
-        if(!button_idle() && !counters_idle() && !waterleak_idle()) {
-            app_lowPowerEnter();
-        }
+        PROFILE_STOP(PROF_REPORT);
+
+        PROFILE_START(PROF_POLL);
+        poll_handler();
+        PROFILE_STOP(PROF_POLL);
+
+        /* NV sector update, one step per pass */
+        PROFILE_START(PROF_NV_COMPACT);
+        nv_compactStep();
+        PROFILE_STOP(PROF_NV_COMPACT);
+    }
+
+    energy_handler();
+
+#if DEBUG_PROFILE
+    profile_handler();
 #endif
+
+    /* the sleep is not a part of app_task */
+    PROFILE_STOP(PROF_APP_TASK);
+
+#if PM_ENABLE
+    if(bdb_isIdle() && !button_idle() && !counters_idle() && !waterleak_idle() && !nv_compactBusy()) {
+        app_lowPowerEnter();
     }
+#endif
 }
 
 static void watermeterSysException(void)
 {
 #if 1
+    counters_flush();
     SYSTEM_RESET();
 #else
     light_on();
@@ -221,6 +268,8 @@ static void watermeterSysException(void)
  */
 void user_init(bool isRetention)
 {
+    PROFILE_WAKEUP();
+
 #if UART_PRINTF_MODE
 //    printf("[%d] isRetention: %s\r\n", count_restart++, isRetention?"true":"false");
 #endif /* UART_PRINTF_MODE */
@@ -283,9 +332,14 @@ void user_init(bool isRetention)
         bdb_init((af_simple_descriptor_t *)&watermeter_ep1Desc, &g_bdbCommissionSetting, &g_zbBdbCb, repower);
 
     }else{
+        /* the sleep is over, the time from the 32k timer */
+        energy_wakeup(ENERGY_DEEP);
+
         /* Re-config phy when system recovery from deep sleep with retention */
         mac_phyReconfig();
 
+        /* Restore counters gpio irq */
+        init_counters_irq();
     }
 }
 
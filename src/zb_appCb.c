@@ -122,11 +122,7 @@ void zb_bdbInitCb(uint8_t status, uint8_t joinedNetwork) {
          *
          */
         if (joinedNetwork) {
-            zb_setPollRate(g_watermeterCtx.short_poll);
-            if (g_watermeterCtx.timerPollRateEvt) {
-                TL_ZB_TIMER_CANCEL(&g_watermeterCtx.timerPollRateEvt);
-            }
-            g_watermeterCtx.timerPollRateEvt = TL_ZB_TIMER_SCHEDULE(poll_rateAppCb, NULL, TIMEOUT_30SEC);
+            poll_event(POLL_SRC_JOIN);
 
             if (g_watermeterCtx.timerStopReportEvt) {
                 TL_ZB_TIMER_CANCEL(&g_watermeterCtx.timerStopReportEvt);
@@ -212,11 +208,7 @@ void zb_bdbCommissioningCb(uint8_t status, void *arg) {
         case BDB_COMMISSION_STA_SUCCESS:
             light_blink_start(2, 200, 200);
 
-            zb_setPollRate(g_watermeterCtx.short_poll);
-            if (g_watermeterCtx.timerPollRateEvt) {
-                TL_ZB_TIMER_CANCEL(&g_watermeterCtx.timerPollRateEvt);
-            }
-            g_watermeterCtx.timerPollRateEvt = TL_ZB_TIMER_SCHEDULE(poll_rateAppCb, NULL, TIMEOUT_30SEC);
+            poll_event(POLL_SRC_JOIN);
 
             if (g_watermeterCtx.timerNoJoinedEvt) {
                 TL_ZB_TIMER_CANCEL(&g_watermeterCtx.timerNoJoinedEvt);
@@ -333,23 +325,8 @@ void zb_bdbFindBindSuccessCb(findBindDst_t *pDstInfo) {
 
 #ifdef ZCL_OTA
 
-extern ota_clientInfo_t otaClientInfo;
 void ota_upgradeComplete(u8 status);
 
-static void app_ota_abort() {
-
-    /* reset update OTA */
-    nv_resetModule(NV_MODULE_OTA);
-
-    memset((uint8_t*) &otaClientInfo, 0, sizeof(otaClientInfo));
-    otaClientInfo.clientOtaFlg = OTA_FLAG_INIT_DONE;
-    otaClientInfo.crcValue = 0xffffffff;
-
-    zcl_attr_imageTypeID = 0xffff;
-    zcl_attr_fileOffset = 0xffffffff;
-    zcl_attr_downloadFileVer = 0xffffffff;
-}
-
 void app_otaProcessMsgHandler(uint8_t evt, uint8_t status) {
     //printf("app_otaProcessMsgHandler: status = %x\r\n", status);
     if (evt == OTA_EVT_START) {
@@ -362,7 +339,7 @@ void app_otaProcessMsgHandler(uint8_t evt, uint8_t status) {
         printf("Battery charge less than 50%%, OTA update abort.\r\n");
 #endif /* UART_PRINTF_MODE */
 
-        app_ota_abort();
+        /* the download is resumed from the checkpoint later */
         ota_upgradeComplete(ZCL_STA_ABORT);
         return;
     }
@@ -377,23 +354,14 @@ void app_otaProcessMsgHandler(uint8_t evt, uint8_t status) {
             watermeter_config.new_ota = true;
             write_config();
 
-            if (g_watermeterCtx.timerPollRateEvt) {
-                TL_ZB_TIMER_CANCEL(&g_watermeterCtx.timerPollRateEvt);
-            }
-
-            zb_setPollRate(QUEUE_POLL_RATE);
+            poll_ota(true);
 
         } else {
 
         }
     } else if (evt == OTA_EVT_COMPLETE) {
 
-//        zb_setPollRate(POLL_RATE * 3);
-        zb_setPollRate(g_watermeterCtx.short_poll);
-        if (g_watermeterCtx.timerPollRateEvt) {
-            TL_ZB_TIMER_CANCEL(&g_watermeterCtx.timerPollRateEvt);
-        }
-        g_watermeterCtx.timerPollRateEvt = TL_ZB_TIMER_SCHEDULE(poll_rateAppCb, NULL, TIMEOUT_2MIN);
+        poll_ota(false);
 
         if (status == ZCL_STA_SUCCESS) {
 
@@ -401,6 +369,7 @@ void app_otaProcessMsgHandler(uint8_t evt, uint8_t status) {
             printf("OTA update successful.\r\n");
 #endif /* UART_PRINTF_MODE */
 
+            counters_flush();
             set_regDeepSleep();
             ota_mcuReboot();
 
@@ -410,10 +379,17 @@ void app_otaProcessMsgHandler(uint8_t evt, uint8_t status) {
             printf("OTA update failure. Try again.\r\n");
 #endif /* UART_PRINTF_MODE */
 
-            app_ota_abort();
+            /* OTA keeps the checkpoint of the download, it is reset only for invalid image */
 
-            /* restore config */
-            if (watermeter_config.new_ota) init_config(false);
+            if (watermeter_config.new_ota) {
+                /* config is in NV while new_ota is set */
+                counters_flush();
+                /* the slot keeps the partial image until the download is resumed,
+                 * restoring the config there drops the checkpoint */
+                if (!ota_clientInfoResumable()) {
+                    init_config(false);
+                }
+            }
 
             ota_queryStart(OTA_PERIODIC_QUERY_INTERVAL);
         }
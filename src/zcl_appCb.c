@@ -177,6 +177,7 @@ static void app_zclWriteReqCmd(uint8_t endPoint, uint16_t clusterId, zclWriteCmd
     if (clusterId == ZCL_CLUSTER_SE_METERING && endPoint == WATERMETER_ENDPOINT3) {
         uint32_t water_value;
         uint64_t water_counter;
+        uint8_t save_config = false;
         for(uint8_t i = 0; i < numAttr; i++) {
             //printf("(%d) attrID: 0x%x\r\n", i, attr->attrID);
             if (attr[i].attrID == ZCL_ATTRID_CUSTOM_HOT_WATER_PRESET && attr[i].dataType == ZCL_DATA_TYPE_UINT32) {
@@ -192,6 +193,7 @@ static void app_zclWriteReqCmd(uint8_t endPoint, uint16_t clusterId, zclWriteCmd
 #if UART_PRINTF_MODE
                 printf("New hot water value: %d\r\n", watermeter_config.counter_hot_water);
 #endif
+                save_config = true;
 //                return;
             } else if (attr[i].attrID == ZCL_ATTRID_CUSTOM_COLD_WATER_PRESET && attr[i].dataType == ZCL_DATA_TYPE_UINT32) {
 
@@ -207,6 +209,7 @@ static void app_zclWriteReqCmd(uint8_t endPoint, uint16_t clusterId, zclWriteCmd
 #if UART_PRINTF_MODE
                 printf("New cold water value: %d\r\n", watermeter_config.counter_cold_water);
 #endif
+                save_config = true;
 //                return;
             } else if (attr[i].attrID == ZCL_ATTRID_CUSTOM_WATER_STEP_PRESET && attr[i].dataType == ZCL_DATA_TYPE_UINT16) {
 
@@ -223,7 +226,36 @@ static void app_zclWriteReqCmd(uint8_t endPoint, uint16_t clusterId, zclWriteCmd
 #if UART_PRINTF_MODE
                 printf("New water step value: %d\r\n", watermeter_config.liters_per_pulse);
 #endif
+                save_config = true;
 //                return;
+            } else if (attr[i].attrID == ZCL_ATTRID_CUSTOM_LEAK_TIME || attr[i].attrID == ZCL_ATTRID_CUSTOM_LEAK_GAP) {
+                flowleak_cfgSave();
+            }
+        }
+
+        /* the counters journal holds only increments, new values need a full config */
+        if (save_config) {
+            history_preset();
+            write_config();
+        }
+    }
+
+    /* any write of the max or min demand resets both */
+    if (clusterId == ZCL_CLUSTER_SE_METERING && (endPoint == WATERMETER_ENDPOINT1 || endPoint == WATERMETER_ENDPOINT2)) {
+        for (uint8_t i = 0; i < numAttr; i++) {
+            if (attr[i].attrID == ZCL_ATTRID_CURRENT_MAX_DEMAND_DELIVERD || attr[i].attrID == ZCL_ATTRID_CUSTOM_MIN_DEMAND_DELIVERD) {
+                counters_demandReset(endPoint);
+                break;
+            }
+        }
+    }
+
+    if (clusterId == ZCL_CLUSTER_GEN_POWER_CFG && endPoint == WATERMETER_ENDPOINT1) {
+        for (uint8_t i = 0; i < numAttr; i++) {
+            if (attr[i].attrID == ZCL_ATTRID_BATTERY_A_HR_RATING || attr[i].attrID == ZCL_ATTRID_CUSTOM_ENERGY_CONSUMED ||
+                    (attr[i].attrID >= ZCL_ATTRID_CUSTOM_ENERGY_CURRENT && attr[i].attrID < ZCL_ATTRID_CUSTOM_ENERGY_CURRENT + ENERGY_MAX)) {
+                energy_cfgSave();
+                break;
             }
         }
     }
@@ -855,6 +887,7 @@ void app_zclCheckInCmdSend(void)
 	dstEpInfo.profileId = HA_PROFILE_ID;
 
 	zcl_pollCtrl_checkInCmd(WATERMETER_ENDPOINT, &dstEpInfo, TRUE);
+	poll_event(POLL_SRC_TX);
 }
 
 int32_t app_zclCheckInTimerCb(void *arg)
@@ -888,12 +921,9 @@ void app_zclCheckInStart(void)
 
 void app_zclSetFastPollMode(bool fastPollMode)
 {
-	zcl_pollCtrlAttr_t *pPollCtrlAttr = zcl_pollCtrlAttrGet();
-
 	isFastPollMode = fastPollMode;
-	uint32_t pollRate = fastPollMode ? pPollCtrlAttr->shortPollInterval : pPollCtrlAttr->longPollInterval;
-
-	zb_setPollRate(pollRate  * POLL_RATE_QUARTERSECONDS);
+	//the interval is applied by poll_handler()
+	poll_fast(fastPollMode);
 }
 
 int32_t app_zclFastPollTimeoutCb(void *arg)
@@ -957,7 +987,7 @@ static status_t app_zclPollCtrlSetLongPollIntervalCmdHandler(zcl_setLongPollInte
 	if((pCmd->newLongPollInterval >= 0x04) && (pCmd->newLongPollInterval <= 0x6E0000)
 		&& (pCmd->newLongPollInterval <= pPollCtrlAttr->chkInInterval) && (pCmd->newLongPollInterval >= pPollCtrlAttr->shortPollInterval)){
 		pPollCtrlAttr->longPollInterval = pCmd->newLongPollInterval;
-		zb_setPollRate(pCmd->newLongPollInterval * POLL_RATE_QUARTERSECONDS);
+		g_watermeterCtx.long_poll = pCmd->newLongPollInterval * POLL_RATE_QUARTERSECONDS;
 	}else{
 		return ZCL_STA_INVALID_VALUE;
 	}
@@ -972,7 +1002,6 @@ static status_t app_zclPollCtrlSetShortPollIntervalCmdHandler(zcl_setShortPollIn
 	if((pCmd->newShortPollInterval >= 0x01) && (pCmd->newShortPollInterval <= 0xff)
 		&& (pCmd->newShortPollInterval <= pPollCtrlAttr->longPollInterval)){
 		pPollCtrlAttr->shortPollInterval = pCmd->newShortPollInterval;
-		zb_setPollRate(pCmd->newShortPollInterval * POLL_RATE_QUARTERSECONDS);
 	}else{
 		return ZCL_STA_INVALID_VALUE;
 	}
@@ -1023,7 +1052,8 @@ status_t app_pollCtrlCb(zclIncomingAddrInfo_t *pAddrInfo, uint8_t cmdId, void *c
 /*********************************************************************
  * @fn      app_meteringCb
  *
- * @brief   Handler for ZCL Identify command.
+ * @brief   Handler for ZCL Metering command. Get Profile on EP1 and EP2
+ *          returns the consumption history.
  *
  * @param   pAddrInfo
  * @param   cmdId
@@ -1033,6 +1063,12 @@ status_t app_pollCtrlCb(zclIncomingAddrInfo_t *pAddrInfo, uint8_t cmdId, void *c
  */
 status_t app_meteringCb(zclIncomingAddrInfo_t *pAddrInfo, uint8_t cmdId, void *cmdPayload)
 {
+	if (pAddrInfo->dirCluster == ZCL_FRAME_CLIENT_SERVER_DIR && cmdId == ZCL_CMD_GET_PROFILE) {
+		if (pAddrInfo->dstEp == WATERMETER_ENDPOINT1 || pAddrInfo->dstEp == WATERMETER_ENDPOINT2) {
+			return history_getProfile(pAddrInfo->dstEp, pAddrInfo, (zcl_metering_getProfileCmd_t *)cmdPayload);
+		}
+		return ZCL_STA_UNSUP_CLUSTER_COMMAND;
+	}
 
     return ZCL_STA_SUCCESS;
 }
@@ -0,0 +1,82 @@
+/*
+ * Boot recovery of the config ring, init_config() at the ring positions from
+ * the first page to a wrapped ring. Prints the flash reads and the crc bytes
+ * of each recovery, a broken page shows the cost of the fallback scan.
+ */
+#include "tl_common.h"
+#include "zcl_include.h"
+
+#include "watermeter.h"
+
+#include "hal.h"
+
+#define BENCH_PAGES             ((END_USER_DATA2 - BEGIN_USER_DATA2 - HISTORY_SIZE) / FLASH_PAGE_SIZE)
+#define BENCH_READS_MAX         12                  /* log2(BENCH_PAGES), the first page and the journal */
+
+static u32 bench_reads = 0;                         /* of the config ring */
+static u32 bench_crc_bytes = 0;
+
+void __real_flash_read_page(unsigned long addr, unsigned long len, unsigned char *buf);
+
+void __wrap_flash_read_page(unsigned long addr, unsigned long len, unsigned char *buf) {
+
+    if (addr >= BEGIN_USER_DATA2 && addr < END_USER_DATA2) bench_reads++;
+
+    __real_flash_read_page(addr, len, buf);
+}
+
+unsigned short __real_xcrc16(const unsigned char *buf, int len, unsigned short init);
+
+unsigned short __wrap_xcrc16(const unsigned char *buf, int len, unsigned short init) {
+
+    bench_crc_bytes += len;
+
+    return __real_xcrc16(buf, len, init);
+}
+
+/* a restart, only the flash is kept */
+static void bench_recover(u32 pos, u32 top, u32 addr, u32 reads_max) {
+    u32 reads, crc_bytes;
+
+    memset(&watermeter_config, 0, sizeof(watermeter_config));
+    reads = bench_reads;
+    crc_bytes = bench_crc_bytes;
+
+    init_config(0);
+
+    reads = bench_reads - reads;
+    crc_bytes = bench_crc_bytes - crc_bytes;
+
+    hal_printf("position %4d: %2d reads, %4d crc bytes\r\n", pos, reads, crc_bytes);
+
+    HAL_CHECK_EQ(watermeter_config.top, top);
+    HAL_CHECK_EQ(watermeter_config.flash_addr_start, addr);
+    HAL_CHECK(reads <= reads_max);
+}
+
+int main() {
+    static const u32 pos[] = { 0, 1, 2, 100, BENCH_PAGES / 2, BENCH_PAGES - 2, BENCH_PAGES - 1,
+                               BENCH_PAGES, BENCH_PAGES + 1, BENCH_PAGES + 300 };
+    u32 top, addr, n = 0;
+
+    hal_init(NULL, 1);
+    hal_flash_boot(0);
+    nv_init(0);
+
+    init_config(0);
+    top = watermeter_config.top;
+
+    for (u8 i = 0; i < sizeof(pos) / sizeof(pos[0]); i++) {
+        for (; n < pos[i]; n++) {
+            write_config();
+        }
+        bench_recover(pos[i], top + n, BEGIN_USER_DATA2 + (n % BENCH_PAGES) * FLASH_PAGE_SIZE, BENCH_READS_MAX);
+    }
+
+    /* a flipped bit on the page read first, the fallback scan from the first page */
+    addr = watermeter_config.flash_addr_start;
+    hal_flash[BEGIN_USER_DATA2 + (BENCH_PAGES / 2) * FLASH_PAGE_SIZE + 8] ^= 0x01;
+    bench_recover(n, top + n, addr, BENCH_PAGES);
+
+    return hal_result("bench_config");
+}
@@ -0,0 +1,187 @@
+/*
+ * The RAM index cache of drv_nv.c. After each write and compaction step the
+ * cache kept by the writes must be the one built from flash. Prints the flash
+ * reads and the cycles of nv_init() and of an item read, with the cache and
+ * with the index searched in flash as before. drv_nv.c is included to reach
+ * the cache.
+ */
+#include "../tl_zigbee_sdk/proj/drivers/drv_nv.c"
+#include "zb_api.h"
+
+#include "hal.h"
+
+#define NV_BENCH_ROUNDS         40
+#define NV_BENCH_READS          200
+
+typedef struct {
+    u8  module;
+    u8  items;
+    u16 len;
+} nv_benchModule_t;
+
+/* about what the stack and the app keep after the join */
+static const nv_benchModule_t nv_benchModules[] = {
+    { NV_MODULE_ZB_INFO,   4, 60 },
+    { NV_MODULE_APS,       2, 40 },
+    { NV_MODULE_ZCL,       6, 24 },
+    { NV_MODULE_APP,       5, 48 },
+};
+
+#define NV_BENCH_MODULES        (sizeof(nv_benchModules) / sizeof(nv_benchModules[0]))
+
+static u32 nv_benchReads = 0;
+static u32 nv_cacheChecks = 0;
+static u32 nv_cacheErrs = 0;
+
+void __real_flash_read_page(unsigned long addr, unsigned long len, unsigned char *buf);
+
+void __wrap_flash_read_page(unsigned long addr, unsigned long len, unsigned char *buf) {
+
+    nv_benchReads++;
+
+    __real_flash_read_page(addr, len, buf);
+}
+
+static void nv_fill(u8 *buf, u8 module, u8 item, u32 ver, u16 len) {
+
+    for (u16 i = 0; i < len; i++) buf[i] = (u8)(ver * 31 + i * 7 + item + module);
+}
+
+/* the cache kept by the writes against a fresh build from flash */
+static void nv_cacheCheck() {
+    nv_idxCache_t old, *c;
+    nv_idxCacheItem_t *item;
+    u8 bad;
+
+    for (u16 id = 0; id < NV_MAX_MODULS; id++) {
+        old = g_nvIdxCache[id];
+        if (!old.valid) continue;
+
+        nv_cacheChecks++;
+        nv_idxCacheBuild(id, &old.sectInfo);
+        c = &g_nvIdxCache[id];
+
+        bad = c->lastIdx != old.lastIdx;
+        for (u8 i = 0; i < c->itemNum; i++) {
+            item = nv_idxCacheItemFind(&old, c->item[i].itemId);
+            if (!item) {
+                if (!old.overflow) bad = 1;
+                continue;
+            }
+            /* unknown falls back to the flash */
+            if (item->idx != NV_INDEX_CACHE_IDX_UNKNOWN &&
+                (item->idx != c->item[i].idx || item->size != c->item[i].size)) bad = 1;
+        }
+        for (u8 i = 0; i < old.itemNum; i++) {
+            if (old.item[i].idx != NV_INDEX_CACHE_IDX_UNKNOWN && !nv_idxCacheItemFind(c, old.item[i].itemId)) bad = 1;
+        }
+
+        if (bad) {
+            nv_cacheErrs++;
+            hal_printf("module %d: the cache differs from the flash, last index %d, %d in flash\r\n",
+                    id, old.lastIdx, c->lastIdx);
+        }
+
+        g_nvIdxCache[id] = old;
+    }
+}
+
+/* the items written round by round, the compaction in the idle passes */
+static void nv_workload() {
+    const nv_benchModule_t *m;
+    u8 buf[64];
+
+    for (u32 ver = 1; ver <= NV_BENCH_ROUNDS; ver++) {
+        for (u8 n = 0; n < NV_BENCH_MODULES; n++) {
+            m = &nv_benchModules[n];
+            for (u8 item = 0; item < m->items; item++) {
+                /* the first items change more often */
+                if (item && ver % (item + 1)) continue;
+
+                nv_fill(buf, m->module, item, ver, m->len);
+                HAL_CHECK_EQ(nv_flashWriteNew(1, m->module, 0x10 + item, m->len, buf), NV_SUCC);
+                nv_cacheCheck();
+            }
+        }
+
+        while (nv_compactStep()) nv_cacheCheck();
+    }
+}
+
+/* the RAM is lost, the flash is kept */
+static void nv_restart() {
+
+    memset(&g_nvCompact, 0, sizeof(g_nvCompact));
+    memset(g_nvIdxCache, 0, sizeof(g_nvIdxCache));
+    nv_init(0);
+}
+
+static void nv_benchInit() {
+    unsigned long long t;
+    u32 reads;
+
+    reads = nv_benchReads;
+    t = __builtin_ia32_rdtsc();
+    nv_restart();
+    t = __builtin_ia32_rdtsc() - t;
+
+    hal_printf("nv_init(): %d flash reads, %d kcycles\r\n", nv_benchReads - reads, (u32)(t / 1000));
+}
+
+/* all the items, the last version of each, returns the flash reads per item */
+static u32 nv_benchRead(const char *name) {
+    const nv_benchModule_t *m;
+    unsigned long long t, cycles = 0;
+    u32 reads = 0, n = 0;
+    u8 buf[64], expected[64];
+
+    for (u32 r = 0; r < NV_BENCH_READS; r++) {
+        for (u8 i = 0; i < NV_BENCH_MODULES; i++) {
+            m = &nv_benchModules[i];
+            for (u8 item = 0; item < m->items; item++) {
+                reads -= nv_benchReads;
+                t = __builtin_ia32_rdtsc();
+                HAL_CHECK_EQ(nv_flashReadNew(1, m->module, 0x10 + item, m->len, buf), NV_SUCC);
+                cycles += __builtin_ia32_rdtsc() - t;
+                reads += nv_benchReads;
+                n++;
+
+                if (!r) {
+                    nv_fill(expected, m->module, item, NV_BENCH_ROUNDS - NV_BENCH_ROUNDS % (item + 1), m->len);
+                    HAL_CHECK(!memcmp(buf, expected, m->len));
+                }
+            }
+        }
+    }
+
+    hal_printf("item read, %s: %d flash reads, %d cycles\r\n", name, reads / n, (u32)(cycles / n));
+
+    return reads / n;
+}
+
+int main() {
+    u32 cached;
+
+    hal_init(NULL, 1);
+    os_init(0);
+
+    hal_flash_erase_all();
+    nv_restart();
+    nv_workload();
+
+    hal_printf("%d cache checks, %d mismatches\r\n", nv_cacheChecks, nv_cacheErrs);
+    HAL_CHECK(nv_cacheChecks > 0);
+    HAL_CHECK_EQ(nv_cacheErrs, 0);
+
+    nv_benchInit();
+    cached = nv_benchRead("cached  ");
+
+    /* nothing cached, each read searches the index in flash */
+    for (u16 id = 0; id < NV_MAX_MODULS; id++) {
+        g_nvIdxCache[id].itemNum = 0;
+        g_nvIdxCache[id].overflow = 1;
+    }
+    HAL_CHECK(nv_benchRead("in flash") > cached);
+
+    return hal_result("bench_nv_idx");
+}
@@ -0,0 +1,80 @@
+#ifndef TEST_HAL_HAL_H_
+#define TEST_HAL_HAL_H_
+
+/*
+ * Host stand-ins of the TLSR8258 drivers and of the prebuilt stack libraries.
+ *
+ * The real sources are built for the host with the SDK headers. The register
+ * space is RAM mapped at REG_BASE_ADDR, so the inline register access of the
+ * SDK works and clock_time() is the virtual time of the harness. Everything
+ * of libzb_ed.a and libdrivers_8258.a the sources call is a weak function in
+ * hal_stack.c, hal_os.c or hal_drv.c, a test links the real module where
+ * there is one.
+ *
+ * The SDK has its own size_t and string.h, so this header has no libc or SDK
+ * types, it is included by both sides.
+ */
+
+#define HAL_FLASH_SIZE          0x80000             /* 512K, as on the board        */
+#define HAL_ANALOG_SIZE         0x100
+#define HAL_LOOP_US             1000                /* main loop pass while awake   */
+
+/* the SDK prints nothing without UART_PRINTF_MODE */
+int hal_printf(const char *fmt, ...);
+
+/* registers, flash in a file if flash_file is not NULL, analog registers after it */
+void hal_init(const char *flash_file, int power_on);
+void hal_exit();
+
+/* time */
+extern unsigned long long hal_now_us;               /* since the power on           */
+/* the app does not sleep beyond, the next event of the scenario */
+extern unsigned long long hal_wake_us;
+
+void hal_time_set(unsigned long long us);
+void hal_advance_us(unsigned int us);
+
+/* flash, erased is 0xff and a write only clears bits, as NOR */
+extern unsigned char *hal_flash;
+extern unsigned char *hal_analog;
+extern unsigned int hal_flash_writes;               /* flash_write_page() calls     */
+extern unsigned int hal_flash_erases;
+extern unsigned int hal_flash_ops;                  /* writes and erases            */
+
+void hal_flash_erase_all();
+void hal_flash_boot(unsigned int addr);             /* an image at addr, 0 or 0x40000   */
+/* power cut inside the n-th write or erase from now, 0 - off */
+void hal_flash_cut(unsigned int n, void **env);     /* __builtin_setjmp() buffer    */
+
+/* gpio, the inputs are pulled up */
+void hal_gpio_set(unsigned int pin, unsigned char level);
+unsigned char hal_gpio_get(unsigned int pin);
+void hal_gpio_reset();
+
+/* stack */
+extern unsigned char  hal_joined;
+extern unsigned char  hal_bound;                    /* the binding table is not empty   */
+extern unsigned int   hal_poll_rate;                /* ms, of the last zb_setPollRate() */
+extern unsigned int   hal_poll_changes;
+extern unsigned int   hal_polls;                    /* data requests to the parent      */
+extern unsigned int   hal_rx_pending;               /* frames the parent keeps for us   */
+extern unsigned char  hal_parent;                   /* the parent answers the polls     */
+extern unsigned short hal_adc_mv;
+extern unsigned int   hal_rf_time[];                /* us by rf_state_e, since read     */
+extern unsigned int   hal_tx_frames;                /* af_dataSend() calls              */
+
+void hal_task_run();                                /* TL_SCHEDULE_TASK() queue         */
+
+/* checks */
+extern int hal_fails;
+
+#define HAL_CHECK(cond)     do { if (!(cond)) { hal_fail(__FILE__, __LINE__, #cond); } } while (0)
+#define HAL_CHECK_EQ(a, b)  do { long long _a = (long long)(a), _b = (long long)(b); \
+                                 if (_a != _b) { hal_fail_eq(__FILE__, __LINE__, #a, _a, _b); } } while (0)
+
+void hal_fail(const char *file, int line, const char *cond);
+void hal_fail_eq(const char *file, int line, const char *expr, long long val, long long expected);
+/* prints the result, the exit code of the test */
+int hal_result(const char *name);
+
+#endif /* TEST_HAL_HAL_H_ */
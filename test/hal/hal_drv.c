@@ -0,0 +1,364 @@
+/* stand-ins of libdrivers_8258.a and of the board, the virtual time */
+#include "tl_common.h"
+#include "zcl_include.h"
+
+#include "hal.h"
+
+#define HAL_WEAK            __attribute__((weak))
+#define HAL_PINS_MAX        16
+#define HAL_START_UP_FLAG   0x544c4e4b              /* TL_START_UP_FLAG_WHOLE of ota.c  */
+
+typedef struct {
+    u32          pin;
+    u8           level;
+} hal_pin_t;
+
+typedef struct {
+    u32          pin;
+    irq_callback cb;
+    u8           polarity;
+    u8           en;
+    u8           pending;
+} hal_irq_t;
+
+unsigned long long hal_now_us = 0;
+unsigned long long hal_wake_us = ~0ULL;
+
+unsigned int hal_flash_writes = 0;
+unsigned int hal_flash_erases = 0;
+unsigned int hal_flash_ops = 0;
+
+static u32 hal_cut_op = 0;
+static void **hal_cut_env = NULL;
+static u32 hal_rand = 1;
+
+static hal_pin_t hal_pins[HAL_PINS_MAX];
+static u8 hal_pins_num = 0;
+static hal_irq_t hal_irq[GPIO_IRQ_RISC1_MODE + 1];
+static u8 hal_irq_en = 1;
+
+/**********************************************************************
+ * time
+ */
+
+static void hal_tick_update() {
+
+    reg_system_tick = (u32)(hal_now_us * sys_tick_per_us);
+}
+
+void hal_time_set(unsigned long long us) {
+
+    hal_now_us = us;
+    hal_tick_update();
+}
+
+void hal_advance_us(unsigned int us) {
+
+    hal_now_us += us;
+    hal_tick_update();
+}
+
+HAL_WEAK unsigned int pm_get_32k_tick(void) {
+
+    return (u32)(hal_now_us * tick_32k_tick_per_ms / 1000);
+}
+
+HAL_WEAK void sleep_us(unsigned long us) {
+
+    hal_advance_us(us);
+}
+
+/**********************************************************************
+ * flash
+ */
+
+void hal_flash_cut(unsigned int n, void **env) {
+
+    hal_cut_op = n ? hal_flash_ops + n : 0;
+    hal_cut_env = env;
+}
+
+static u32 hal_rand_get() {
+
+    hal_rand = hal_rand * 1103515245 + 12345;
+    return hal_rand >> 8;
+}
+
+/* the cut op is done in part, as the power fails in the middle of it */
+static u8 hal_flash_op(u32 addr, u32 len) {
+
+    if (addr + len > HAL_FLASH_SIZE) {
+        hal_printf("flash access out of range 0x%x, %d\r\n", addr, len);
+        hal_fails++;
+        return 0;
+    }
+
+    hal_flash_ops++;
+
+    return hal_cut_op && hal_flash_ops == hal_cut_op;
+}
+
+static void hal_flash_cut_now() {
+
+    hal_cut_op = 0;
+    __builtin_longjmp(hal_cut_env, 1);
+}
+
+/* only the startup flag of the image matters to the sources */
+void hal_flash_boot(unsigned int addr) {
+    u32 flag = HAL_START_UP_FLAG;
+
+    memcpy(hal_flash + addr + FLASH_TLNK_FLAG_OFFSET, &flag, sizeof(flag));
+}
+
+HAL_WEAK void flash_read_page(unsigned long addr, unsigned long len, unsigned char *buf) {
+
+    if (addr + len > HAL_FLASH_SIZE) {
+        hal_printf("flash read out of range 0x%x, %d\r\n", (u32)addr, (u32)len);
+        hal_fails++;
+        return;
+    }
+
+    for (u32 i = 0; i < len; i++) {
+        buf[i] = hal_flash[addr + i];
+    }
+}
+
+HAL_WEAK void flash_write_page(unsigned long addr, unsigned long len, unsigned char *buf) {
+    u8 cut = hal_flash_op(addr, len);
+    u32 n = cut ? hal_rand_get() % (len + 1) : len;
+
+    hal_flash_writes++;
+
+    if (addr + len > HAL_FLASH_SIZE) return;
+
+    for (u32 i = 0; i < n; i++) {
+        hal_flash[addr + i] &= buf[i];
+    }
+
+    if (cut) hal_flash_cut_now();
+}
+
+HAL_WEAK void flash_erase_sector(unsigned long addr) {
+    u8 cut;
+
+    addr &= ~(FLASH_SECTOR_SIZE - 1);
+    cut = hal_flash_op(addr, FLASH_SECTOR_SIZE);
+
+    hal_flash_erases++;
+
+    if (addr + FLASH_SECTOR_SIZE > HAL_FLASH_SIZE) return;
+
+    for (u32 i = 0; i < (cut ? FLASH_SECTOR_SIZE / 2 : FLASH_SECTOR_SIZE); i++) {
+        hal_flash[addr + i] = 0xff;
+    }
+
+    if (cut) hal_flash_cut_now();
+}
+
+/**********************************************************************
+ * analog registers, adc, random
+ */
+
+HAL_WEAK unsigned char analog_read(unsigned char addr) {
+
+    return hal_analog[addr];
+}
+
+HAL_WEAK void analog_write(unsigned char addr, unsigned char v) {
+
+    hal_analog[addr] = v;
+}
+
+unsigned short hal_adc_mv = 3000;
+
+HAL_WEAK u16 drv_get_adc_data(void) {
+
+    return hal_adc_mv;
+}
+
+HAL_WEAK u32 drv_u32Rand(void) {
+
+    return hal_rand_get();
+}
+
+/**********************************************************************
+ * gpio and irq
+ */
+
+static hal_pin_t *hal_pin_find(u32 pin) {
+
+    for (u8 i = 0; i < hal_pins_num; i++) {
+        if (hal_pins[i].pin == pin) return &hal_pins[i];
+    }
+
+    if (hal_pins_num == HAL_PINS_MAX) return NULL;
+
+    hal_pins[hal_pins_num].pin = pin;
+    hal_pins[hal_pins_num].level = 1;
+
+    return &hal_pins[hal_pins_num++];
+}
+
+static void hal_irq_fire() {
+
+    for (u8 i = 0; i <= GPIO_IRQ_RISC1_MODE; i++) {
+        if (hal_irq[i].pending) {
+            hal_irq[i].pending = 0;
+            if (hal_irq[i].cb) hal_irq[i].cb();
+        }
+    }
+}
+
+void hal_gpio_set(unsigned int pin, unsigned char level) {
+    hal_pin_t *p = hal_pin_find(pin);
+
+    if (!p || p->level == level) return;
+
+    p->level = level;
+
+    for (u8 i = 0; i <= GPIO_IRQ_RISC1_MODE; i++) {
+        if (hal_irq[i].en && hal_irq[i].pin == pin &&
+                (hal_irq[i].polarity == RISING_EDGE) == (level != 0)) {
+            hal_irq[i].pending = 1;
+        }
+    }
+
+    if (hal_irq_en) hal_irq_fire();
+}
+
+unsigned char hal_gpio_get(unsigned int pin) {
+    hal_pin_t *p = hal_pin_find(pin);
+
+    return p ? p->level : 1;
+}
+
+void hal_gpio_reset() {
+
+    memset(hal_pins, 0, sizeof(hal_pins));
+    memset(hal_irq, 0, sizeof(hal_irq));
+    hal_pins_num = 0;
+    hal_irq_en = 1;
+}
+
+HAL_WEAK bool drv_gpio_read(u32 pin) {
+
+    return hal_gpio_get(pin);
+}
+
+HAL_WEAK void drv_gpio_write(u32 pin, bool value) {
+    hal_pin_t *p = hal_pin_find(pin);
+
+    if (p) p->level = value ? 1 : 0;
+}
+
+HAL_WEAK int drv_gpio_irq_config(drv_gpioIrqMode_e mode, u32 pin, drv_gpioPoll_e polarity, irq_callback gpio_irq_callback) {
+
+    hal_irq[mode].pin = pin;
+    hal_irq[mode].polarity = polarity;
+    hal_irq[mode].cb = gpio_irq_callback;
+    hal_irq[mode].pending = 0;
+
+    return 0;
+}
+
+HAL_WEAK void drv_gpio_irq_en(u32 pin) {
+
+    hal_irq[GPIO_IRQ_MODE].en = 1;
+}
+
+HAL_WEAK void drv_gpio_irq_risc0_en(u32 pin) {
+
+    hal_irq[GPIO_IRQ_RISC0_MODE].en = 1;
+}
+
+HAL_WEAK void drv_gpio_irq_risc1_en(u32 pin) {
+
+    hal_irq[GPIO_IRQ_RISC1_MODE].en = 1;
+}
+
+HAL_WEAK void drv_gpio_irq_risc0_set(u32 pin, drv_gpioPoll_e polarity) {
+
+    hal_irq[GPIO_IRQ_RISC0_MODE].polarity = polarity;
+}
+
+HAL_WEAK void drv_gpio_irq_risc1_set(u32 pin, drv_gpioPoll_e polarity) {
+
+    hal_irq[GPIO_IRQ_RISC1_MODE].polarity = polarity;
+}
+
+HAL_WEAK u32 drv_disable_irq(void) {
+    u32 r = hal_irq_en;
+
+    hal_irq_en = 0;
+
+    return r;
+}
+
+HAL_WEAK u32 drv_restore_irq(u32 en) {
+
+    hal_irq_en = en;
+    if (hal_irq_en) hal_irq_fire();
+
+    return 0;
+}
+
+HAL_WEAK void drv_enable_irq(void) {
+
+    drv_restore_irq(1);
+}
+
+/**********************************************************************
+ * power management, the sleep is a suspend which moves the time
+ */
+
+HAL_WEAK void drv_pm_lowPowerEnter(void) {
+    unsigned long long wake = hal_wake_us, slept;
+    ev_timer_event_t *timerEvt;
+    u32 ms;
+
+    if (tl_stackBusy() || !zb_isTaskDone()) return;
+
+    timerEvt = ev_timer_nearestGet();
+    if (timerEvt) {
+        ms = ev_timer_remainGet(timerEvt);
+        if (!ms) return;
+        if (hal_now_us + ms * 1000ULL < wake) wake = hal_now_us + ms * 1000ULL;
+    }
+
+    slept = wake - hal_now_us;
+    while (hal_now_us < wake) {
+        hal_advance_us(wake - hal_now_us > 0x10000000 ? 0x10000000 : (u32)(wake - hal_now_us));
+    }
+
+    /* drv_pm_longSleep(), clock_time() wraps after 268 s, the time goes to ev_timer as by drv_pm_wakeupTimeUpdate() */
+    if (slept > PM_NORMAL_SLEEP_MAX * 1000ULL) {
+        ev_timer_update(slept / 1000);
+        ev_timer_setPrevSysTick(clock_time() - (u32)(slept % 1000) * sys_tick_per_us);
+    }
+}
+
+HAL_WEAK void drv_pm_longSleep(drv_pm_sleep_mode_e mode, drv_pm_wakeup_src_e src, u32 durationMs) {}
+HAL_WEAK void drv_pm_wakeupPinConfig(drv_pm_pinCfg_t *pinCfg, u32 pinNum) {}
+HAL_WEAK void drv_pm_wakeupPinLevelChange(drv_pm_pinCfg_t *pinCfg, u32 pinNum) {}
+HAL_WEAK void drv_pm_deepSleep_frameCnt_set(u32 frameCounter) {}
+
+HAL_WEAK bool drv_pm_deepSleep_flag_get(void) {
+
+    return FALSE;
+}
+
+/**********************************************************************
+ * radio
+ */
+
+unsigned int hal_rf_time[RF_STATE_OFF + 1];
+
+HAL_WEAK void rf_stateTimeGet(u32 *pTime) {
+
+    if (pTime) memcpy(pTime, hal_rf_time, sizeof(hal_rf_time));
+    memset(hal_rf_time, 0, sizeof(hal_rf_time));
+}
+
+HAL_WEAK void rf_paShutDown(void) {}
+HAL_WEAK void rf_reset(void) {}
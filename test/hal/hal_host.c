@@ -0,0 +1,134 @@
+/* libc side of the harness, no SDK headers here */
+#define _GNU_SOURCE
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <execinfo.h>
+#include <sys/mman.h>
+
+#include "hal.h"
+
+#define HAL_REG_BASE            0x800000            /* REG_BASE_ADDR                */
+#define HAL_REG_SIZE            0x10000
+#define HAL_BACKTRACE_MAX       32
+
+unsigned char *hal_flash = NULL;
+unsigned char *hal_analog = NULL;
+int hal_fails = 0;
+
+static size_t hal_file_size = 0;
+
+int hal_printf(const char *fmt, ...) {
+    va_list ap;
+    int n;
+
+    va_start(ap, fmt);
+    n = vprintf(fmt, ap);
+    va_end(ap);
+
+    return n;
+}
+
+static void hal_map_flash(const char *flash_file, int power_on) {
+    int fd, fresh;
+
+    hal_file_size = HAL_FLASH_SIZE + HAL_ANALOG_SIZE;
+
+    if (!flash_file) {
+        hal_flash = mmap(NULL, hal_file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        fresh = 1;
+    } else {
+        fd = open(flash_file, O_RDWR | O_CREAT, 0644);
+        if (fd < 0) {
+            perror(flash_file);
+            exit(2);
+        }
+        fresh = lseek(fd, 0, SEEK_END) != (off_t)hal_file_size;
+        if (fresh && ftruncate(fd, hal_file_size)) {
+            perror(flash_file);
+            exit(2);
+        }
+        hal_flash = mmap(NULL, hal_file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+    }
+
+    if (hal_flash == MAP_FAILED) {
+        perror("flash");
+        exit(2);
+    }
+
+    hal_analog = hal_flash + HAL_FLASH_SIZE;
+
+    if (fresh) {
+        memset(hal_flash, 0xff, HAL_FLASH_SIZE);
+    }
+    if (fresh || power_on) {
+        memset(hal_analog, 0, HAL_ANALOG_SIZE);
+    }
+}
+
+/* the addresses go to addr2line -e <test> */
+static void hal_crash(int sig) {
+    void *bt[HAL_BACKTRACE_MAX];
+
+    fflush(stdout);
+    fprintf(stderr, "signal %d, backtrace:\n", sig);
+    backtrace_symbols_fd(bt, backtrace(bt, HAL_BACKTRACE_MAX), 2);
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+void hal_init(const char *flash_file, int power_on) {
+    void *reg;
+
+    if (!hal_flash) {
+        signal(SIGSEGV, hal_crash);
+        signal(SIGBUS, hal_crash);
+        signal(SIGABRT, hal_crash);
+        reg = mmap((void*)HAL_REG_BASE, HAL_REG_SIZE, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if (reg != (void*)HAL_REG_BASE) {
+            fprintf(stderr, "cannot map the registers at 0x%x\n", HAL_REG_BASE);
+            exit(2);
+        }
+        hal_map_flash(flash_file, power_on);
+    }
+
+    memset((void*)HAL_REG_BASE, 0, HAL_REG_SIZE);
+}
+
+void hal_exit() {
+
+    if (hal_flash) {
+        msync(hal_flash, hal_file_size, MS_SYNC);
+    }
+}
+
+void hal_flash_erase_all() {
+
+    memset(hal_flash, 0xff, HAL_FLASH_SIZE);
+}
+
+void hal_fail(const char *file, int line, const char *cond) {
+
+    printf("%s:%d: check failed: %s\n", file, line, cond);
+    hal_fails++;
+}
+
+void hal_fail_eq(const char *file, int line, const char *expr, long long val, long long expected) {
+
+    printf("%s:%d: check failed: %s is %lld, expected %lld\n", file, line, expr, val, expected);
+    hal_fails++;
+}
+
+int hal_result(const char *name) {
+
+    printf("%s: %s\n", name, hal_fails ? "FAILED" : "passed");
+    fflush(stdout);
+
+    return hal_fails ? 1 : 0;
+}
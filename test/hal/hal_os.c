@@ -0,0 +1,73 @@
+/* stand-ins of the os part of libzb_ed.a, the tasks run at the next pass */
+#include "tl_common.h"
+#include "zb_api.h"
+
+#include "hal.h"
+
+#define HAL_WEAK            __attribute__((weak))
+#define HAL_TASKQ_SIZE      32
+
+typedef struct {
+    tl_zb_callback_t func;
+    void            *arg;
+} hal_task_t;
+
+static hal_task_t hal_taskq[HAL_TASKQ_SIZE];
+static u8 hal_taskq_wptr = 0;
+static u8 hal_taskq_rptr = 0;
+
+HAL_WEAK u32 sysTimerPerUs = sys_tick_per_us;
+HAL_WEAK u32 _end_bss_ = 0xffffffff;
+
+/**********************************************************************
+ * os, tasks
+ */
+
+HAL_WEAK void os_init(u8 isRetention) {
+
+    if (!isRetention) {
+        ev_buf_init();
+        ev_timer_init();
+    }
+}
+
+HAL_WEAK u8 tl_zbTaskPost(tl_zb_callback_t func, void *arg) {
+
+    if ((u8)(hal_taskq_wptr - hal_taskq_rptr) >= HAL_TASKQ_SIZE) return 1;
+
+    hal_taskq[hal_taskq_wptr % HAL_TASKQ_SIZE].func = func;
+    hal_taskq[hal_taskq_wptr % HAL_TASKQ_SIZE].arg = arg;
+    hal_taskq_wptr++;
+
+    return 0;
+}
+
+/* the tasks posted by a task wait for the next pass */
+HAL_WEAK void tl_zbTaskProcedure(void) {
+    u8 wptr = hal_taskq_wptr;
+    hal_task_t *task;
+
+    while (hal_taskq_rptr != wptr) {
+        task = &hal_taskq[hal_taskq_rptr % HAL_TASKQ_SIZE];
+        hal_taskq_rptr++;
+        task->func(task->arg);
+    }
+}
+
+void hal_task_run() {
+
+    tl_zbTaskProcedure();
+}
+
+HAL_WEAK u8 zb_isTaskDone(void) {
+
+    return hal_taskq_rptr == hal_taskq_wptr;
+}
+
+HAL_WEAK bool tl_stackBusy(void) {
+
+    return FALSE;
+}
+
+HAL_WEAK void ev_rtc_update(u32 updateTime) {}
+HAL_WEAK void apsCleanToStopSecondClock(void) {}
@@ -0,0 +1,276 @@
+/* stand-ins of libzb_ed.a, the network is simulated by the flags of hal.h */
+#include "tl_common.h"
+#include "zb_api.h"
+#include "zcl_include.h"
+#include "bdb.h"
+
+#include "hal.h"
+
+#define HAL_WEAK            __attribute__((weak))
+
+unsigned char  hal_joined = 1;
+unsigned char  hal_bound = 1;
+unsigned int   hal_poll_rate = 0;
+unsigned int   hal_poll_changes = 0;
+unsigned int   hal_polls = 0;
+unsigned int   hal_rx_pending = 0;
+unsigned char  hal_parent = 1;
+unsigned int   hal_tx_frames = 0;
+
+static bdb_appCb_t *hal_bdbCb = NULL;
+static zdo_appIndCb_t *hal_zdoCb = NULL;
+static ev_timer_event_t *hal_pollEvt = NULL;
+
+/**********************************************************************
+ * data of the library
+ */
+
+HAL_WEAK zb_info_t g_zbInfo;
+HAL_WEAK sys_diagnostics_t g_sysDiags;
+HAL_WEAK u8 APS_GROUP_TABLE_SIZE = APS_GROUP_TABLE_NUM;
+HAL_WEAK const addrExt_t g_invalid_addr = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+HAL_WEAK const u8 tcLinkKeyCentralDefault[SEC_KEY_LEN] = {0x5a, 0x69, 0x67, 0x42, 0x65, 0x65, 0x41, 0x6c,
+                                                          0x6c, 0x69, 0x61, 0x6e, 0x63, 0x65, 0x30, 0x39};
+HAL_WEAK const u8 linkKeyDistributedMaster[SEC_KEY_LEN];
+HAL_WEAK const u8 touchLinkKeyMaster[SEC_KEY_LEN];
+
+/**********************************************************************
+ * network
+ */
+
+HAL_WEAK void zb_init(void) {}
+HAL_WEAK void af_powerDescPowerModeUpdate(power_mode_t mode) {}
+
+HAL_WEAK void zb_zdoCbRegister(zdo_appIndCb_t *cb) {
+
+    hal_zdoCb = cb;
+}
+
+HAL_WEAK bool af_endpointRegister(u8 ep, af_simple_descriptor_t *simple_desc, af_endpoint_cb_t cb, af_dataCnf_cb_t cnfCb) {
+
+    return TRUE;
+}
+
+HAL_WEAK u8 af_dataSend(u8 srcEp, epInfo_t *pDstEpInfo, u16 clusterId, u16 cmdPldLen, u8 *cmdPld, u8 *apsCnt) {
+
+    hal_tx_frames++;
+
+    return RET_OK;
+}
+
+HAL_WEAK bool zb_isDeviceJoinedNwk(void) {
+
+    return hal_joined;
+}
+
+HAL_WEAK bool zb_isDeviceFactoryNew(void) {
+
+    return !hal_joined;
+}
+
+/* a data request to the parent, the confirm goes to the app as from the MAC */
+static s32 hal_pollCb(void *arg) {
+    nlme_sync_cnf_t cnf;
+
+    if (!hal_joined) {
+        hal_pollEvt = NULL;
+        return -1;
+    }
+
+    hal_polls++;
+
+    if (!hal_parent) {
+        cnf.status = MAC_STA_NO_ACK;
+    } else if (hal_rx_pending) {
+        hal_rx_pending--;
+        cnf.status = MAC_SUCCESS;
+    } else {
+        cnf.status = MAC_STA_NO_DATA;
+    }
+
+    if (hal_zdoCb && hal_zdoCb->zdoNlmeSyncCnfCb) {
+        hal_zdoCb->zdoNlmeSyncCnfCb(&cnf);
+    }
+
+    return 0;
+}
+
+HAL_WEAK u8 zb_setPollRate(u32 newRate) {
+
+    if (newRate != hal_poll_rate) {
+        hal_poll_rate = newRate;
+        hal_poll_changes++;
+
+        if (hal_pollEvt) {
+            TL_ZB_TIMER_CANCEL(&hal_pollEvt);
+        }
+        if (newRate) {
+            hal_pollEvt = TL_ZB_TIMER_SCHEDULE(hal_pollCb, NULL, newRate);
+        }
+    }
+
+    return RET_OK;
+}
+
+HAL_WEAK bool zb_bindingTblSearched(u16 clusterID, u8 srcEp) {
+
+    return hal_bound;
+}
+
+HAL_WEAK u8 aps_bindingTblEntryNum(void) {
+
+    return hal_bound;
+}
+
+HAL_WEAK void zb_resetDevice2FN(void) {
+
+    hal_joined = 0;
+}
+
+HAL_WEAK u8 zb_rejoinReq(u32 scanChannels, u8 scanDuration) {
+
+    return RET_OK;
+}
+
+HAL_WEAK u32 zb_apsChannelMaskGet(void) {
+
+    return 0x07fff800;
+}
+
+HAL_WEAK u32 ss_outgoingFrameCntGet(void) {
+
+    return 0;
+}
+
+HAL_WEAK u8 zb_getNwkAddrByExtAddr(addrExt_t extAddr, u16 *nwkAddr) {
+
+    return RET_ERROR;
+}
+
+HAL_WEAK u8 zb_address_ieee_by_short(u16 short_addr, addrExt_t ieee_address) {
+
+    return RET_ERROR;
+}
+
+HAL_WEAK addrExt_t *tl_zbExtAddrPtrByShortAddr(u16 shortAddr) {
+
+    return NULL;
+}
+
+HAL_WEAK zdo_status_t zb_zdoNwkAddrReq(u16 dstNwkAddr, zdo_nwk_addr_req_t *pReq, u8 *seqNo, zdo_callback indCb) {
+
+    return ZDO_SUCCESS;
+}
+
+HAL_WEAK zdo_status_t zb_zdoIeeeAddrReq(u16 dstNwkAddr, zdo_ieee_addr_req_t *pReq, u8 *seqNo, zdo_callback indCb) {
+
+    return ZDO_SUCCESS;
+}
+
+HAL_WEAK zdo_status_t zb_zdoMatchDescReq(u16 dstNwkAddr, zdo_match_descriptor_req_t *pReq, u8 *seqNo, zdo_callback indCb) {
+
+    return ZDO_SUCCESS;
+}
+
+HAL_WEAK u8 aps_group_entry_num_get(void) {
+
+    return 0;
+}
+
+HAL_WEAK void aps_group_list_get(u8 *counter, u16 *group_list) {
+
+    *counter = 0;
+}
+
+HAL_WEAK aps_group_tbl_ent_t *aps_group_search(u16 groupAddr, u8 endpoint) {
+
+    return NULL;
+}
+
+HAL_WEAK aps_status_t aps_me_group_add_req(aps_add_group_req_t *req) {
+
+    return APS_STATUS_TABLE_FULL;
+}
+
+HAL_WEAK aps_status_t aps_me_group_delete_req(aps_delete_group_req_t *req) {
+
+    return APS_STATUS_INVALID_GROUP;
+}
+
+HAL_WEAK aps_status_t aps_me_group_delete_all_req(u8 ep) {
+
+    return APS_STATUS_SUCCESS;
+}
+
+HAL_WEAK void drv_aes_decrypt(u8 *key, u8 *cipher, u8 *result) {
+
+    memcpy(result, cipher, 16);
+}
+
+/**********************************************************************
+ * bdb, the device is on the network at once if hal_joined is set
+ */
+
+static void hal_bdbInitDone(void *arg) {
+
+    if (hal_bdbCb && hal_bdbCb->bdbInitCb) {
+        hal_bdbCb->bdbInitCb(BDB_INIT_STATUS_SUCCESS, hal_joined);
+    }
+}
+
+HAL_WEAK u8 bdb_init(af_simple_descriptor_t *simple_desc, bdb_commissionSetting_t *setting, bdb_appCb_t *cb, u8 repower) {
+
+    hal_bdbCb = cb;
+    tl_zbTaskPost(hal_bdbInitDone, NULL);
+
+    return TRUE;
+}
+
+HAL_WEAK bool bdb_isIdle(void) {
+
+    return TRUE;
+}
+
+HAL_WEAK u8 bdb_networkSteerStart(void) {
+
+    return 0;
+}
+
+HAL_WEAK void bdb_findBindMatchClusterSet(u8 clusterNum, u16 clusterId[]) {}
+HAL_WEAK void bdb_zdoStartDevCnf(zdo_start_device_confirm_t *startDevCnf) {}
+
+HAL_WEAK u8 bdb_preInstallCodeLoad(u8 *keyType, u8 derivedKey[]) {
+
+    return RET_ERROR;
+}
+
+/* as the library, the entries restored from NV are kept */
+HAL_WEAK status_t bdb_defaultReportingCfg(u8 endpoint, u16 profileID, u16 clusterID, u16 attrID,
+                                          u16 minReportInt, u16 maxReportInt, u8 *reportableChange) {
+    zclCfgReportRec_t rec;
+    reportCfgInfo_t *pEntry;
+    zclAttrInfo_t *pAttr = zcl_findAttribute(endpoint, clusterID, attrID);
+
+    if (!pAttr) return ZCL_STA_UNSUPPORTED_ATTRIBUTE;
+
+    for (u8 i = 0; i < ZCL_REPORTING_TABLE_NUM; i++) {
+        pEntry = &reportingTab.reportCfgInfo[i];
+        if (pEntry->used && pEntry->endPoint == endpoint && pEntry->clusterID == clusterID && pEntry->attrID == attrID) {
+            return ZCL_STA_SUCCESS;
+        }
+    }
+
+    pEntry = zcl_reportCfgInfoEntryFreeGet();
+    if (!pEntry) return ZCL_STA_INSUFFICIENT_SPACE;
+
+    memset(&rec, 0, sizeof(rec));
+    rec.attrID = attrID;
+    rec.dataType = pAttr->type;
+    rec.minReportInt = minReportInt;
+    rec.maxReportInt = maxReportInt;
+    rec.reportableChange = reportableChange;
+
+    zcl_reportCfgInfoEntryUpdate(pEntry, endpoint, profileID, clusterID, &rec);
+
+    return ZCL_STA_SUCCESS;
+}
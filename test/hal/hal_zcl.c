@@ -0,0 +1,95 @@
+/*
+ * Recorders of the ZCL calls, linked with
+ * -Wl,--wrap=zcl_reportAttrs,--wrap=zcl_report,--wrap=zcl_setAttrVal
+ * the real functions still run, the frames go to af_dataSend() of hal_stack.c
+ */
+#include "tl_common.h"
+#include "zcl_include.h"
+
+#include "hal.h"
+#include "hal_zcl.h"
+
+static hal_zcl_rec_t hal_zcl_recs[HAL_ZCL_RECS_MAX];
+static u8 hal_zcl_recs_num = 0;
+
+status_t __real_zcl_reportAttrs(u8 srcEp, epInfo_t *pDstEpInfo, u8 disableDefaultRsp, u8 direction, u8 seqNo,
+                                u16 manuCode, u16 clusterId, zclReportCmd_t *pReportAttrs);
+status_t __real_zcl_report(u8 srcEp, epInfo_t *pDstEpInfo, u8 disableDefaultRsp, u8 direction, u8 seqNo,
+                           u16 manuCode, u16 clusterId, u16 attrID, u8 dataType, u8 *pData);
+status_t __real_zcl_setAttrVal(u8 endpoint, u16 clusterId, u16 attrId, u8 *val);
+
+hal_zcl_rec_t *hal_zcl_rec(unsigned char ep, unsigned short cluster, unsigned short attr) {
+    hal_zcl_rec_t *rec;
+
+    for (u8 i = 0; i < hal_zcl_recs_num; i++) {
+        rec = &hal_zcl_recs[i];
+        if (rec->ep == ep && rec->cluster == cluster && rec->attr == attr) return rec;
+    }
+
+    if (hal_zcl_recs_num == HAL_ZCL_RECS_MAX) return NULL;
+
+    rec = &hal_zcl_recs[hal_zcl_recs_num++];
+    memset(rec, 0, sizeof(hal_zcl_rec_t));
+    rec->ep = ep;
+    rec->cluster = cluster;
+    rec->attr = attr;
+
+    return rec;
+}
+
+static void hal_zcl_report(u8 ep, u16 cluster, u16 attr, u8 dataType, u8 *data) {
+    hal_zcl_rec_t *rec = hal_zcl_rec(ep, cluster, attr);
+    u8 len;
+
+    if (!rec) return;
+
+    rec->reports++;
+    rec->report_us = hal_now_us;
+
+    len = zcl_getAttrSize(dataType, data);
+    if (len > sizeof(rec->value)) len = sizeof(rec->value);
+    rec->value = 0;
+    memcpy(&rec->value, data, len);
+}
+
+status_t __wrap_zcl_reportAttrs(u8 srcEp, epInfo_t *pDstEpInfo, u8 disableDefaultRsp, u8 direction, u8 seqNo,
+                                u16 manuCode, u16 clusterId, zclReportCmd_t *pReportAttrs) {
+
+    for (u8 i = 0; i < pReportAttrs->numAttr; i++) {
+        hal_zcl_report(srcEp, clusterId, pReportAttrs->attrList[i].attrID,
+                pReportAttrs->attrList[i].dataType, pReportAttrs->attrList[i].attrData);
+    }
+
+    return __real_zcl_reportAttrs(srcEp, pDstEpInfo, disableDefaultRsp, direction, seqNo, manuCode, clusterId, pReportAttrs);
+}
+
+status_t __wrap_zcl_report(u8 srcEp, epInfo_t *pDstEpInfo, u8 disableDefaultRsp, u8 direction, u8 seqNo,
+                           u16 manuCode, u16 clusterId, u16 attrID, u8 dataType, u8 *pData) {
+
+    hal_zcl_report(srcEp, clusterId, attrID, dataType, pData);
+
+    return __real_zcl_report(srcEp, pDstEpInfo, disableDefaultRsp, direction, seqNo, manuCode, clusterId, attrID, dataType, pData);
+}
+
+status_t __wrap_zcl_setAttrVal(u8 endpoint, u16 clusterId, u16 attrId, u8 *val) {
+    hal_zcl_rec_t *rec = hal_zcl_rec(endpoint, clusterId, attrId);
+
+    if (rec) rec->sets++;
+
+    return __real_zcl_setAttrVal(endpoint, clusterId, attrId, val);
+}
+
+/* the value in the attribute table */
+unsigned long long hal_zcl_attr(unsigned char ep, unsigned short cluster, unsigned short attr) {
+    zclAttrInfo_t *pAttr = zcl_findAttribute(ep, cluster, attr);
+    unsigned long long value = 0;
+    u8 len;
+
+    if (!pAttr) return ~0ULL;
+
+    len = zcl_getAttrSize(pAttr->type, pAttr->data);
+    if (len > sizeof(value)) len = sizeof(value);
+    memcpy(&value, pAttr->data, len);
+
+    return value;
+}
@@ -0,0 +1,20 @@
+#ifndef TEST_HAL_HAL_ZCL_H_
+#define TEST_HAL_HAL_ZCL_H_
+
+#define HAL_ZCL_RECS_MAX        64
+
+/* the calls for an attribute since the boot, SDK side only, the struct is packed */
+typedef struct {
+    unsigned long long  value;                      /* of the last report           */
+    unsigned long long  report_us;                  /* hal_now_us of the last report */
+    unsigned int        reports;
+    unsigned int        sets;                       /* zcl_setAttrVal() calls       */
+    unsigned short      cluster;
+    unsigned short      attr;
+    unsigned char       ep;
+} hal_zcl_rec_t;
+
+hal_zcl_rec_t *hal_zcl_rec(unsigned char ep, unsigned short cluster, unsigned short attr);
+unsigned long long hal_zcl_attr(unsigned char ep, unsigned short cluster, unsigned short attr);
+
+#endif /* TEST_HAL_HAL_ZCL_H_ */
@@ -0,0 +1,155 @@
+# Host tests, the real sources with the stand-ins of test/hal, no tc32 toolchain needed.
+# The SDK casts pointers to u32, so the image is linked below 4G and away from the
+# registers at 0x800000.
+HOST_OUT := $(OUT_PATH)/host
+HOST_TEST_PATH := ./test
+
+HOST_TEST_FLAGS := $(filter-out -O2 -ffunction-sections -fdata-sections,$(GCC_FLAGS)) \
+-O1 \
+-g \
+-fno-pie \
+-MMD \
+-Wno-address-of-packed-member \
+-Wno-int-to-pointer-cast \
+-Wno-pointer-to-int-cast \
+-Wno-builtin-declaration-mismatch
+
+# the libc side, no SDK headers and no -fpack-struct
+HOST_LIBC_FLAGS := \
+-std=gnu99 \
+-Wall \
+-O1 \
+-g \
+-fno-pie \
+-MMD \
+-I$(HOST_TEST_PATH)
+
+HOST_LD_FLAGS := -no-pie -Wl,-Ttext-segment=0x10000000
+
+HOST_HAL_OBJS := \
+$(HOST_OUT)/test/hal/hal_host.o \
+$(HOST_OUT)/test/hal/hal_drv.o \
+$(HOST_OUT)/test/hal/hal_os.o \
+$(HOST_OUT)/test/hal/hal_stack.o
+
+HOST_OS_OBJS := \
+$(HOST_OUT)/proj/common/list.o \
+$(HOST_OUT)/proj/common/mempool.o \
+$(HOST_OUT)/proj/common/string.o \
+$(HOST_OUT)/proj/common/utility.o \
+$(HOST_OUT)/proj/os/ev.o \
+$(HOST_OUT)/proj/os/ev_buffer.o \
+$(HOST_OUT)/proj/os/ev_poll.o \
+$(HOST_OUT)/proj/os/ev_queue.o \
+$(HOST_OUT)/proj/os/ev_timer.o
+
+HOST_NV_OBJS := \
+$(HOST_OUT)/proj/drivers/drv_flash.o \
+$(HOST_OUT)/proj/drivers/drv_nv.o
+
+HOST_ZCL_OBJS := \
+$(HOST_OUT)/zigbee/zcl/zcl.o \
+$(HOST_OUT)/zigbee/zcl/zcl_nv.o \
+$(HOST_OUT)/zigbee/zcl/zcl_reporting.o \
+$(HOST_OUT)/zigbee/zcl/general/zcl_basic.o \
+$(HOST_OUT)/zigbee/zcl/general/zcl_group.o \
+$(HOST_OUT)/zigbee/zcl/general/zcl_identify.o \
+$(HOST_OUT)/zigbee/zcl/general/zcl_onoff.o \
+$(HOST_OUT)/zigbee/zcl/general/zcl_powerCfg.o \
+$(HOST_OUT)/zigbee/zcl/ota_upgrading/zcl_ota.o \
+$(HOST_OUT)/zigbee/zcl/security_safety/zcl_ias_zone.o \
+$(HOST_OUT)/zigbee/zcl/smart_energy/zcl_metering.o \
+$(HOST_OUT)/zigbee/ota/ota.o \
+$(HOST_OUT)/zigbee/ota/otaEpCfg.o
+
+# the application as in project.mk, but main()
+HOST_APP_OBJS := $(patsubst $(OUT_PATH)/%,$(HOST_OUT)/%,$(filter-out %/main.o,$(filter $(OUT_PATH)/$(SRC_PATH)/%,$(OBJS))))
+
+# scenario replay, test/scenarios/*.scn
+HOST_REPLAY := $(HOST_OUT)/replay
+HOST_REPLAY_OBJS := \
+$(HOST_OUT)/test/replay.o \
+$(HOST_OUT)/test/replay_app.o \
+$(HOST_OUT)/test/hal/hal_zcl.o \
+$(HOST_APP_OBJS) \
+$(HOST_ZCL_OBJS) \
+$(HOST_NV_OBJS) \
+$(HOST_OS_OBJS) \
+$(HOST_HAL_OBJS)
+HOST_REPLAY_WRAP := -Wl,--wrap=zcl_reportAttrs,--wrap=zcl_report,--wrap=zcl_setAttrVal
+HOST_SCENARIOS := $(sort $(wildcard $(HOST_TEST_PATH)/scenarios/*.scn))
+
+# unit tests and benchmarks, each with the modules it needs
+HOST_TESTS := \
+bench_config \
+test_crc \
+test_ev_timer \
+test_zcl_attr \
+test_ota_page \
+test_ota_lz \
+test_string \
+test_nv_cut \
+bench_nv_idx \
+test_energy
+
+bench_config_OBJS := $(HOST_OUT)/test/bench_config.o $(HOST_APP_OBJS) $(HOST_ZCL_OBJS) $(HOST_NV_OBJS) $(HOST_OS_OBJS) $(HOST_HAL_OBJS)
+bench_config_LD := -Wl,--wrap=xcrc16,--wrap=flash_read_page
+
+test_crc_OBJS := $(HOST_OUT)/test/test_crc.o $(HOST_OUT)/proj/common/utility.o $(HOST_OUT)/test/hal/hal_host.o
+
+test_ev_timer_OBJS := $(HOST_OUT)/test/test_ev_timer.o $(HOST_OS_OBJS) $(HOST_OUT)/test/hal/hal_host.o $(HOST_OUT)/test/hal/hal_drv.o $(HOST_OUT)/test/hal/hal_os.o
+
+test_zcl_attr_OBJS := $(HOST_OUT)/test/test_zcl_attr.o $(HOST_APP_OBJS) $(HOST_ZCL_OBJS) $(HOST_NV_OBJS) $(HOST_OS_OBJS) $(HOST_HAL_OBJS)
+
+test_ota_page_OBJS := $(HOST_OUT)/test/test_ota_page.o $(HOST_APP_OBJS) $(HOST_ZCL_OBJS) $(HOST_NV_OBJS) $(HOST_OS_OBJS) $(HOST_HAL_OBJS)
+test_ota_page_LD := -Wl,--wrap=flash_write_page
+
+test_ota_lz_OBJS := $(HOST_OUT)/test/test_ota_lz.o $(HOST_APP_OBJS) $(HOST_ZCL_OBJS) $(HOST_NV_OBJS) $(HOST_OS_OBJS) $(HOST_HAL_OBJS)
+
+test_string_OBJS := $(HOST_OUT)/test/test_string.o $(HOST_OS_OBJS) $(HOST_OUT)/test/hal/hal_host.o $(HOST_OUT)/test/hal/hal_drv.o $(HOST_OUT)/test/hal/hal_os.o
+
+# drv_nv.c is included by the test
+test_nv_cut_OBJS := $(HOST_OUT)/test/test_nv_cut.o $(HOST_OUT)/proj/drivers/drv_flash.o $(HOST_OS_OBJS) $(HOST_OUT)/test/hal/hal_host.o $(HOST_OUT)/test/hal/hal_drv.o $(HOST_OUT)/test/hal/hal_os.o
+
+# drv_nv.c is included by the test
+bench_nv_idx_OBJS := $(HOST_OUT)/test/bench_nv_idx.o $(HOST_OUT)/proj/drivers/drv_flash.o $(HOST_OS_OBJS) $(HOST_OUT)/test/hal/hal_host.o $(HOST_OUT)/test/hal/hal_drv.o $(HOST_OUT)/test/hal/hal_os.o
+bench_nv_idx_LD := -Wl,--wrap=flash_read_page
+
+test_energy_OBJS := $(HOST_OUT)/test/test_energy.o $(HOST_APP_OBJS) $(HOST_ZCL_OBJS) $(HOST_NV_OBJS) $(HOST_OS_OBJS) $(HOST_HAL_OBJS)
+
+HOST_LIBC_OBJS := \
+$(HOST_OUT)/test/hal/hal_host.o \
+$(HOST_OUT)/test/replay.o
+
+HOST_ALL_OBJS := $(sort $(HOST_REPLAY_OBJS) $(foreach t,$(HOST_TESTS),$($(t)_OBJS)))
+
+$(HOST_LIBC_OBJS): HOST_CFLAGS = $(HOST_LIBC_FLAGS)
+$(HOST_OUT)/proj/common/string.o: HOST_CFLAGS = $(HOST_TEST_FLAGS) -fno-builtin -fno-tree-loop-distribute-patterns $(INCLUDE_PATHS)
+# the calls go to string.c and the byte loops stay loops
+$(HOST_OUT)/test/test_string.o: HOST_CFLAGS = $(HOST_TEST_FLAGS) -fno-builtin -fno-tree-loop-distribute-patterns $(INCLUDE_PATHS) -I$(HOST_TEST_PATH)/hal
+HOST_CFLAGS = $(HOST_TEST_FLAGS) $(INCLUDE_PATHS) -I$(HOST_TEST_PATH)/hal
+
+$(HOST_OUT)/%.o: %.c
+	@echo 'Building host file: $<'
+	@mkdir -p $(dir $@)
+	@$(HOST_CC) $(HOST_CFLAGS) -c -o "$@" "$<"
+
+$(HOST_OUT)/%.o: $(SDK_PATH)/%.c
+	@echo 'Building host file: $<'
+	@mkdir -p $(dir $@)
+	@$(HOST_CC) $(HOST_CFLAGS) -c -o "$@" "$<"
+
+$(HOST_REPLAY): $(HOST_REPLAY_OBJS)
+	@$(HOST_CC) $(HOST_LD_FLAGS) $(HOST_REPLAY_WRAP) -o "$@" $^
+
+$(foreach t,$(HOST_TESTS),$(eval $(HOST_OUT)/$(t): $($(t)_OBJS) ; @$$(HOST_CC) $$(HOST_LD_FLAGS) $($(t)_LD) -o "$$@" $$^))
+
+host-test: $(HOST_REPLAY) $(addprefix $(HOST_OUT)/,$(HOST_TESTS))
+	@$(foreach t,$(HOST_TESTS),$(HOST_OUT)/$(t) &&) true
+	@$(foreach s,$(HOST_SCENARIOS),$(HOST_REPLAY) $(s) &&) true
+	-@echo ' '
+
+host-clean:
+	-$(RM) $(HOST_OUT)
+
+-include $(HOST_ALL_OBJS:.o=.d)
@@ -0,0 +1,318 @@
+/*
+ * Replays a scenario against the real application, faster than real time.
+ *
+ *   replay [--flash file] scenario.scn
+ *
+ * The scenario is a line per step, # starts a comment:
+ *
+ *   pin hot|cold|button|leak1|leak2 0|1    input level, the inputs idle high
+ *   pulse hot N [low high]                 N pulses, low and high time, 200ms 800ms
+ *   bounce hot N us                        N edges us apart, the contact is closed after
+ *   run 10s                                the time goes on, us ms s min h
+ *   set adc|joined|bound|rx|parent V       rx - frames queued at the parent,
+ *                                          parent 0 - the polls are not answered
+ *   ota query|none                         the server answers the next image query,
+ *                                          none - it has no image
+ *   ota blocks N                           the server sends N image blocks
+ *   ota end                                the server answers the upgrade end, now
+ *   reset                                  MCU restart, flash and retention kept
+ *   powercut                               as reset, the retention registers are lost
+ *   expect NAME [ep cluster attr] OP VALUE
+ *
+ * NAME is hot, cold (liters), attr (the value in the attribute table), reports,
+ * sets (zcl_setAttrVal() calls), poll (ms), polls (data requests), rx (frames
+ * left at the parent), tx (frames sent), flash_writes, flash_erases,
+ * ota_offset, ota_status (zcl_attr_fileOffset, zcl_attr_imageUpgradeStatus),
+ * new_ota (the config flag), time, awake (ms out of sleep). OP is == != < <= > >=. The counters of calls start
+ * with each boot.
+ *
+ * The restart is an exec of the runner, so no RAM survives it. The flash is a
+ * file, a temporary one is removed at the end.
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hal/hal.h"
+#include "replay.h"
+
+#define REPLAY_LINE_MAX         256
+#define REPLAY_ARGS_MAX         8
+#define REPLAY_PINS_MAX         5
+
+static const char *replay_pin_names[REPLAY_PINS_MAX] = { "hot", "cold", "button", "leak1", "leak2" };
+
+static char *replay_self;
+static const char *replay_scn;
+static const char *replay_flash;
+static int replay_tmp = 0;
+static int replay_line = 0;                         /* last line done                   */
+static unsigned int replay_pins = 0;                /* bit set - the pin is low         */
+static unsigned long long replay_awake_us = 0;      /* since the boot                   */
+
+static void replay_error(const char *msg, const char *arg) {
+
+    printf("%s:%d: %s %s\n", replay_scn, replay_line, msg, arg ? arg : "");
+    hal_fails++;
+}
+
+/* 10s, 500ms, 2min, 1h, 100us */
+static int replay_time(const char *s, unsigned long long *us) {
+    char *end;
+    unsigned long long v = strtoull(s, &end, 10);
+
+    if (end == s) return 0;
+
+    if (!strcmp(end, "us")) *us = v;
+    else if (!strcmp(end, "ms")) *us = v * 1000;
+    else if (!strcmp(end, "s") || !*end) *us = v * 1000000;
+    else if (!strcmp(end, "min")) *us = v * 60000000;
+    else if (!strcmp(end, "h")) *us = v * 3600000000ULL;
+    else return 0;
+
+    return 1;
+}
+
+static void replay_run(unsigned long long us) {
+    unsigned long long end = hal_now_us + us;
+    unsigned long long now;
+
+    while (hal_now_us < end) {
+        hal_wake_us = end;
+        now = hal_now_us;
+        replay_pass();
+        /* awake, the pass takes time */
+        if (hal_now_us == now) {
+            now = end - hal_now_us < HAL_LOOP_US ? end - hal_now_us : HAL_LOOP_US;
+            replay_awake_us += now;
+            hal_advance_us(now);
+        }
+    }
+
+    hal_wake_us = ~0ULL;
+}
+
+static void replay_pin_set(const char *name, unsigned char level) {
+    unsigned int pin = replay_pin(name);
+
+    if (pin == REPLAY_PIN_NONE) {
+        replay_error("unknown pin", name);
+        return;
+    }
+
+    for (int i = 0; i < REPLAY_PINS_MAX; i++) {
+        if (!strcmp(replay_pin_names[i], name)) {
+            replay_pins = level ? replay_pins & ~(1 << i) : replay_pins | (1 << i);
+        }
+    }
+
+    hal_gpio_set(pin, level);
+}
+
+static void replay_pins_restore() {
+
+    for (int i = 0; i < REPLAY_PINS_MAX; i++) {
+        hal_gpio_set(replay_pin(replay_pin_names[i]), replay_pins & (1 << i) ? 0 : 1);
+    }
+}
+
+void replay_reset(int power_on) {
+    char line[16], now[24], pins[16], fails[16];
+    char *argv[] = { replay_self, "--flash", (char*)replay_flash, "--line", line, "--time", now,
+                     "--pins", pins, "--fails", fails, power_on ? "--power-on" : "--reset",
+                     replay_tmp ? "--tmp" : "--keep", (char*)replay_scn, NULL };
+
+    snprintf(line, sizeof(line), "%d", replay_line);
+    snprintf(now, sizeof(now), "%llu", hal_now_us);
+    snprintf(pins, sizeof(pins), "%u", replay_pins);
+    snprintf(fails, sizeof(fails), "%d", hal_fails);
+
+    hal_exit();
+    fflush(stdout);
+
+    execv(replay_self, argv);
+    perror(replay_self);
+    exit(2);
+}
+
+static int replay_cmp(unsigned long long v, const char *op, unsigned long long expected) {
+
+    if (!strcmp(op, "==")) return v == expected;
+    if (!strcmp(op, "!=")) return v != expected;
+    if (!strcmp(op, "<"))  return v < expected;
+    if (!strcmp(op, "<=")) return v <= expected;
+    if (!strcmp(op, ">"))  return v > expected;
+    if (!strcmp(op, ">=")) return v >= expected;
+
+    return -1;
+}
+
+static void replay_expect(char **arg, int argc) {
+    unsigned int ep = 0, cluster = 0, attr = 0;
+    unsigned long long v, expected;
+    int r, i = 1;
+
+    if (argc == 7) {
+        ep = strtoul(arg[2], NULL, 0);
+        cluster = strtoul(arg[3], NULL, 0);
+        attr = strtoul(arg[4], NULL, 0);
+        i = 4;
+    } else if (argc != 4) {
+        replay_error("expect NAME [ep cluster attr] OP VALUE", NULL);
+        return;
+    }
+
+    if (!strcmp(arg[1], "awake")) {
+        v = replay_awake_us / 1000;
+    } else if (!replay_value(arg[1], ep, cluster, attr, &v)) {
+        replay_error("unknown value", arg[1]);
+        return;
+    }
+
+    expected = strtoull(arg[i + 2], NULL, 0);
+    r = replay_cmp(v, arg[i + 1], expected);
+
+    if (r < 0) {
+        replay_error("unknown op", arg[i + 1]);
+    } else if (!r) {
+        printf("%s:%d: expect %s %s %llu, it is %llu\n", replay_scn, replay_line, arg[1], arg[i + 1], expected, v);
+        hal_fails++;
+    }
+}
+
+static void replay_step(char **arg, int argc) {
+    unsigned long long low = 200000, high = 800000, us;
+    unsigned int pin, n;
+
+    if (!strcmp(arg[0], "pin") && argc == 3) {
+        replay_pin_set(arg[1], atoi(arg[2]) ? 1 : 0);
+    } else if (!strcmp(arg[0], "pulse") && (argc == 3 || argc == 5)) {
+        if (argc == 5 && (!replay_time(arg[3], &low) || !replay_time(arg[4], &high))) {
+            replay_error("bad time", arg[3]);
+            return;
+        }
+        for (n = atoi(arg[2]); n; n--) {
+            replay_pin_set(arg[1], 0);
+            replay_run(low);
+            replay_pin_set(arg[1], 1);
+            replay_run(high);
+        }
+    } else if (!strcmp(arg[0], "bounce") && argc == 4) {
+        pin = replay_pin(arg[1]);
+        if (pin == REPLAY_PIN_NONE || !replay_time(arg[3], &us)) {
+            replay_error("bad bounce", arg[1]);
+            return;
+        }
+        /* the last edge closes the contact */
+        for (n = atoi(arg[2]); n; n--) {
+            replay_pin_set(arg[1], (n & 1) ? 0 : 1);
+            replay_run(us);
+        }
+    } else if (!strcmp(arg[0], "run") && argc == 2) {
+        if (!replay_time(arg[1], &us)) {
+            replay_error("bad time", arg[1]);
+            return;
+        }
+        replay_run(us);
+    } else if (!strcmp(arg[0], "set") && argc == 3) {
+        n = strtoul(arg[2], NULL, 0);
+        if (!strcmp(arg[1], "adc")) hal_adc_mv = n;
+        else if (!strcmp(arg[1], "joined")) hal_joined = n;
+        else if (!strcmp(arg[1], "bound")) hal_bound = n;
+        else if (!strcmp(arg[1], "rx")) hal_rx_pending = n;
+        else if (!strcmp(arg[1], "parent")) hal_parent = n;
+        else replay_error("unknown", arg[1]);
+    } else if (!strcmp(arg[0], "ota") && (argc == 2 || argc == 3)) {
+        if (!replay_ota(arg[1], argc == 3 ? strtoul(arg[2], NULL, 0) : 0)) replay_error("unknown", arg[1]);
+    } else if (!strcmp(arg[0], "reset") && argc == 1) {
+        replay_reset(0);
+    } else if (!strcmp(arg[0], "powercut") && argc == 1) {
+        replay_reset(1);
+    } else if (!strcmp(arg[0], "expect")) {
+        replay_expect(arg, argc);
+    } else {
+        replay_error("unknown step", arg[0]);
+    }
+}
+
+static void replay_file(FILE *f) {
+    char buf[REPLAY_LINE_MAX], *arg[REPLAY_ARGS_MAX], *p;
+    int line = 0, argc;
+
+    while (fgets(buf, sizeof(buf), f)) {
+        if (++line <= replay_line) continue;
+        replay_line = line;
+
+        p = strchr(buf, '#');
+        if (p) *p = 0;
+
+        argc = 0;
+        for (p = strtok(buf, " \t\r\n"); p && argc < REPLAY_ARGS_MAX; p = strtok(NULL, " \t\r\n")) {
+            arg[argc++] = p;
+        }
+
+        if (argc) replay_step(arg, argc);
+    }
+}
+
+int main(int argc, char **argv) {
+    static char tmp[] = "/tmp/replay_flash_XXXXXX";
+    unsigned long long now = 0;
+    int power_on = 1, fd, r;
+    FILE *f;
+
+    replay_self = argv[0];
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--flash") && i + 1 < argc) replay_flash = argv[++i];
+        else if (!strcmp(argv[i], "--line") && i + 1 < argc) replay_line = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--time") && i + 1 < argc) now = strtoull(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "--pins") && i + 1 < argc) replay_pins = strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "--fails") && i + 1 < argc) hal_fails = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--reset")) power_on = 0;
+        else if (!strcmp(argv[i], "--power-on")) power_on = 1;
+        else if (!strcmp(argv[i], "--tmp")) replay_tmp = 1;
+        else if (!strcmp(argv[i], "--keep")) replay_tmp = 0;
+        else replay_scn = argv[i];
+    }
+
+    if (!replay_scn) {
+        fprintf(stderr, "usage: %s [--flash file] scenario.scn\n", argv[0]);
+        return 2;
+    }
+
+    f = fopen(replay_scn, "r");
+    if (!f) {
+        perror(replay_scn);
+        return 2;
+    }
+
+    if (!replay_flash) {
+        fd = mkstemp(tmp);
+        if (fd < 0) {
+            perror(tmp);
+            return 2;
+        }
+        close(fd);
+        unlink(tmp);
+        replay_flash = tmp;
+        replay_tmp = 1;
+    }
+
+    hal_init(replay_flash, power_on);
+    hal_time_set(now);
+    replay_pins_restore();
+
+    replay_boot();
+    replay_file(f);
+    fclose(f);
+
+    hal_exit();
+    if (replay_tmp) unlink(replay_flash);
+
+    r = hal_result(replay_scn);
+
+    return r;
+}
@@ -0,0 +1,24 @@
+#ifndef TEST_REPLAY_H_
+#define TEST_REPLAY_H_
+
+/*
+ * Scenario replay, the real application with the stand-ins of test/hal.
+ * replay.c reads the scenario, replay_app.c is the SDK side of it.
+ */
+
+#define REPLAY_PIN_NONE         0xFFFFFFFF
+
+/* replay_app.c */
+void replay_boot();                                 /* main() up to the loop            */
+void replay_pass();                                 /* a pass of the main loop          */
+unsigned int replay_pin(const char *name);          /* hot, cold, button, leak1, leak2  */
+/* hot, cold, attr, reports, sets, poll, polls, rx, tx, flash_writes, flash_erases,
+ * ota_offset, ota_status, new_ota, time; 0 - unknown */
+int replay_value(const char *name, unsigned int ep, unsigned int cluster, unsigned int attr, unsigned long long *value);
+/* the OTA server: query, none (no image), blocks N, end (upgrade now); 0 - unknown */
+int replay_ota(const char *cmd, unsigned int n);
+
+/* replay.c, the MCU is restarted, the scenario goes on from the next line */
+void replay_reset(int power_on);
+
+#endif /* TEST_REPLAY_H_ */
@@ -0,0 +1,218 @@
+/* SDK side of the replay runner */
+#include "tl_common.h"
+#include "zcl_include.h"
+
+#include "watermeter.h"
+#include "ota.h"
+
+#include "hal.h"
+#include "hal_zcl.h"
+#include "replay.h"
+
+#define REPLAY_RESET_BIT        0x20                /* mcu_reset() sets it          */
+
+/* the image of the OTA server, as in test_ota_page.c */
+#define REPLAY_OTA_HDR_LEN      56
+#define REPLAY_OTA_ELEM_HDR_LEN 6
+#define REPLAY_OTA_IMAGE_SIZE   60000
+#define REPLAY_OTA_FILE_SIZE    (REPLAY_OTA_HDR_LEN + REPLAY_OTA_ELEM_HDR_LEN + REPLAY_OTA_IMAGE_SIZE)
+#define REPLAY_OTA_BLOCK_SIZE   48
+#define REPLAY_OTA_START_FLAG   0x4b                /* TL_IMAGE_START_FLAG of ota.c */
+
+extern ota_ctx_t g_otaCtx;
+extern void user_init(bool isRetention);
+
+typedef struct {
+    const char *name;
+    u32         pin;
+} replay_pin_t;
+
+static const replay_pin_t replay_pins[] = {
+    { "hot",    HOT_GPIO    },
+    { "cold",   COLD_GPIO   },
+    { "button", BUTTON      },
+    { "leak1",  WLEAK1_GPIO },
+    { "leak2",  WLEAK2_GPIO },
+};
+
+static u8 replay_otaFile[REPLAY_OTA_FILE_SIZE];
+static u32 replay_otaVer = 0;                       /* of the image built */
+
+static void replay_put(u8 *p, u32 v, u8 len) {
+
+    for (u8 i = 0; i < len; i++) p[i] = v >> (8 * i);
+}
+
+/* the next version of the running one, the same bytes after a reset */
+static void replay_otaBuild() {
+    u8 *hdr = replay_otaFile, *img = replay_otaFile + REPLAY_OTA_HDR_LEN + REPLAY_OTA_ELEM_HDR_LEN;
+    u32 seed = 7;
+
+    if (replay_otaVer == g_otaCtx.pOtaPreamble->fileVer + 1) return;
+    replay_otaVer = g_otaCtx.pOtaPreamble->fileVer + 1;
+
+    memset(replay_otaFile, 0, sizeof(replay_otaFile));
+
+    replay_put(hdr, 0x0beef11e, 4);
+    replay_put(hdr + 4, 0x0100, 2);
+    replay_put(hdr + OTA_HDR_LEN_OFFSET, REPLAY_OTA_HDR_LEN, 2);
+    replay_put(hdr + 10, g_otaCtx.pOtaPreamble->manufacturerCode, 2);
+    replay_put(hdr + 12, g_otaCtx.pOtaPreamble->imageType, 2);
+    replay_put(hdr + 14, replay_otaVer, 4);
+    replay_put(hdr + OTA_STACK_VER_OFFSET, ZB_STACKVER_PRO, 2);
+    replay_put(hdr + 52, REPLAY_OTA_FILE_SIZE, 4);
+
+    replay_put(hdr + REPLAY_OTA_HDR_LEN, OTA_UPGRADE_IMAGE_TAG_ID, 2);
+    replay_put(hdr + REPLAY_OTA_HDR_LEN + 2, REPLAY_OTA_IMAGE_SIZE, 4);
+
+    for (u32 i = 0; i < REPLAY_OTA_IMAGE_SIZE; i++) {
+        seed = seed * 1103515245 + 12345;
+        img[i] = seed >> 16;
+    }
+    img[6] = 0x5d;
+    img[7] = 0x02;
+    /* the flag and "TLN", ota_mcuReboot() checks them */
+    img[FLASH_TLNK_FLAG_OFFSET] = REPLAY_OTA_START_FLAG;
+    replay_put(img + FLASH_TLNK_FLAG_OFFSET + 1, 0x544c4e, 3);
+    replay_put(img + 0x18, REPLAY_OTA_IMAGE_SIZE, 4);
+    replay_put(img + REPLAY_OTA_IMAGE_SIZE - 4, xcrc32(img, REPLAY_OTA_IMAGE_SIZE - 4, 0xffffffff), 4);
+}
+
+static void replay_otaAddr(zclIncomingAddrInfo_t *addrInfo) {
+    static const addrExt_t server = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    ZB_IEEE_ADDR_COPY(zcl_attr_upgradeServerID, server);
+
+    memset(addrInfo, 0, sizeof(zclIncomingAddrInfo_t));
+    addrInfo->dirCluster = ZCL_FRAME_SERVER_CLIENT_DIR;
+    addrInfo->dstEp = g_otaCtx.simpleDesc->endpoint;
+    addrInfo->srcEp = 1;
+    addrInfo->profileId = HA_PROFILE_ID;
+}
+
+int replay_ota(const char *cmd, unsigned int n) {
+    zclIncomingAddrInfo_t addrInfo;
+    ota_queryNextImageRsp_t nextRsp;
+    ota_imageBlockRsp_t blockRsp;
+    ota_upgradeEndRsp_t endRsp;
+    u8 block[REPLAY_OTA_BLOCK_SIZE];
+    u32 offset;
+
+    replay_otaBuild();
+    replay_otaAddr(&addrInfo);
+
+    if (!strcmp(cmd, "query") || !strcmp(cmd, "none")) {
+        memset(&nextRsp, 0, sizeof(nextRsp));
+        nextRsp.st = cmd[0] == 'q' ? ZCL_STA_SUCCESS : ZCL_STA_NO_IMAGE_AVAILABLE;
+        nextRsp.manuCode = g_otaCtx.pOtaPreamble->manufacturerCode;
+        nextRsp.imageType = g_otaCtx.pOtaPreamble->imageType;
+        nextRsp.fileVer = replay_otaVer;
+        nextRsp.imageSize = REPLAY_OTA_FILE_SIZE;
+
+        zcl_otaCb(&addrInfo, ZCL_CMD_OTA_QUERY_NEXT_IMAGE_RSP, &nextRsp);
+        replay_pass();
+    } else if (!strcmp(cmd, "blocks")) {
+        /* the blocks asked for, the last one ends the download */
+        for (; n && zcl_attr_imageUpgradeStatus == IMAGE_UPGRADE_STATUS_DOWNLOAD_IN_PROGRESS; n--) {
+            offset = zcl_attr_fileOffset;
+            memset(&blockRsp, 0, sizeof(blockRsp));
+            blockRsp.st = ZCL_STA_SUCCESS;
+            blockRsp.rsp.success.manuCode = g_otaCtx.pOtaPreamble->manufacturerCode;
+            blockRsp.rsp.success.imageType = g_otaCtx.pOtaPreamble->imageType;
+            blockRsp.rsp.success.fileVer = replay_otaVer;
+            blockRsp.rsp.success.fileOffset = offset;
+            blockRsp.rsp.success.dataSize = REPLAY_OTA_FILE_SIZE - offset < REPLAY_OTA_BLOCK_SIZE ?
+                                            REPLAY_OTA_FILE_SIZE - offset : REPLAY_OTA_BLOCK_SIZE;
+            memcpy(block, &replay_otaFile[offset], blockRsp.rsp.success.dataSize);
+            blockRsp.rsp.success.data = block;
+
+            zcl_otaCb(&addrInfo, ZCL_CMD_OTA_IMAGE_BLOCK_RSP, &blockRsp);
+            replay_pass();
+        }
+    } else if (!strcmp(cmd, "end")) {
+        /* upgrade now */
+        memset(&endRsp, 0, sizeof(endRsp));
+        endRsp.manuCode = g_otaCtx.pOtaPreamble->manufacturerCode;
+        endRsp.imageType = g_otaCtx.pOtaPreamble->imageType;
+        endRsp.fileVer = replay_otaVer;
+
+        zcl_otaCb(&addrInfo, ZCL_CMD_OTA_UPGRADE_END_RSP, &endRsp);
+        replay_pass();
+    } else {
+        return 0;
+    }
+
+    return 1;
+}
+
+/* as main(), the firmware is flashed at 0 first */
+void replay_boot() {
+
+    if (mcuBootAddrGet() == 0xFFFFFFFF) {
+        hal_flash_boot(0);
+    }
+
+    os_init(0);
+    user_init(0);
+    drv_enable_irq();
+}
+
+void replay_pass() {
+
+    ev_main();
+    tl_zbTaskProcedure();
+
+    /* SYSTEM_RESET() */
+    if (reg_pwdn_ctrl & REPLAY_RESET_BIT) {
+        replay_reset(0);
+    }
+}
+
+unsigned int replay_pin(const char *name) {
+
+    for (u8 i = 0; i < sizeof(replay_pins) / sizeof(replay_pins[0]); i++) {
+        if (!strcmp(replay_pins[i].name, name)) return replay_pins[i].pin;
+    }
+
+    return REPLAY_PIN_NONE;
+}
+
+int replay_value(const char *name, unsigned int ep, unsigned int cluster, unsigned int attr, unsigned long long *value) {
+    hal_zcl_rec_t *rec;
+
+    if (!strcmp(name, "hot")) {
+        *value = watermeter_config.counter_hot_water;
+    } else if (!strcmp(name, "cold")) {
+        *value = watermeter_config.counter_cold_water;
+    } else if (!strcmp(name, "attr")) {
+        *value = hal_zcl_attr(ep, cluster, attr);
+    } else if (!strcmp(name, "reports") || !strcmp(name, "sets")) {
+        rec = hal_zcl_rec(ep, cluster, attr);
+        if (!rec) return 0;
+        *value = name[0] == 'r' ? rec->reports : rec->sets;
+    } else if (!strcmp(name, "poll")) {
+        *value = hal_poll_rate;
+    } else if (!strcmp(name, "polls")) {
+        *value = hal_polls;
+    } else if (!strcmp(name, "rx")) {
+        *value = hal_rx_pending;
+    } else if (!strcmp(name, "tx")) {
+        *value = hal_tx_frames;
+    } else if (!strcmp(name, "flash_writes")) {
+        *value = hal_flash_writes;
+    } else if (!strcmp(name, "flash_erases")) {
+        *value = hal_flash_erases;
+    } else if (!strcmp(name, "ota_offset")) {
+        *value = zcl_attr_fileOffset;
+    } else if (!strcmp(name, "ota_status")) {
+        *value = zcl_attr_imageUpgradeStatus;
+    } else if (!strcmp(name, "new_ota")) {
+        *value = watermeter_config.new_ota;
+    } else if (!strcmp(name, "time")) {
+        *value = hal_now_us / 1000;
+    } else {
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,95 @@
+/*
+ * xcrc16() against the bitwise checksum() it replaced in app_dev_config.c, the
+ * records written by the old firmware must stay valid. Prints the cycles per
+ * byte of both, the host TSC, the ratio is what matters.
+ */
+#include "tl_common.h"
+
+#include "hal.h"
+
+#define CRC_BUF_SIZE            512
+#define CRC_BENCH_LOOPS         2000
+
+/* a config and a journal record as the old firmware wrote them, the crc is the last 2 bytes */
+static const u8 crc_config_rec[] = {
+    0x10, 0x14, 0xed, 0x0f, 0x00, 0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x20, 0x07, 0x00, 0x3a, 0xe2, 0x01, 0x00, 0x32, 0x09, 0x01, 0x00, 0x0a, 0xe3, 0x91
+};
+static const u8 crc_journal_rec[] = { 0x0a, 0x00, 0x14, 0x00, 0x7a, 0xf8 };
+
+static u8 crc_buf[CRC_BUF_SIZE];
+
+/* checksum() of app_dev_config.c before the table */
+static u16 crc_bitwise(const u8 *buf, int len, u16 crc) {
+
+    for (const u8 *ptr = buf; ptr < buf + len; ptr++) {
+        crc ^= *ptr;
+
+        for (u8 bit = 8; bit > 0; bit--) {
+            if (crc & 1)
+                crc = (crc >> 1) ^ 0xa010;
+            else
+                crc >>= 1;
+        }
+    }
+
+    return crc;
+}
+
+static void crc_check_rec(const u8 *rec, int len) {
+
+    HAL_CHECK_EQ(xcrc16(rec, len - 2, 0xffff), rec[len - 2] | (rec[len - 1] << 8));
+}
+
+static void crc_bench(int len) {
+    volatile u16 crc = 0;
+    unsigned long long t;
+    u32 bitwise, table;
+
+    t = __builtin_ia32_rdtsc();
+    for (u32 i = 0; i < CRC_BENCH_LOOPS; i++) crc += crc_bitwise(crc_buf, len, 0xffff);
+    bitwise = (__builtin_ia32_rdtsc() - t) * 100 / CRC_BENCH_LOOPS / len;
+
+    t = __builtin_ia32_rdtsc();
+    for (u32 i = 0; i < CRC_BENCH_LOOPS; i++) crc += xcrc16(crc_buf, len, 0xffff);
+    table = (__builtin_ia32_rdtsc() - t) * 100 / CRC_BENCH_LOOPS / len;
+
+    hal_printf("%3d bytes: bitwise %d.%02d, table %d.%02d cycles per byte\r\n",
+            len, bitwise / 100, bitwise % 100, table / 100, table % 100);
+}
+
+int main() {
+    u32 seed = 1;
+    u16 crc;
+
+    for (u32 i = 0; i < CRC_BUF_SIZE; i++) {
+        seed = seed * 1103515245 + 12345;
+        crc_buf[i] = seed >> 16;
+    }
+
+    /* "123456789", the check value of this poly with 0xffff */
+    HAL_CHECK_EQ(xcrc16((const u8*)"123456789", 9, 0xffff), 0xfe82);
+    HAL_CHECK_EQ(xcrc16(crc_buf, 0, 0x1234), 0x1234);
+
+    crc_check_rec(crc_config_rec, sizeof(crc_config_rec));
+    crc_check_rec(crc_journal_rec, sizeof(crc_journal_rec));
+
+    for (int len = 1; len <= CRC_BUF_SIZE; len++) {
+        if (xcrc16(crc_buf, len, 0xffff) != crc_bitwise(crc_buf, len, 0xffff)) {
+            HAL_CHECK_EQ(xcrc16(crc_buf, len, 0xffff), crc_bitwise(crc_buf, len, 0xffff));
+            break;
+        }
+    }
+
+    /* incremental, a record read in parts gives the same crc */
+    for (int part = 0; part <= CRC_BUF_SIZE; part += 37) {
+        crc = xcrc16(crc_buf, part, 0xffff);
+        HAL_CHECK_EQ(xcrc16(crc_buf + part, CRC_BUF_SIZE - part, crc), crc_bitwise(crc_buf, CRC_BUF_SIZE, 0xffff));
+    }
+
+    crc_bench(6);
+    crc_bench(28);
+    crc_bench(256);
+
+    return hal_result("test_crc");
+}
@@ -0,0 +1,176 @@
+/*
+ * The battery charge model of app_energy.c against the time spent in each
+ * power state: the poll scheme of the README for 30 days, a day of fast poll
+ * in suspend, an awake device with the radio on, the long sleeps counted in
+ * chunks and the charge kept over a restart. Prints the estimate and the
+ * reference, the clock_time() wraps are crossed.
+ */
+#include "tl_common.h"
+#include "zcl_include.h"
+
+#include "watermeter.h"
+
+#include "hal.h"
+
+#define ENERGY_US_PER_HOUR      3600000000ULL
+#define ENERGY_CAPACITY_UAH     (ENERGY_CAPACITY_DEF * 10000)
+
+extern void user_init(bool isRetention);
+
+static unsigned long long energy_refUAus;           /* uA * us  */
+static unsigned long long energy_refUs[ENERGY_MAX];
+static unsigned long long energy_refStart;
+
+/* the state goes on for us, the radio time as rf_stateTimeGet() counts it */
+static void energy_spend(u8 state, u32 us) {
+
+    if (state == ENERGY_TX) hal_rf_time[RF_STATE_TX] += us;
+    if (state == ENERGY_RX) hal_rf_time[RF_STATE_RX] += us;
+
+    hal_advance_us(us);
+    energy_refUs[state] += us;
+    energy_refUAus += (unsigned long long)g_zcl_powerAttrs.energyCurrent[state] * us;
+}
+
+/* a wake-up: the CPU, TX and RX of the poll, the CPU, then the sleep */
+static void energy_wake(u32 cpu, u32 tx, u32 rx, u32 sleep, u8 deep) {
+    u8 state = deep ? ENERGY_DEEP : ENERGY_SUSPEND;
+
+    energy_spend(ENERGY_ACTIVE, cpu / 2);
+    energy_spend(ENERGY_TX, tx);
+    energy_spend(ENERGY_RX, rx);
+    energy_spend(ENERGY_ACTIVE, cpu - cpu / 2);
+    energy_handler();
+
+    energy_sleep();
+    energy_spend(state, sleep);
+    energy_wakeup(state);
+}
+
+/* within 1 + 0.01% */
+static u8 energy_near(unsigned long long v, unsigned long long ref) {
+
+    return v + 1 + ref / 10000 >= ref && v <= ref + 1 + ref / 10000;
+}
+
+static void energy_check(const char *name) {
+    unsigned long long uAh = energy_refUAus / ENERGY_US_PER_HOUR;
+
+    energy_estimate();
+
+    hal_printf("%s: %d uAh (%d), average %d x 0.1 uA, %d days, time %d/%d/%d/%d/%d sec\r\n",
+            name, g_zcl_powerAttrs.energyConsumed, (u32)uAh, g_zcl_powerAttrs.energyAverage,
+            g_zcl_powerAttrs.energyRemaining, g_zcl_powerAttrs.energyTime[ENERGY_ACTIVE],
+            g_zcl_powerAttrs.energyTime[ENERGY_RX], g_zcl_powerAttrs.energyTime[ENERGY_TX],
+            g_zcl_powerAttrs.energyTime[ENERGY_SUSPEND], g_zcl_powerAttrs.energyTime[ENERGY_DEEP]);
+
+    HAL_CHECK(energy_near(g_zcl_powerAttrs.energyConsumed, uAh));
+    for (u8 i = 0; i < ENERGY_MAX; i++) {
+        if (!energy_near(g_zcl_powerAttrs.energyTime[i], energy_refUs[i] / 1000000)) {
+            hal_printf("state %d: %d sec, %d expected\r\n", i, g_zcl_powerAttrs.energyTime[i], (u32)(energy_refUs[i] / 1000000));
+            HAL_CHECK(energy_near(g_zcl_powerAttrs.energyTime[i], energy_refUs[i] / 1000000));
+        }
+    }
+}
+
+/* a new battery, nothing in NV */
+static void energy_reset() {
+
+    nv_resetModule(NV_MODULE_APP);
+    energy_refUAus = 0;
+    memset(energy_refUs, 0, sizeof(energy_refUs));
+    energy_refStart = hal_now_us;
+
+    energy_init();
+}
+
+/* 10 polls 3 sec apart, 5 min of sleep, for 30 days */
+static void energy_readme() {
+    u32 average, days;
+
+    energy_reset();
+
+    for (u32 d = 0; d < 30; d++) {
+        for (u32 c = 0; c < 24 * 3600 / 330; c++) {
+            for (u8 k = 0; k < 10; k++) energy_wake(3000, 600, 2500, 3000000 - 6100, 1);
+            energy_wake(3000, 600, 2500, 300000000, 1);
+            /* batteryCb() each 15 min */
+            if (c % 3 == 0) energy_estimate();
+        }
+    }
+
+    energy_check("readme ");
+
+    average = (u32)(energy_refUAus * 10 / (hal_now_us - energy_refStart));
+    days = (ENERGY_CAPACITY_UAH - g_zcl_powerAttrs.energyConsumed) * 10 / average / 24;
+
+    hal_printf("         average %d x 0.1 uA, %d days expected\r\n", average, days);
+
+    HAL_CHECK(g_zcl_powerAttrs.energyAverage + 1 >= average && g_zcl_powerAttrs.energyAverage <= average + 1);
+    HAL_CHECK(g_zcl_powerAttrs.energyRemaining * 20 >= days * 19 && g_zcl_powerAttrs.energyRemaining * 20 <= days * 21);
+}
+
+/* the fast poll each 250 ms in suspend, a day */
+static void energy_suspend() {
+
+    energy_reset();
+
+    for (u32 k = 0; k < 4 * 3600 * 24; k++) {
+        energy_wake(1500, 400, 1200, 250000 - 3100, 0);
+        if (k % 3600 == 0) energy_estimate();
+    }
+
+    energy_check("suspend");
+}
+
+/* not joined, 10 min awake with the radio in RX, a pass of app_task() each 10 ms */
+static void energy_awake() {
+
+    energy_reset();
+
+    for (u32 k = 0; k < 60000; k++) {
+        energy_spend(ENERGY_RX, 10000);
+        energy_handler();
+    }
+
+    energy_check("awake  ");
+}
+
+/* long sleeps, the charge is counted in chunks */
+static void energy_chunks() {
+    u32 consumed;
+
+    energy_reset();
+
+    g_zcl_powerAttrs.energyCurrent[ENERGY_DEEP] = 60000;
+    energy_cfgSave();
+
+    for (u8 k = 0; k < 10; k++) energy_wake(1000, 0, 0, ENERGY_US_PER_HOUR, 1);
+
+    energy_check("chunks ");
+
+    /* the charge and the model are kept in NV over a restart */
+    consumed = g_zcl_powerAttrs.energyConsumed;
+    energy_save();
+    energy_init();
+
+    HAL_CHECK_EQ(g_zcl_powerAttrs.energyConsumed, consumed);
+    HAL_CHECK_EQ(g_zcl_powerAttrs.energyCurrent[ENERGY_DEEP], 60000);
+}
+
+int main() {
+
+    hal_init(NULL, 1);
+    hal_flash_boot(0);
+
+    os_init(0);
+    user_init(0);
+    hal_task_run();
+
+    energy_readme();
+    energy_suspend();
+    energy_awake();
+    energy_chunks();
+
+    return hal_result("test_energy");
+}
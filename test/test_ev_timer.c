@@ -0,0 +1,154 @@
+/*
+ * ev_timer: the order of the callbacks, restart and cancel, the callbacks
+ * that restart or cancel timers. Prints the cycles of a wake-up, the timers
+ * are expired and restarted, with 8, 32 and 64 periodic timers running.
+ */
+#include "tl_common.h"
+
+#include "hal.h"
+
+#define TIMER_LOG_SIZE          16
+#define TIMER_BENCH_MAX         64
+#define TIMER_BENCH_WAKES       2000
+
+static u8 timer_log[TIMER_LOG_SIZE];
+static u8 timer_logCnt = 0;
+static s32 timer_ret = -1;
+static ev_timer_event_t *timer_cancel = NULL;       /* cancelled by the next callback   */
+static ev_timer_event_t timer_benchEvt[TIMER_BENCH_MAX];
+static u32 timer_benchCnt = 0;
+
+static s32 timer_cb(void *arg) {
+
+    if (timer_logCnt < TIMER_LOG_SIZE) timer_log[timer_logCnt++] = (u8)(u32)arg;
+
+    if (timer_cancel) {
+        ev_timer_taskCancel(&timer_cancel);
+    }
+
+    return timer_ret;
+}
+
+static s32 timer_benchCb(void *arg) {
+
+    timer_benchCnt++;
+
+    return 0;
+}
+
+/* the time goes on, as the main loop */
+static void timer_run(u32 ms) {
+
+    for (u32 i = 0; i < ms; i++) {
+        hal_advance_us(1000);
+        ev_timer_process();
+    }
+}
+
+static void timer_logCheck(const u8 *expected, u8 n) {
+
+    HAL_CHECK_EQ(timer_logCnt, n);
+    for (u8 i = 0; i < n && i < timer_logCnt; i++) {
+        HAL_CHECK_EQ(timer_log[i], expected[i]);
+    }
+    timer_logCnt = 0;
+}
+
+static void timer_test() {
+    static const u8 order[] = { 1, 2, 3, 4, 5 };
+    static const u8 periodic[] = { 1, 1, 1 };
+    ev_timer_event_t *evt[5], *t;
+
+    ev_timer_init();
+    ev_timer_setPrevSysTick(clock_time());
+
+    /* by deadline, the same deadline in the order of adding */
+    evt[4] = TL_ZB_TIMER_SCHEDULE(timer_cb, (void*)5, 300);
+    evt[1] = TL_ZB_TIMER_SCHEDULE(timer_cb, (void*)2, 100);
+    evt[0] = TL_ZB_TIMER_SCHEDULE(timer_cb, (void*)1, 50);
+    evt[2] = TL_ZB_TIMER_SCHEDULE(timer_cb, (void*)3, 100);
+    evt[3] = TL_ZB_TIMER_SCHEDULE(timer_cb, (void*)4, 200);
+    HAL_CHECK(ev_timer_nearestGet() == evt[0]);
+    timer_run(49);
+    HAL_CHECK_EQ(timer_logCnt, 0);
+    timer_run(300);
+    timer_logCheck(order, 5);
+    HAL_CHECK(ev_timer_nearestGet() == NULL);
+    HAL_CHECK(ev_timer_enough());
+
+    /* cancel, a restart moves the deadline */
+    evt[0] = TL_ZB_TIMER_SCHEDULE(timer_cb, (void*)1, 100);
+    evt[1] = TL_ZB_TIMER_SCHEDULE(timer_cb, (void*)2, 100);
+    t = evt[1];
+    HAL_CHECK_EQ(TL_ZB_TIMER_CANCEL(&evt[1]), SUCCESS);
+    HAL_CHECK(evt[1] == NULL);
+    HAL_CHECK(!ev_timer_exist(t));
+    timer_run(50);
+    ev_on_timer(evt[0], 100);
+    timer_run(99);
+    HAL_CHECK_EQ(timer_logCnt, 0);
+    timer_run(1);
+    timer_logCheck(order, 1);
+
+    /* periodic, 0 keeps the period */
+    timer_ret = 0;
+    evt[0] = TL_ZB_TIMER_SCHEDULE(timer_cb, (void*)1, 10);
+    timer_run(35);
+    timer_logCheck(periodic, 3);
+    HAL_CHECK_EQ(ev_timer_remainGet(evt[0]), 5);
+    HAL_CHECK_EQ(TL_ZB_TIMER_CANCEL(&evt[0]), SUCCESS);
+
+    /* a callback cancels a timer expired at the same time, it is not called */
+    timer_ret = -1;
+    evt[0] = TL_ZB_TIMER_SCHEDULE(timer_cb, (void*)1, 10);
+    timer_cancel = TL_ZB_TIMER_SCHEDULE(timer_cb, (void*)2, 10);
+    timer_run(20);
+    timer_logCheck(order, 1);
+    HAL_CHECK(timer_cancel == NULL);
+
+    /* a long sleep, all expired at once */
+    evt[0] = TL_ZB_TIMER_SCHEDULE(timer_cb, (void*)1, 1000);
+    evt[1] = TL_ZB_TIMER_SCHEDULE(timer_cb, (void*)2, 60000);
+    hal_advance_us(3600000000U);
+    ev_timer_process();
+    timer_logCheck(order, 2);
+}
+
+static void timer_bench(u32 n) {
+    ev_timer_event_t *nearest;
+    unsigned long long t, cycles = 0;
+
+    ev_timer_init();
+    ev_timer_setPrevSysTick(clock_time());
+    timer_benchCnt = 0;
+
+    for (u32 i = 0; i < n; i++) {
+        timer_benchEvt[i].cb = timer_benchCb;
+        ev_on_timer(&timer_benchEvt[i], 1000 + i * 37);
+    }
+
+    for (u32 i = 0; i < TIMER_BENCH_WAKES; i++) {
+        nearest = ev_timer_nearestGet();
+        hal_advance_us(ev_timer_remainGet(nearest) * 1000);
+        t = __builtin_ia32_rdtsc();
+        ev_timer_process();
+        cycles += __builtin_ia32_rdtsc() - t;
+    }
+
+    HAL_CHECK(timer_benchCnt >= TIMER_BENCH_WAKES);
+
+    hal_printf("%2d timers: %d cycles per wake-up, %d callbacks\r\n", n, (u32)(cycles / TIMER_BENCH_WAKES), timer_benchCnt);
+}
+
+int main() {
+
+    hal_init(NULL, 1);
+
+    timer_test();
+
+    timer_bench(8);
+    timer_bench(32);
+    timer_bench(64);
+
+    return hal_result("test_ev_timer");
+}
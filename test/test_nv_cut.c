@@ -0,0 +1,175 @@
+/*
+ * Power cut at every flash write and erase of an NV workload, the background
+ * compaction included. After the restart each item reads back as its last
+ * committed version or as the one being written, and the NV keeps working.
+ * drv_nv.c is included to clear its RAM on the restart.
+ */
+#include "../tl_zigbee_sdk/proj/drivers/drv_nv.c"
+#include "zb_api.h"
+
+#include "hal.h"
+
+#define NV_TEST_ITEMS           3
+#define NV_TEST_ITEM_ID         0x30
+#define NV_TEST_WRITES          400
+#define NV_TEST_MORE            60                  /* after the restart */
+#define NV_TEST_IDLE_STEPS      1000
+#define NV_TEST_FAILS_MAX       5
+
+static const u16 nv_itemLen[NV_TEST_ITEMS] = { 40, 100, 8 };
+static u32 nv_committed[NV_TEST_ITEMS];
+static u32 nv_pending[NV_TEST_ITEMS];               /* being written at the cut */
+static u32 nv_stepsMax = 0;
+static u32 nv_erasesFg = 0;                         /* in nv_flashWriteNew()    */
+static u8 nv_formatted = 0;
+
+/* the version in the first 4 bytes, the rest follows from it */
+static void nv_fill(u8 *buf, u8 item, u32 ver) {
+
+    for (u16 i = 0; i < nv_itemLen[item]; i++) buf[i] = (u8)(ver * 31 + i * 7 + item);
+    memcpy(buf, &ver, 4);
+}
+
+/* 0 - no item, 1 - valid, -1 - broken */
+static s8 nv_itemVer(u8 item, u32 *ver) {
+    u8 buf[128], expected[128];
+
+    if (nv_flashReadNew(1, NV_MODULE_APP, NV_TEST_ITEM_ID + item, nv_itemLen[item], buf) != NV_SUCC) return 0;
+
+    memcpy(ver, buf, 4);
+    nv_fill(expected, item, *ver);
+
+    return memcmp(buf, expected, nv_itemLen[item]) ? -1 : 1;
+}
+
+/* the main loop while the device is idle */
+static void nv_idle() {
+    u32 n = 0;
+
+    while (n < NV_TEST_IDLE_STEPS && nv_compactStep()) n++;
+
+    if (n > nv_stepsMax) nv_stepsMax = n;
+}
+
+/* versions from..from + n round robin, the big item less often */
+static void nv_workload(u32 from, u32 n) {
+    u8 buf[128];
+    u32 erases;
+    u8 item;
+
+    for (u32 ver = from; ver < from + n; ver++) {
+        item = ver % NV_TEST_ITEMS;
+        if (item == 1 && (ver % 7)) continue;
+
+        nv_pending[item] = ver;
+        nv_fill(buf, item, ver);
+
+        erases = hal_flash_erases;
+        if (nv_flashWriteNew(1, NV_MODULE_APP, NV_TEST_ITEM_ID + item, nv_itemLen[item], buf) == NV_SUCC) {
+            nv_committed[item] = ver;
+        }
+        /* the first write formats the module */
+        if (nv_formatted) nv_erasesFg += hal_flash_erases - erases;
+        nv_formatted = 1;
+
+        if (ver % 3 == 0) nv_idle();
+    }
+
+    nv_idle();
+}
+
+static u8 nv_verify(const char *step, u32 cut) {
+    u32 ver;
+    s8 r;
+
+    for (u8 i = 0; i < NV_TEST_ITEMS; i++) {
+        ver = 0;
+        r = nv_itemVer(i, &ver);
+        if (!nv_committed[i] && !nv_pending[i]) continue;
+        if (r == 1 && (ver == nv_committed[i] || ver == nv_pending[i])) continue;
+        if (r == 0 && !nv_committed[i]) continue;
+
+        hal_printf("%s, cut at %d: item %d is %d ver %d, committed %d, pending %d\r\n",
+                step, cut, i, r, ver, nv_committed[i], nv_pending[i]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/* the RAM is lost, the flash is kept */
+static void nv_restart() {
+
+    memset(&g_nvCompact, 0, sizeof(g_nvCompact));
+#if NV_INDEX_CACHE_ENABLE
+    memset(g_nvIdxCache, 0, sizeof(g_nvIdxCache));
+#endif
+    nv_init(0);
+}
+
+static void nv_start() {
+
+    hal_flash_erase_all();
+    nv_formatted = 0;
+    nv_restart();
+    memset(nv_committed, 0, sizeof(nv_committed));
+    memset(nv_pending, 0, sizeof(nv_pending));
+}
+
+int main() {
+    static void *env[5];
+    u32 ops, writes, erases, fails = 0;
+
+    hal_init(NULL, 1);
+    os_init(0);
+
+    /* without a cut, the count of the flash ops */
+    nv_start();
+    ops = hal_flash_ops;
+    writes = hal_flash_writes;
+    erases = hal_flash_erases;
+    nv_workload(1, NV_TEST_WRITES);
+    ops = hal_flash_ops - ops;
+
+    for (u8 i = 0; i < NV_TEST_ITEMS; i++) HAL_CHECK_EQ(nv_committed[i], nv_pending[i]);
+    HAL_CHECK(!nv_verify("no cut", 0));
+    HAL_CHECK_EQ(nv_erasesFg, 0);
+
+    hal_printf("%d flash writes, %d erases, %d in nv_flashWriteNew(), at most %d steps per idle\r\n",
+            hal_flash_writes - writes, hal_flash_erases - erases, nv_erasesFg, nv_stepsMax);
+
+    for (u32 cut = 1; cut <= ops && fails < NV_TEST_FAILS_MAX; cut++) {
+        nv_start();
+        hal_flash_cut(cut, env);
+        if (!__builtin_setjmp(env)) {
+            nv_workload(1, NV_TEST_WRITES);
+            hal_flash_cut(0, NULL);
+            hal_printf("no cut at %d\r\n", cut);
+            fails++;
+            continue;
+        }
+
+        nv_restart();
+        if (nv_verify("after the cut", cut)) {
+            fails++;
+            continue;
+        }
+
+        memset(nv_committed, 0, sizeof(nv_committed));
+        memset(nv_pending, 0, sizeof(nv_pending));
+        nv_workload(NV_TEST_WRITES + 1, NV_TEST_MORE);
+        for (u8 i = 0; i < NV_TEST_ITEMS; i++) {
+            if (nv_committed[i] != nv_pending[i]) {
+                hal_printf("cut at %d: item %d is not written after the restart\r\n", cut, i);
+                fails++;
+                break;
+            }
+        }
+        if (nv_verify("after the restart", cut)) fails++;
+    }
+
+    hal_printf("power cut at each of %d flash ops: %d failures\r\n", ops, fails);
+    HAL_CHECK_EQ(fails, 0);
+
+    return hal_result("test_nv_cut");
+}
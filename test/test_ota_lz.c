@@ -0,0 +1,376 @@
+/*
+ * The OTA_UPGRADE_IMAGE_LZ_TAG_ID decoder of ota.c through zcl_otaCb(), the
+ * test is the server: a plain image, a compressed one, a delta to the running
+ * image and a delta to another image, which is rejected at its header. The image in flash must be the one encoded. A checkpoint of the
+ * layout before the decoder or of another OTA_CLIENT_INFO_VER is dropped.
+ * Prints the element sizes.
+ */
+#include "tl_common.h"
+#include "zcl_include.h"
+#include "ota.h"
+
+#include "watermeter.h"
+
+#include "hal.h"
+
+#define OTA_TEST_HDR_LEN        56
+#define OTA_TEST_ELEM_HDR_LEN   6
+#define OTA_TEST_IMAGE_SIZE     60000
+#define OTA_TEST_FILE_MAX       (OTA_TEST_HDR_LEN + OTA_TEST_ELEM_HDR_LEN + OTA_TEST_IMAGE_SIZE * 2)
+#define OTA_TEST_BLOCK_SIZE     48
+#define OTA_TEST_IMAGE_ADDR     0x40000             /* the app runs at 0 */
+#define OTA_TEST_START_FLAG     0x4b                /* TL_IMAGE_START_FLAG of ota.c */
+#define OTA_TEST_SIZE_OFFSET    0x18                /* TL_IMAGE_SIZE_OFFSET of ota.c */
+
+/* the token stream of ota.c */
+#define LZ_HDR_LEN              8
+#define LZ_CNT_MAX              4096
+#define LZ_CNT_EXT              0x3f
+#define LZ_LITERAL              0x00
+#define LZ_COPY_NEW             0x40
+#define LZ_COPY_RUN             0x80
+#define LZ_MATCH_MIN            16
+#define LZ_HINTS_MAX            4
+
+#define LZ_PERIOD               20000               /* the compressed image repeats itself    */
+#define LZ_CUT_POS              30000               /* the delta, bytes removed from the base */
+#define LZ_CUT_LEN              300
+
+/* ota_updateInfo_t of ota.c, NV_ITEM_OTA_HDR_SERVERINFO */
+typedef struct _attribute_packed_ {
+    ota_hdrFields_t hdrInfo;
+    u8              server[12];
+} ota_testUpdateInfo_t;
+
+typedef struct {
+    u8          type;
+    s32         shift[LZ_HINTS_MAX];                /* source - position, the match is tried there */
+    u8          num;
+} lz_hints_t;
+
+extern ota_ctx_t g_otaCtx;
+extern void user_init(bool isRetention);
+extern void ota_clientInfoRecover(void);
+
+static u8 ota_file[OTA_TEST_FILE_MAX];
+static u8 ota_image[OTA_TEST_IMAGE_SIZE];
+static u8 ota_base[OTA_TEST_IMAGE_SIZE];
+static u32 ota_fileVer;
+
+static void ota_put(u8 *p, u32 v, u8 len) {
+
+    for (u8 i = 0; i < len; i++) p[i] = v >> (8 * i);
+}
+
+static void ota_random(u8 *img, u32 len, u32 seed) {
+
+    for (u32 i = 0; i < len; i++) {
+        seed = seed * 1103515245 + 12345;
+        img[i] = seed >> 16;
+    }
+}
+
+/* the fields the client checks: 0x5d02, the start flag, the size and the crc at the end */
+static void ota_imageFix(u8 *img, u32 len) {
+
+    img[6] = 0x5d;
+    img[7] = 0x02;
+    img[FLASH_TLNK_FLAG_OFFSET] = OTA_TEST_START_FLAG;
+    ota_put(img + FLASH_TLNK_FLAG_OFFSET + 1, 0x544c4e, 3);
+    ota_put(img + OTA_TEST_SIZE_OFFSET, len, 4);
+    ota_put(img + len - 4, xcrc32(img, len - 4, 0xffffffff), 4);
+}
+
+static u32 lz_cnt(u8 *out, u8 type, u32 cnt) {
+
+    if (cnt <= LZ_CNT_EXT) {
+        out[0] = type | (cnt - 1);
+        return 1;
+    }
+
+    out[0] = type | LZ_CNT_EXT;
+    ota_put(out + 1, cnt - LZ_CNT_EXT - 1, 2);
+    return 3;
+}
+
+static u32 lz_literal(u8 *out, const u8 *img, u32 pos, u32 cnt) {
+    u32 n = lz_cnt(out, LZ_LITERAL, cnt);
+
+    memcpy(out + n, img + pos - cnt, cnt);
+    return n + cnt;
+}
+
+/* greedy, a copy where one of the hints matches LZ_MATCH_MIN bytes or more */
+static u32 lz_encode(u8 *out, const u8 *img, u32 len, const lz_hints_t *hints, u32 baseCrc) {
+    u32 n = LZ_HDR_LEN, pos = 0, literal = 0, best, bestSrc = 0, src, max, m;
+    const u8 *from = hints->type == LZ_COPY_RUN ? ota_base : img;
+
+    ota_put(out, len, 4);
+    ota_put(out + 4, baseCrc, 4);
+
+    while (pos < len) {
+        best = 0;
+        for (u8 h = 0; h < hints->num; h++) {
+            if ((s32)pos + hints->shift[h] < 0) continue;
+            src = pos + hints->shift[h];
+            /* a copy of the new image never overlaps the output */
+            max = hints->type == LZ_COPY_RUN ? OTA_TEST_IMAGE_SIZE - src : pos - src;
+            if (hints->type == LZ_COPY_NEW && src >= pos) continue;
+            if (max > len - pos) max = len - pos;
+            if (max > LZ_CNT_MAX) max = LZ_CNT_MAX;
+            for (m = 0; m < max && from[src + m] == img[pos + m]; m++);
+            if (m > best) {
+                best = m;
+                bestSrc = src;
+            }
+        }
+
+        if (best >= LZ_MATCH_MIN) {
+            if (literal) n += lz_literal(out + n, img, pos, literal);
+            literal = 0;
+            n += lz_cnt(out + n, hints->type, best);
+            ota_put(out + n, bestSrc, 3);
+            n += 3;
+            pos += best;
+        } else {
+            pos++;
+            if (++literal == LZ_CNT_MAX) {
+                n += lz_literal(out + n, img, pos, literal);
+                literal = 0;
+            }
+        }
+    }
+
+    if (literal) n += lz_literal(out + n, img, pos, literal);
+
+    return n;
+}
+
+/* the file header and one element, returns the file size */
+static u32 ota_fileBuild(u16 tag, const u8 *elem, u32 elemLen) {
+    u8 *hdr = ota_file;
+    u32 fileLen = OTA_TEST_HDR_LEN + OTA_TEST_ELEM_HDR_LEN + elemLen;
+
+    ota_fileVer = g_otaCtx.pOtaPreamble->fileVer + 1;
+
+    memset(ota_file, 0, sizeof(ota_file));
+
+    ota_put(hdr, OTA_UPGRADE_FILE_ID, 4);
+    ota_put(hdr + 4, 0x0100, 2);
+    ota_put(hdr + OTA_HDR_LEN_OFFSET, OTA_TEST_HDR_LEN, 2);
+    ota_put(hdr + 10, g_otaCtx.pOtaPreamble->manufacturerCode, 2);
+    ota_put(hdr + 12, g_otaCtx.pOtaPreamble->imageType, 2);
+    ota_put(hdr + 14, ota_fileVer, 4);
+    ota_put(hdr + OTA_STACK_VER_OFFSET, ZB_STACKVER_PRO, 2);
+    ota_put(hdr + 52, fileLen, 4);
+
+    ota_put(hdr + OTA_TEST_HDR_LEN, tag, 2);
+    ota_put(hdr + OTA_TEST_HDR_LEN + 2, elemLen, 4);
+    memcpy(hdr + OTA_TEST_HDR_LEN + OTA_TEST_ELEM_HDR_LEN, elem, elemLen);
+
+    return fileLen;
+}
+
+static u32 ota_lastOffset;                          /* of the last block sent */
+
+/* returns zcl_attr_imageUpgradeStatus at the end */
+static u8 ota_download(u32 fileLen) {
+    static const addrExt_t server = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    zclIncomingAddrInfo_t addrInfo;
+    ota_queryNextImageRsp_t nextRsp;
+    ota_imageBlockRsp_t blockRsp;
+    u8 block[OTA_TEST_BLOCK_SIZE];
+    u32 offset;
+
+    ZB_IEEE_ADDR_COPY(zcl_attr_upgradeServerID, server);
+
+    memset(&addrInfo, 0, sizeof(addrInfo));
+    addrInfo.dirCluster = ZCL_FRAME_SERVER_CLIENT_DIR;
+    addrInfo.dstEp = g_otaCtx.simpleDesc->endpoint;
+    addrInfo.srcEp = 1;
+    addrInfo.profileId = HA_PROFILE_ID;
+
+    nextRsp.st = ZCL_STA_SUCCESS;
+    nextRsp.manuCode = g_otaCtx.pOtaPreamble->manufacturerCode;
+    nextRsp.imageType = g_otaCtx.pOtaPreamble->imageType;
+    nextRsp.fileVer = ota_fileVer;
+    nextRsp.imageSize = fileLen;
+
+    zcl_otaCb(&addrInfo, ZCL_CMD_OTA_QUERY_NEXT_IMAGE_RSP, &nextRsp);
+    HAL_CHECK_EQ(zcl_attr_imageUpgradeStatus, IMAGE_UPGRADE_STATUS_DOWNLOAD_IN_PROGRESS);
+
+    while (zcl_attr_imageUpgradeStatus == IMAGE_UPGRADE_STATUS_DOWNLOAD_IN_PROGRESS) {
+        offset = ota_lastOffset = zcl_attr_fileOffset;
+        memset(&blockRsp, 0, sizeof(blockRsp));
+        blockRsp.st = ZCL_STA_SUCCESS;
+        blockRsp.rsp.success.manuCode = nextRsp.manuCode;
+        blockRsp.rsp.success.imageType = nextRsp.imageType;
+        blockRsp.rsp.success.fileVer = ota_fileVer;
+        blockRsp.rsp.success.fileOffset = offset;
+        blockRsp.rsp.success.dataSize = fileLen - offset < OTA_TEST_BLOCK_SIZE ? fileLen - offset : OTA_TEST_BLOCK_SIZE;
+        memcpy(block, &ota_file[offset], blockRsp.rsp.success.dataSize);
+        blockRsp.rsp.success.data = block;
+
+        zcl_otaCb(&addrInfo, ZCL_CMD_OTA_IMAGE_BLOCK_RSP, &blockRsp);
+        hal_task_run();
+
+        if (zcl_attr_fileOffset == offset) break;
+    }
+
+    return zcl_attr_imageUpgradeStatus;
+}
+
+/* the slot holds the image, the start flag is set after the reboot */
+static void ota_imageCheck(const char *name, u32 elemLen) {
+    u8 flag = ota_image[FLASH_TLNK_FLAG_OFFSET];
+
+    ota_image[FLASH_TLNK_FLAG_OFFSET] = 0xff;
+    HAL_CHECK(!memcmp(&hal_flash[OTA_TEST_IMAGE_ADDR], ota_image, OTA_TEST_IMAGE_SIZE));
+    ota_image[FLASH_TLNK_FLAG_OFFSET] = flag;
+
+    hal_printf("%s: %d bytes image, %d bytes element\r\n", name, OTA_TEST_IMAGE_SIZE, elemLen);
+}
+
+static void ota_plain() {
+    u32 fileLen;
+
+    ota_random(ota_image, OTA_TEST_IMAGE_SIZE, 7);
+    ota_imageFix(ota_image, OTA_TEST_IMAGE_SIZE);
+
+    fileLen = ota_fileBuild(OTA_UPGRADE_IMAGE_TAG_ID, ota_image, OTA_TEST_IMAGE_SIZE);
+    HAL_CHECK_EQ(ota_download(fileLen), IMAGE_UPGRADE_STATUS_DOWNLOAD_COMPLETE);
+    ota_imageCheck("plain     ", OTA_TEST_IMAGE_SIZE);
+}
+
+/* copies from the image already written, some of them still in the page buffer */
+static void ota_compressed() {
+    static u8 elem[OTA_TEST_IMAGE_SIZE * 2];
+    lz_hints_t hints = { LZ_COPY_NEW, { -LZ_PERIOD, -LZ_PERIOD * 2, -1 }, 3 };
+    u32 elemLen, fileLen;
+
+    ota_random(ota_image, LZ_PERIOD, 11);
+    for (u32 i = LZ_PERIOD; i < OTA_TEST_IMAGE_SIZE; i++) {
+        ota_image[i] = ota_image[i - LZ_PERIOD];
+    }
+    /* a run of one byte, copies of the previous byte */
+    memset(ota_image + LZ_PERIOD + 100, 0x55, 500);
+    for (u32 i = LZ_PERIOD; i < OTA_TEST_IMAGE_SIZE; i += 997) ota_image[i] ^= 0xa5;
+    ota_imageFix(ota_image, OTA_TEST_IMAGE_SIZE);
+
+    elemLen = lz_encode(elem, ota_image, OTA_TEST_IMAGE_SIZE, &hints, 0);
+    HAL_CHECK(elemLen < OTA_TEST_IMAGE_SIZE / 2);
+
+    fileLen = ota_fileBuild(OTA_UPGRADE_IMAGE_LZ_TAG_ID, elem, elemLen);
+    HAL_CHECK_EQ(ota_download(fileLen), IMAGE_UPGRADE_STATUS_DOWNLOAD_COMPLETE);
+    ota_imageCheck("compressed", elemLen);
+}
+
+/* the base is the running image, a part of it is removed and some bytes change */
+static u32 ota_deltaBuild(u8 *elem, u32 baseCrc) {
+    lz_hints_t hints = { LZ_COPY_RUN, { 0, LZ_CUT_LEN }, 2 };
+    u32 len = OTA_TEST_IMAGE_SIZE - LZ_CUT_LEN;
+
+    memcpy(ota_image, ota_base, LZ_CUT_POS);
+    memcpy(ota_image + LZ_CUT_POS, ota_base + LZ_CUT_POS + LZ_CUT_LEN, len - LZ_CUT_POS);
+    for (u32 i = 1000; i < len; i += 7919) ota_image[i] ^= 0x3c;
+    ota_imageFix(ota_image, len);
+
+    return lz_encode(elem, ota_image, len, &hints, baseCrc);
+}
+
+static void ota_delta() {
+    static u8 elem[OTA_TEST_IMAGE_SIZE * 2];
+    u32 elemLen, fileLen;
+
+    elemLen = ota_deltaBuild(elem, ota_base[OTA_TEST_IMAGE_SIZE - 4] | ota_base[OTA_TEST_IMAGE_SIZE - 3] << 8 |
+                                   ota_base[OTA_TEST_IMAGE_SIZE - 2] << 16 | (u32)ota_base[OTA_TEST_IMAGE_SIZE - 1] << 24);
+    HAL_CHECK(elemLen < 1000);
+
+    fileLen = ota_fileBuild(OTA_UPGRADE_IMAGE_LZ_TAG_ID, elem, elemLen);
+    HAL_CHECK_EQ(ota_download(fileLen), IMAGE_UPGRADE_STATUS_DOWNLOAD_COMPLETE);
+
+    /* the image is shorter, the rest of the slot stays erased */
+    HAL_CHECK(!memcmp(&hal_flash[OTA_TEST_IMAGE_ADDR], ota_image, FLASH_TLNK_FLAG_OFFSET));
+    HAL_CHECK(!memcmp(&hal_flash[OTA_TEST_IMAGE_ADDR + FLASH_TLNK_FLAG_OFFSET + 1], ota_image + FLASH_TLNK_FLAG_OFFSET + 1,
+                      OTA_TEST_IMAGE_SIZE - LZ_CUT_LEN - FLASH_TLNK_FLAG_OFFSET - 1));
+    HAL_CHECK_EQ(hal_flash[OTA_TEST_IMAGE_ADDR + OTA_TEST_IMAGE_SIZE - LZ_CUT_LEN], 0xff);
+
+    hal_printf("delta     : %d bytes image, %d bytes element\r\n", OTA_TEST_IMAGE_SIZE - LZ_CUT_LEN, elemLen);
+}
+
+/* made against another image, nothing is written to the slot */
+static void ota_wrongBase() {
+    static u8 elem[OTA_TEST_IMAGE_SIZE * 2];
+    u32 elemLen, fileLen;
+
+    elemLen = ota_deltaBuild(elem, 0x12345678);
+    fileLen = ota_fileBuild(OTA_UPGRADE_IMAGE_LZ_TAG_ID, elem, elemLen);
+
+    HAL_CHECK_EQ(ota_download(fileLen), IMAGE_UPGRADE_STATUS_NORMAL);
+    /* the block of the element header, no image byte is decoded */
+    HAL_CHECK_EQ(ota_lastOffset / OTA_TEST_BLOCK_SIZE, (OTA_TEST_HDR_LEN + OTA_TEST_ELEM_HDR_LEN + LZ_HDR_LEN - 1) / OTA_TEST_BLOCK_SIZE);
+    HAL_CHECK(!ota_clientInfoResumable());
+
+    hal_printf("wrong base: rejected in the block at %d\r\n", ota_lastOffset);
+}
+
+/* a checkpoint which would be resumed, of the layout given */
+static void ota_checkpoint(u8 *info, u16 len) {
+    ota_testUpdateInfo_t hdr;
+    u16 size;
+
+    memset(&hdr, 0xff, sizeof(hdr));
+    hdr.hdrInfo.otaUpgradeFileID = OTA_UPGRADE_FILE_ID;
+    hdr.hdrInfo.fileVer = ota_fileVer;
+    hdr.hdrInfo.totalImageSize = 100000;
+
+    nv_resetModule(NV_MODULE_OTA);
+    HAL_CHECK_EQ(nv_flashWriteNew(1, NV_MODULE_OTA, NV_ITEM_OTA_HDR_SERVERINFO, sizeof(hdr), (u8 *)&hdr), NV_SUCC);
+    HAL_CHECK_EQ(nv_flashWriteNew(1, NV_MODULE_OTA, NV_ITEM_OTA_CODE, len, info), NV_SUCC);
+
+    zcl_attr_fileOffset = 0xffffffff;
+    ota_clientInfoRecover();
+
+    HAL_CHECK(!ota_clientInfoResumable());
+    HAL_CHECK(nv_flashSingleItemSizeGet(NV_MODULE_OTA, NV_ITEM_OTA_CODE, &size) != NV_SUCC);
+}
+
+static void ota_oldCheckpoint() {
+    ota_clientInfo_t info;
+
+    /* offset, crcValue, otaElementPos, otaElementLen, otaElementTag, otaElementInfo1, otaElementInfo2, clientOtaFlg */
+    memset(&info, 0, sizeof(info));
+    info.offset = 20000;
+    info.otaElementPos = 20000 - OTA_TEST_HDR_LEN - OTA_TEST_ELEM_HDR_LEN;
+    info.otaElementLen = OTA_TEST_IMAGE_SIZE;
+    info.clientOtaFlg = OTA_FLAG_IMAGE_ELEMENT;
+    ota_checkpoint((u8 *)&info, 21);
+
+    info.infoVer = OTA_CLIENT_INFO_VER + 1;
+    ota_checkpoint((u8 *)&info, sizeof(info));
+
+    hal_printf("checkpoints of another layout are dropped\r\n");
+}
+
+int main() {
+
+    hal_init(NULL, 1);
+
+    /* the running image, a delta is made against it */
+    ota_random(ota_base, OTA_TEST_IMAGE_SIZE, 3);
+    ota_imageFix(ota_base, OTA_TEST_IMAGE_SIZE);
+    memcpy(hal_flash, ota_base, OTA_TEST_IMAGE_SIZE);
+    hal_flash_boot(0);
+
+    os_init(0);
+    user_init(0);
+    hal_task_run();
+
+    ota_plain();
+    ota_compressed();
+    ota_delta();
+    ota_wrongBase();
+    ota_oldCheckpoint();
+
+    return hal_result("test_ota_lz");
+}
@@ -0,0 +1,156 @@
+/*
+ * An OTA download through zcl_otaCb(), the test is the server. The image goes
+ * to flash by whole pages, a write never crosses a page and the image in flash
+ * is the one sent. Prints the flash writes and the cycles per image.
+ */
+#include "tl_common.h"
+#include "zcl_include.h"
+#include "ota.h"
+
+#include "watermeter.h"
+
+#include "hal.h"
+
+#define OTA_TEST_HDR_LEN        56
+#define OTA_TEST_ELEM_HDR_LEN   6
+#define OTA_TEST_IMAGE_SIZE     60000
+#define OTA_TEST_FILE_SIZE      (OTA_TEST_HDR_LEN + OTA_TEST_ELEM_HDR_LEN + OTA_TEST_IMAGE_SIZE)
+#define OTA_TEST_BLOCK_SIZE     48
+#define OTA_TEST_IMAGE_ADDR     0x40000             /* the app runs at 0 */
+#define OTA_TEST_START_FLAG     0x4b                /* TL_IMAGE_START_FLAG of ota.c */
+/* blocks between the checkpoints, FLASH_WRITE_COUNT_GET() of ota.c, each flushes a part of a page */
+#define OTA_TEST_CHECKPOINT     (OTA_TEST_FILE_SIZE / (110 * OTA_IMAGE_MAX_DATA_SIZE) + 1)
+
+extern ota_ctx_t g_otaCtx;
+extern void user_init(bool isRetention);
+
+static u8 ota_file[OTA_TEST_FILE_SIZE];
+static u32 ota_imageWrites = 0;
+static u32 ota_pageCrossed = 0;
+
+void __real_flash_write_page(unsigned long addr, unsigned long len, unsigned char *buf);
+
+void __wrap_flash_write_page(unsigned long addr, unsigned long len, unsigned char *buf) {
+
+    if (addr >= OTA_TEST_IMAGE_ADDR && addr < OTA_TEST_IMAGE_ADDR + FLASH_OTA_IMAGE_MAX_SIZE) {
+        ota_imageWrites++;
+        if ((addr & (FLASH_PAGE_SIZE - 1)) + len > FLASH_PAGE_SIZE) ota_pageCrossed++;
+    }
+
+    __real_flash_write_page(addr, len, buf);
+}
+
+static void ota_put(u8 *p, u32 v, u8 len) {
+
+    for (u8 i = 0; i < len; i++) p[i] = v >> (8 * i);
+}
+
+/* the file header, one image element, the crc of the image in its last 4 bytes */
+static void ota_fileBuild(u32 fileVer) {
+    u8 *hdr = ota_file, *img = ota_file + OTA_TEST_HDR_LEN + OTA_TEST_ELEM_HDR_LEN;
+    u32 seed = 7;
+
+    memset(ota_file, 0, sizeof(ota_file));
+
+    ota_put(hdr, 0x0beef11e, 4);
+    ota_put(hdr + 4, 0x0100, 2);
+    ota_put(hdr + OTA_HDR_LEN_OFFSET, OTA_TEST_HDR_LEN, 2);
+    ota_put(hdr + 10, g_otaCtx.pOtaPreamble->manufacturerCode, 2);
+    ota_put(hdr + 12, g_otaCtx.pOtaPreamble->imageType, 2);
+    ota_put(hdr + 14, fileVer, 4);
+    ota_put(hdr + OTA_STACK_VER_OFFSET, ZB_STACKVER_PRO, 2);
+    ota_put(hdr + 52, OTA_TEST_FILE_SIZE, 4);
+
+    ota_put(hdr + OTA_TEST_HDR_LEN, OTA_UPGRADE_IMAGE_TAG_ID, 2);
+    ota_put(hdr + OTA_TEST_HDR_LEN + 2, OTA_TEST_IMAGE_SIZE, 4);
+
+    for (u32 i = 0; i < OTA_TEST_IMAGE_SIZE; i++) {
+        seed = seed * 1103515245 + 12345;
+        img[i] = seed >> 16;
+    }
+    img[6] = 0x5d;
+    img[7] = 0x02;
+    img[FLASH_TLNK_FLAG_OFFSET] = OTA_TEST_START_FLAG;
+    ota_put(img + 0x18, OTA_TEST_IMAGE_SIZE, 4);
+    ota_put(img + OTA_TEST_IMAGE_SIZE - 4, xcrc32(img, OTA_TEST_IMAGE_SIZE - 4, 0xffffffff), 4);
+}
+
+static void ota_download() {
+    static const addrExt_t server = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    zclIncomingAddrInfo_t addrInfo;
+    ota_queryNextImageRsp_t nextRsp;
+    ota_imageBlockRsp_t blockRsp;
+    u8 block[OTA_TEST_BLOCK_SIZE];
+    u32 fileVer = g_otaCtx.pOtaPreamble->fileVer + 1, blocks = 0, writes, offset;
+    unsigned long long t;
+    u8 *img;
+
+    ota_fileBuild(fileVer);
+    ZB_IEEE_ADDR_COPY(zcl_attr_upgradeServerID, server);
+
+    memset(&addrInfo, 0, sizeof(addrInfo));
+    addrInfo.dirCluster = ZCL_FRAME_SERVER_CLIENT_DIR;
+    addrInfo.dstEp = g_otaCtx.simpleDesc->endpoint;
+    addrInfo.srcEp = 1;
+    addrInfo.profileId = HA_PROFILE_ID;
+
+    nextRsp.st = ZCL_STA_SUCCESS;
+    nextRsp.manuCode = g_otaCtx.pOtaPreamble->manufacturerCode;
+    nextRsp.imageType = g_otaCtx.pOtaPreamble->imageType;
+    nextRsp.fileVer = fileVer;
+    nextRsp.imageSize = OTA_TEST_FILE_SIZE;
+
+    writes = hal_flash_writes;
+    t = __builtin_ia32_rdtsc();
+
+    zcl_otaCb(&addrInfo, ZCL_CMD_OTA_QUERY_NEXT_IMAGE_RSP, &nextRsp);
+    HAL_CHECK_EQ(zcl_attr_imageUpgradeStatus, IMAGE_UPGRADE_STATUS_DOWNLOAD_IN_PROGRESS);
+
+    while (zcl_attr_imageUpgradeStatus == IMAGE_UPGRADE_STATUS_DOWNLOAD_IN_PROGRESS) {
+        offset = zcl_attr_fileOffset;
+        memset(&blockRsp, 0, sizeof(blockRsp));
+        blockRsp.st = ZCL_STA_SUCCESS;
+        blockRsp.rsp.success.manuCode = nextRsp.manuCode;
+        blockRsp.rsp.success.imageType = nextRsp.imageType;
+        blockRsp.rsp.success.fileVer = fileVer;
+        blockRsp.rsp.success.fileOffset = offset;
+        blockRsp.rsp.success.dataSize = OTA_TEST_FILE_SIZE - offset < OTA_TEST_BLOCK_SIZE ?
+                                        OTA_TEST_FILE_SIZE - offset : OTA_TEST_BLOCK_SIZE;
+        memcpy(block, &ota_file[offset], blockRsp.rsp.success.dataSize);
+        blockRsp.rsp.success.data = block;
+
+        zcl_otaCb(&addrInfo, ZCL_CMD_OTA_IMAGE_BLOCK_RSP, &blockRsp);
+        hal_task_run();
+
+        if (zcl_attr_fileOffset == offset) break;
+        blocks++;
+    }
+
+    t = __builtin_ia32_rdtsc() - t;
+
+    HAL_CHECK_EQ(zcl_attr_imageUpgradeStatus, IMAGE_UPGRADE_STATUS_DOWNLOAD_COMPLETE);
+    HAL_CHECK_EQ(ota_pageCrossed, 0);
+    HAL_CHECK(ota_imageWrites <= OTA_TEST_IMAGE_SIZE / FLASH_PAGE_SIZE + 1 + blocks / OTA_TEST_CHECKPOINT + 1);
+
+    /* the start flag is set after the reboot */
+    img = ota_file + OTA_TEST_HDR_LEN + OTA_TEST_ELEM_HDR_LEN;
+    img[FLASH_TLNK_FLAG_OFFSET] = 0xff;
+    HAL_CHECK(!memcmp(&hal_flash[OTA_TEST_IMAGE_ADDR], img, OTA_TEST_IMAGE_SIZE));
+
+    hal_printf("%d bytes in %d blocks: %d image writes, %d flash writes, %d kcycles\r\n",
+            OTA_TEST_FILE_SIZE, blocks, ota_imageWrites, hal_flash_writes - writes, (u32)(t / 1000));
+}
+
+int main() {
+
+    hal_init(NULL, 1);
+    hal_flash_boot(0);
+
+    os_init(0);
+    user_init(0);
+    hal_task_run();
+
+    ota_download();
+
+    return hal_result("test_ota_page");
+}
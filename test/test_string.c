@@ -0,0 +1,176 @@
+/*
+ * memcpy(), memset() and memcmp() of proj/common/string.c against byte loops,
+ * at every alignment of both pointers, the lengths across the word paths and
+ * the overlapped copies. Prints the cycles of a call at the sizes the stack
+ * uses, the byte loop is what string.c did before.
+ */
+#include "tl_common.h"
+
+#include "hal.h"
+
+#define STR_BUF_SIZE            192
+#define STR_LEN_MAX             140
+#define STR_BENCH_LOOPS         20000
+
+static u8 str_src[STR_BUF_SIZE] __attribute__((aligned(4)));
+static u8 str_dst[STR_BUF_SIZE] __attribute__((aligned(4)));
+static u8 str_ref[STR_BUF_SIZE] __attribute__((aligned(4)));
+
+/* memmove(), as bcopy_() did for any overlap */
+static void str_copyRef(u8 *d, const u8 *s, u32 len) {
+
+    if (d < s) {
+        while (len--) *d++ = *s++;
+    } else {
+        d += len;
+        s += len;
+        while (len--) *--d = *--s;
+    }
+}
+
+static int str_cmpRef(const u8 *s1, const u8 *s2, u32 n) {
+
+    while (n--) {
+        if (*s1 != *s2) return *s1 - *s2;
+        s1++;
+        s2++;
+    }
+
+    return 0;
+}
+
+static void str_fill(u8 *buf, u32 seed) {
+
+    for (u32 i = 0; i < STR_BUF_SIZE; i++) {
+        seed = seed * 1103515245 + 12345;
+        buf[i] = seed >> 16;
+    }
+}
+
+static int str_sign(int v) {
+
+    return v > 0 ? 1 : v < 0 ? -1 : 0;
+}
+
+static void str_copyTest() {
+    u32 fails = 0;
+
+    for (u32 sa = 0; sa < 4; sa++) {
+        for (u32 da = 0; da < 4; da++) {
+            for (u32 len = 0; len <= STR_LEN_MAX; len++) {
+                str_fill(str_src, len);
+                str_fill(str_dst, ~len);
+                memcpy(str_ref, str_dst, STR_BUF_SIZE);
+
+                memcpy(str_dst + da, str_src + sa, len);
+                str_copyRef(str_ref + da, str_src + sa, len);
+
+                if (str_cmpRef(str_dst, str_ref, STR_BUF_SIZE)) fails++;
+            }
+        }
+    }
+    HAL_CHECK_EQ(fails, 0);
+
+    /* overlapped, dest below, above and on the tail of src */
+    for (s32 shift = -9; shift <= 9; shift++) {
+        for (u32 len = 0; len <= STR_LEN_MAX; len++) {
+            str_fill(str_dst, len);
+            memcpy(str_ref, str_dst, STR_BUF_SIZE);
+
+            memcpy(str_dst + 20 + shift, str_dst + 20, len);
+            str_copyRef(str_ref + 20 + shift, str_ref + 20, len);
+
+            if (str_cmpRef(str_dst, str_ref, STR_BUF_SIZE)) fails++;
+        }
+    }
+    HAL_CHECK_EQ(fails, 0);
+}
+
+static void str_setTest() {
+    u32 fails = 0;
+
+    for (u32 da = 0; da < 4; da++) {
+        for (u32 len = 0; len <= STR_LEN_MAX; len++) {
+            str_fill(str_dst, len);
+            memcpy(str_ref, str_dst, STR_BUF_SIZE);
+
+            memset(str_dst + da, 0x1a5 + len, len);
+            for (u32 i = 0; i < len; i++) str_ref[da + i] = (u8)(0x1a5 + len);
+
+            if (str_cmpRef(str_dst, str_ref, STR_BUF_SIZE)) fails++;
+        }
+    }
+    HAL_CHECK_EQ(fails, 0);
+}
+
+static void str_cmpTest() {
+    u32 fails = 0;
+
+    for (u32 sa = 0; sa < 4; sa++) {
+        for (u32 len = 0; len <= STR_LEN_MAX; len++) {
+            str_fill(str_src, 3);
+            str_copyRef(str_dst + sa, str_src + sa, len);
+            if (memcmp(str_dst + sa, str_src + sa, len)) fails++;
+
+            /* a difference at each position, both signs */
+            for (u32 pos = 0; pos < len; pos++) {
+                str_dst[sa + pos] ^= 0x80;
+                if (str_sign(memcmp(str_dst + sa, str_src + sa, len)) != str_sign(str_cmpRef(str_dst + sa, str_src + sa, len)) ||
+                    str_sign(memcmp(str_src + sa, str_dst + sa, len)) != str_sign(str_cmpRef(str_src + sa, str_dst + sa, len))) {
+                    fails++;
+                }
+                str_dst[sa + pos] ^= 0x80;
+            }
+        }
+    }
+    HAL_CHECK_EQ(fails, 0);
+}
+
+static void str_bench(u32 len, u32 align) {
+    unsigned long long t;
+    u32 copy, copyRef, set, cmp, cmpRef;
+    volatile int r = 0;
+
+    t = __builtin_ia32_rdtsc();
+    for (u32 i = 0; i < STR_BENCH_LOOPS; i++) memcpy(str_dst + align, str_src, len);
+    copy = (__builtin_ia32_rdtsc() - t) / STR_BENCH_LOOPS;
+
+    t = __builtin_ia32_rdtsc();
+    for (u32 i = 0; i < STR_BENCH_LOOPS; i++) str_copyRef(str_dst + align, str_src, len);
+    copyRef = (__builtin_ia32_rdtsc() - t) / STR_BENCH_LOOPS;
+
+    t = __builtin_ia32_rdtsc();
+    for (u32 i = 0; i < STR_BENCH_LOOPS; i++) memset(str_dst + align, i, len);
+    set = (__builtin_ia32_rdtsc() - t) / STR_BENCH_LOOPS;
+
+    memcpy(str_dst + align, str_src, len);
+
+    t = __builtin_ia32_rdtsc();
+    for (u32 i = 0; i < STR_BENCH_LOOPS; i++) r += memcmp(str_dst + align, str_src, len);
+    cmp = (__builtin_ia32_rdtsc() - t) / STR_BENCH_LOOPS;
+
+    t = __builtin_ia32_rdtsc();
+    for (u32 i = 0; i < STR_BENCH_LOOPS; i++) r += str_cmpRef(str_dst + align, str_src, len);
+    cmpRef = (__builtin_ia32_rdtsc() - t) / STR_BENCH_LOOPS;
+
+    hal_printf("%3d bytes %s: memcpy %3d (%3d), memset %3d, memcmp %3d (%3d) cycles\r\n",
+            len, align ? "unaligned" : "aligned  ", copy, copyRef, set, cmp, cmpRef);
+}
+
+int main() {
+    static const u32 sizes[] = { 8, 16, 48, 127 };
+
+    hal_init(NULL, 1);
+
+    str_copyTest();
+    str_setTest();
+    str_cmpTest();
+
+    hal_printf("in brackets, the byte loop\r\n");
+    for (u8 i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        str_bench(sizes[i], 0);
+        str_bench(sizes[i], 1);
+    }
+
+    return hal_result("test_string");
+}
@@ -0,0 +1,92 @@
+/*
+ * zcl_findAttribute() over the five endpoints of the application: each
+ * attribute of the tables is found, the IDs between them and the clusters
+ * not registered are not. Prints the cycles of a lookup.
+ */
+#include "tl_common.h"
+#include "zcl_include.h"
+
+#include "watermeter.h"
+
+#include "hal.h"
+
+#define ATTR_BENCH_LOOPS        200
+
+extern zcl_ctrl_t zcl_vars;
+
+extern void user_init(bool isRetention);
+
+static u8 attr_inTable(clusterInfo_t *pCluster, u16 attrId) {
+
+    for (u8 i = 0; i < pCluster->attrNum; i++) {
+        if (pCluster->attrTable[i].id == attrId) return 1;
+    }
+
+    return 0;
+}
+
+static void attr_test() {
+    clusterInfo_t *pCluster;
+    const zclAttrInfo_t *pAttr;
+    u32 attrs = 0;
+
+    HAL_CHECK(zcl_vars.clusterNum > 0);
+
+    for (u8 i = 0; i < zcl_vars.clusterNum; i++) {
+        pCluster = &zcl_vars.clusterList[i];
+
+        for (u8 a = 0; a < pCluster->attrNum; a++) {
+            pAttr = &pCluster->attrTable[a];
+            HAL_CHECK(zcl_findAttribute(pCluster->endpoint, pCluster->clusterID, pAttr->id) == pAttr);
+            /* the IDs between the attributes of the table */
+            if (!attr_inTable(pCluster, pAttr->id + 1)) {
+                HAL_CHECK(zcl_findAttribute(pCluster->endpoint, pCluster->clusterID, pAttr->id + 1) == NULL);
+            }
+            attrs++;
+        }
+
+        HAL_CHECK(zcl_findAttribute(pCluster->endpoint, pCluster->clusterID, 0xfffe) == NULL);
+        HAL_CHECK(zcl_findAttribute(pCluster->endpoint + 10, pCluster->clusterID, 0) == NULL);
+    }
+
+    HAL_CHECK(zcl_findAttribute(WATERMETER_ENDPOINT1, 0xfc00, 0) == NULL);
+
+    hal_printf("%d clusters, %d attributes\r\n", zcl_vars.clusterNum, attrs);
+}
+
+static void attr_bench() {
+    clusterInfo_t *pCluster;
+    unsigned long long t;
+    volatile u32 found = 0;
+    u32 lookups = 0;
+
+    t = __builtin_ia32_rdtsc();
+
+    for (u32 n = 0; n < ATTR_BENCH_LOOPS; n++) {
+        for (u8 i = 0; i < zcl_vars.clusterNum; i++) {
+            pCluster = &zcl_vars.clusterList[i];
+            for (u8 a = 0; a < pCluster->attrNum; a++) {
+                found += (u32)zcl_findAttribute(pCluster->endpoint, pCluster->clusterID, pCluster->attrTable[a].id);
+                lookups++;
+            }
+        }
+    }
+
+    t = __builtin_ia32_rdtsc() - t;
+
+    hal_printf("lookup: %d cycles\r\n", (u32)(t / lookups));
+}
+
+int main() {
+
+    hal_init(NULL, 1);
+    hal_flash_boot(0);
+
+    os_init(0);
+    user_init(0);
+
+    attr_test();
+    attr_bench();
+
+    return hal_result("test_zcl_attr");
+}
@@ -29,6 +29,13 @@
 #include "../os/ev_buffer.h"
 #include "../os/ev.h"
 
+/* Check NULL pointers and the size of ev buffers in memset/memcpy.
+ * Can be disabled with -DMEM_ACCESS_CHECK=0.
+ */
+#ifndef MEM_ACCESS_CHECK
+#define MEM_ACCESS_CHECK	1
+#endif
+
 char *strcpy(char *dst0, const char *src0){
 	char *s = dst0;
 	while((*dst0++ = *src0++));
@@ -49,6 +56,15 @@ int memcmp(const void * m1, const void *m2, unsigned int n){
 	unsigned char *s1 = (unsigned char *)m1;
 	unsigned char *s2 = (unsigned char *)m2;
 
+	if((n >= 4) && !(((u32)s1 | (u32)s2) & 3)){
+		//skip equal words, the first different word is compared by bytes below
+		while((n >= 4) && (*(u32 *)s1 == *(u32 *)s2)){
+			s1 += 4;
+			s2 += 4;
+			n -= 4;
+		}
+	}
+
 	while(n--){
 		if(*s1 != *s2){
 			return *s1 - *s2;
@@ -88,13 +104,59 @@ void *memmove(void *dest, const void *src, unsigned int n){
 	return dest;
 }
 
+/**
+ * @brief       Forward copy, by words when both pointers have the same alignment.
+ *              Safe for overlapped buffers when dest is below src.
+ *
+ * @param[in]   d   - destination
+ * @param[in]   s   - source
+ * @param[in]   len - length
+ *
+ * @return      none
+ */
+static void copy_fwd(u8 *d, const u8 *s, unsigned int len){
+	if((len >= 8) && !(((u32)d ^ (u32)s) & 3)){
+		while((u32)d & 3){
+			*d++ = *s++;
+			len--;
+		}
+
+		u32 *wd = (u32 *)d;
+		const u32 *ws = (const u32 *)s;
+
+		while(len >= 16){
+			u32 w0 = ws[0];
+			u32 w1 = ws[1];
+			u32 w2 = ws[2];
+			u32 w3 = ws[3];
+			wd[0] = w0;
+			wd[1] = w1;
+			wd[2] = w2;
+			wd[3] = w3;
+			wd += 4;
+			ws += 4;
+			len -= 16;
+		}
+		while(len >= 4){
+			*wd++ = *ws++;
+			len -= 4;
+		}
+
+		d = (u8 *)wd;
+		s = (const u8 *)ws;
+	}
+
+	while(len--)
+		*d++ = *s++;
+}
+
 static void bcopy_(register char *src, register char *dest, int len){
 	char *s = (char *)src;
 	char *d = (char *)dest;
 
-	if(d < s){
-		while(len--)
-			*d++ = *s++;
+	//forward unless dest overlaps the tail of src
+	if((d < s) || (d >= s + len)){
+		copy_fwd((u8 *)d, (const u8 *)s, (unsigned int)len);
 	}else{
 		s = s + (len - 1);
 		d = d + (len - 1);
@@ -108,16 +170,46 @@ static void bcopy_(register char *src, register char *dest, int len){
 
 #if 1
 void *memset(void *dest, int val, unsigned int len){
+#if MEM_ACCESS_CHECK
 	if(dest == NULL){
 		ZB_EXCEPTION_POST(SYS_EXCEPTTION_COMMON_MEM_ACCESS);
 		return dest;
 	}
-    if(is_ev_buf(dest) && (len > LARGE_BUFFER)){
+	//the length is checked first, is_ev_buf() is only needed for large blocks
+    if((len > LARGE_BUFFER) && is_ev_buf(dest)){
     	ZB_EXCEPTION_POST(SYS_EXCEPTTION_COMMON_MEM_ACCESS);
     	return dest;
     }
+#endif
 
 	register unsigned char *ptr = (unsigned char *)dest;
+
+	if(len >= 8){
+		while((u32)ptr & 3){
+			*ptr++ = (unsigned char)val;
+			len--;
+		}
+
+		u32 w = (unsigned char)val;
+		w |= w << 8;
+		w |= w << 16;
+
+		u32 *wp = (u32 *)ptr;
+		while(len >= 16){
+			wp[0] = w;
+			wp[1] = w;
+			wp[2] = w;
+			wp[3] = w;
+			wp += 4;
+			len -= 16;
+		}
+		while(len >= 4){
+			*wp++ = w;
+			len -= 4;
+		}
+		ptr = (unsigned char *)wp;
+	}
+
 	while(len-- > 0)
 		*ptr++ = (unsigned char)val;
 	return dest;
@@ -127,18 +219,16 @@ void *memcpy(void *out, const void *in, unsigned int length){
 	if(length == 0){
 		return out;
 	}
-	if(out == NULL){
+#if MEM_ACCESS_CHECK
+	if((out == NULL) || (in == NULL)){
 		ZB_EXCEPTION_POST(SYS_EXCEPTTION_COMMON_MEM_ACCESS);
 		return out;
 	}
-	if(in == NULL){
-		ZB_EXCEPTION_POST(SYS_EXCEPTTION_COMMON_MEM_ACCESS);
-		return out;
-	}
-    if(is_ev_buf(out) && (length > LARGE_BUFFER)){
+    if((length > LARGE_BUFFER) && is_ev_buf(out)){
     	ZB_EXCEPTION_POST(SYS_EXCEPTTION_COMMON_MEM_ACCESS);
     	return out;
     }
+#endif
 
 	bcopy_((char *)in, (char *)out, (int)length);
 	return out;
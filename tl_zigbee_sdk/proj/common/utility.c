@@ -90,3 +90,22 @@ unsigned int xcrc32(const unsigned char *buf, int len, unsigned int init)
     }
 	return crc;
 }
+
+/* CRC-16 reflected, poly 0xA010, nibble table - 32 bytes instead of 512 for a byte table */
+static const unsigned short crc16_table[] = {
+    0x0000, 0x1402, 0x2804, 0x3C06, 0x5008, 0x440A, 0x780C, 0x6C0E,
+    0xA010, 0xB412, 0x8814, 0x9C16, 0xF018, 0xE41A, 0xD81C, 0xCC1E
+};
+
+unsigned short xcrc16(const unsigned char *buf, int len, unsigned short init)
+{
+	unsigned short crc = init;
+	while (len--)
+    {
+      crc ^= *buf;
+      crc = (crc >> 4) ^ crc16_table[crc & 0x0f];
+      crc = (crc >> 4) ^ crc16_table[crc & 0x0f];
+      buf++;
+    }
+	return crc;
+}
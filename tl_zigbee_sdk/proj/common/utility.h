@@ -137,3 +137,4 @@
 #define TWO_INT_HASH_FUNC(v1, v2)      		(HASH_FUNC_STEP(HASH_FUNC_STEP(HASH_MAGIC_VAL, (v1)), (v2)) & INT_MASK)
 
 extern unsigned int xcrc32(const unsigned char *buf, int len, unsigned int init);
+extern unsigned short xcrc16(const unsigned char *buf, int len, unsigned short init);
@@ -60,6 +60,11 @@ enum{
 #define SECT_VALID_CHECK(s)                 (s.usedFlag == NV_SECTOR_VALID || \
 		                                     s.usedFlag == NV_SECTOR_VALID_CHECKCRC)
 
+/* READY -> VALID_CHECKCRC clears bit 7 of both bytes, a power cut may leave only one of them */
+#define SECT_READY_CHECK(f)                 (f == NV_SECTOR_VALID_READY_CHECKCRC || \
+                                             f == (NV_SECTOR_VALID_READY_CHECKCRC & 0xff7f) || \
+                                             f == (NV_SECTOR_VALID_READY_CHECKCRC & 0x7fff))
+
 #define ITEM_VALID_FLAG_CHECK(v)  			(v == ITEM_FIELD_VALID ||   \
 		                           	   	   	 v == ITEM_FIELD_VALID_SINGLE)
 
@@ -80,6 +85,51 @@ enum{
 
 static u8 g_nvItemLengthCheckNum = 0;
 
+/* background compaction, see nv_compactStep() */
+enum{
+	NV_COMPACT_IDLE,
+	NV_COMPACT_CHECK,
+	NV_COMPACT_SCAN,
+	NV_COMPACT_ERASE,
+	NV_COMPACT_COPY,
+};
+
+typedef struct{
+	u32 offsetPrev;		//offset of the last index read in the old sector
+	u16 sizePrev;
+	u16 srcIdx;			//next index to copy from the old sector
+	u16 dstIdx;			//next index to write in the new sector
+	u8  state;
+	u8  id;
+	u8  oldSect;
+	u8  newSect;
+	u8  eraseCnt;		//flash sectors left to erase
+	u8  checkMask;		//modules written since the last check
+}nv_compact_t;
+
+static nv_compact_t g_nvCompact;
+
+#if NV_INDEX_CACHE_ENABLE
+#define NV_INDEX_CACHE_IDX_UNKNOWN	0xffff
+
+typedef struct{
+	u16 idx;			//last valid index of the item, NV_INDEX_CACHE_IDX_UNKNOWN after it is deleted
+	u16 size;
+	u8  itemId;
+}nv_idxCacheItem_t;
+
+typedef struct{
+	nv_sect_info_t sectInfo;	//as returned by nv_sector_read()
+	s16 lastIdx;				//last used index, -1 if the sector is empty
+	u8  valid;
+	u8  itemNum;
+	u8  overflow;				//more items than NV_INDEX_CACHE_ITEM_NUM
+	nv_idxCacheItem_t item[NV_INDEX_CACHE_ITEM_NUM];
+}nv_idxCache_t;
+
+static nv_idxCache_t g_nvIdxCache[NV_MAX_MODULS];
+#endif
+
 
 
 nv_itemLenChk_t  g_nvItemLenCheckTbl[NV_ITEM_LEN_CHK_TABBLE_NUM];
@@ -124,8 +174,171 @@ static nv_sts_t nv_sect_info_check(u8 sect, u16 id){
 }
 
 
+#if NV_INDEX_CACHE_ENABLE
+/* the cache of the module if opSect is its operation sector */
+static nv_idxCache_t *nv_idxCacheGet(u16 id, u8 opSect){
+	if(id >= NV_MAX_MODULS || id == NV_MODULE_NWK_FRAME_COUNT){
+		return NULL;
+	}
+
+	nv_idxCache_t *c = &g_nvIdxCache[id];
+	if(!c->valid || c->sectInfo.opSect != opSect){
+		return NULL;
+	}
+	return c;
+}
+
+static nv_idxCacheItem_t *nv_idxCacheItemFind(nv_idxCache_t *c, u8 itemId){
+	for(s32 i = 0; i < c->itemNum; i++){
+		if(c->item[i].itemId == itemId){
+			return &c->item[i];
+		}
+	}
+	return NULL;
+}
+
+static void nv_idxCacheItemSet(nv_idxCache_t *c, u8 itemId, u16 idx, u16 size){
+	nv_idxCacheItem_t *item = nv_idxCacheItemFind(c, itemId);
+
+	if(!item){
+		if(c->itemNum >= NV_INDEX_CACHE_ITEM_NUM){
+			c->overflow = 1;
+			return;
+		}
+		item = &c->item[c->itemNum++];
+		item->itemId = itemId;
+	}
+	item->idx = idx;
+	item->size = size;
+}
+
+/* read the whole index of the operation sector once */
+static void nv_idxCacheBuild(u16 id, nv_sect_info_t *sectInfo){
+	nv_idxCache_t *c = &g_nvIdxCache[id];
+	u32 idxStartAddr = MODULE_IDX_START(id, sectInfo->opSect);
+	u16 idxTotalNum = MODULE_IDX_NUM(id);
+	u16 readIdxNum = 0;
+	nv_info_idx_t idxInfo[8];
+
+	memset((u8 *)c, 0, sizeof(nv_idxCache_t));
+	c->lastIdx = -1;
+
+	for(u16 n = 0; n < idxTotalNum; n += readIdxNum){
+		readIdxNum = (idxTotalNum - n > 8) ? 8 : (idxTotalNum - n);
+		flash_read(idxStartAddr + n * sizeof(nv_info_idx_t), readIdxNum * sizeof(nv_info_idx_t), (u8 *)idxInfo);
+		for(s32 i = 0; i < readIdxNum; i++){
+			/* the same idle check as nv_index_read_op() */
+			if(idxInfo[i].usedState != ITEM_FIELD_IDLE || idxInfo[i].size != 0xffff || idxInfo[i].itemId != ITEM_FIELD_IDLE){
+				c->lastIdx = n + i;
+			}
+			if(ITEM_VALID_FLAG_CHECK(idxInfo[i].usedState)){
+				nv_idxCacheItemSet(c, idxInfo[i].itemId, n + i, idxInfo[i].size);
+			}
+		}
+	}
+
+	memcpy((u8 *)&c->sectInfo, (u8 *)sectInfo, sizeof(nv_sect_info_t));
+	c->valid = 1;
+}
+
+/* the sector info of the module is going to change */
+static void nv_idxCacheReset(u16 id){
+	if(id < NV_MAX_MODULS){
+		g_nvIdxCache[id].valid = 0;
+	}
+}
+
+/* an index is written, it is not idle any more even if the write fails */
+static void nv_idxCacheIdxUsed(u16 id, u8 opSect, u16 idx){
+	nv_idxCache_t *c = nv_idxCacheGet(id, opSect);
+
+	if(c && (s16)idx > c->lastIdx){
+		c->lastIdx = idx;
+	}
+}
+
+static void nv_idxCacheItemAdd(u16 id, u8 opSect, u8 itemId, u16 idx, u16 size){
+	nv_idxCache_t *c = nv_idxCacheGet(id, opSect);
+
+	if(c){
+		nv_idxCacheItemSet(c, itemId, idx, size);
+	}
+}
+
+static void nv_idxCacheItemDelete(u16 id, u8 opSect, u16 idx){
+	nv_idxCache_t *c = nv_idxCacheGet(id, opSect);
+
+	if(c){
+		for(s32 i = 0; i < c->itemNum; i++){
+			if(c->item[i].idx == idx){
+				/* an older copy may still be valid */
+				c->item[i].idx = NV_INDEX_CACHE_IDX_UNKNOWN;
+			}
+		}
+	}
+}
+
+/* NV_ITEM_NOT_FOUND is only returned if the cache knows it, else the index is searched in flash */
+static bool nv_idxCacheRead(u16 id, u8 itemId, u16 *itemLen, u8 opSect, u32 totalItemNum, u16 *idxNo, bool lenCheck, nv_sts_t *ret){
+	nv_idxCache_t *c = nv_idxCacheGet(id, opSect);
+
+	if(!c || totalItemNum != MODULE_IDX_NUM(id)){
+		return FALSE;
+	}
+
+	if(itemId == ITEM_FIELD_IDLE){
+		if(c->lastIdx < 0){
+			*ret = NV_ITEM_NOT_FOUND;
+		}else{
+			*idxNo = c->lastIdx;
+			*ret = NV_SUCC;
+		}
+		return TRUE;
+	}
+
+	nv_idxCacheItem_t *item = nv_idxCacheItemFind(c, itemId);
+	if(!item){
+		if(c->overflow){
+			return FALSE;
+		}
+		*ret = NV_ITEM_NOT_FOUND;
+		return TRUE;
+	}
+
+	if(item->idx == NV_INDEX_CACHE_IDX_UNKNOWN){
+		return FALSE;
+	}
+
+	if(lenCheck){
+		/* an older copy may have the length */
+		if(!NV_ITEMLEN_MATCH((item->size - sizeof(itemHdr_t)), *itemLen)){
+			return FALSE;
+		}
+		*idxNo = item->idx;
+	}else{
+		*itemLen = item->size - sizeof(itemHdr_t);
+	}
+	*ret = NV_SUCC;
+	return TRUE;
+}
+#else
+#define nv_idxCacheBuild(id, sectInfo)
+#define nv_idxCacheReset(id)
+#define nv_idxCacheIdxUsed(id, opSect, idx)
+#define nv_idxCacheItemAdd(id, opSect, itemId, idx, size)
+#define nv_idxCacheItemDelete(id, opSect, idx)
+#endif
+
+
 static nv_sts_t nv_index_read_op(u16 id, u8 itemId, u16 *itemLen, u8 opSect, u32 totalItemNum, u16 *idxNo, bool lenCheck){
 	nv_sts_t ret = NV_SUCC;
+
+#if NV_INDEX_CACHE_ENABLE
+	if(nv_idxCacheRead(id, itemId, itemLen, opSect, totalItemNum, idxNo, lenCheck, &ret)){
+		return ret;
+	}
+#endif
+
 	u32 idxTotalNum = totalItemNum;
 	u32 idxStartAddr = MODULE_IDX_START(id, opSect) + (idxTotalNum) * sizeof(nv_info_idx_t);
 	u16 opItemIdx = idxTotalNum;
@@ -212,11 +425,18 @@ nv_sts_t nv_sector_read(u16 id, u8 sectTotalNum, nv_sect_info_t *sectInfo){
 		bitValid |= (1 << i);
 	}
 
+#if NV_INDEX_CACHE_ENABLE
+	if(id < NV_MAX_MODULS && g_nvIdxCache[id].valid){
+		memcpy((u8 *)sectInfo, (u8 *)&g_nvIdxCache[id].sectInfo, sizeof(nv_sect_info_t));
+		return NV_SUCC;
+	}
+#endif
+
 	for(i = 0; i < sectTotalNum; i++){
 		flash_read(moduleStartAddr, sizeof(nv_sect_info_t), (u8 *)&s);
 		sectNo = (s.opSect & bitValid);
 
-		if(s.usedFlag == NV_SECTOR_VALID_READY_CHECKCRC){
+		if(SECT_READY_CHECK(s.usedFlag)){
 			if(nv_sectInfoCrcCheck(s)){
 				/* if another sector is valid, set it as invalid */
 				u8 sectDel = (sectNo + 1) & (MODULE_SECTOR_NUM - 1);
@@ -251,6 +471,8 @@ nv_sts_t nv_sector_read(u16 id, u8 sectTotalNum, nv_sect_info_t *sectInfo){
 	}
 	if( i == sectTotalNum){
 		ret = NV_ITEM_NOT_FOUND;
+	}else if(id < NV_MAX_MODULS && id != NV_MODULE_NWK_FRAME_COUNT){
+		nv_idxCacheBuild(id, sectInfo);
 	}
 	return ret;
 }
@@ -294,6 +516,7 @@ nv_sts_t nv_write_item(u8 single, u16 id, u8 itemId, u8 opSect, u16 opItemIdx, u
 	if(!ITEM_OFT_CHECK(idxInfo.offset, idxInfo.size, id, opSect)){
 		return NV_ITEM_CHECK_ERROR;
 	}
+	nv_idxCacheIdxUsed(id, opSect, opItemIdx);
 	if(flash_writeWithCheck(idxStartAddr+opItemIdx*sizeof(nv_info_idx_t), sizeof(nv_info_idx_t), (u8 *)&idxInfo) != TRUE){
 		return NV_ITEM_CHECK_ERROR;
 	}
@@ -393,7 +616,11 @@ nv_sts_t nv_write_item(u8 single, u16 id, u8 itemId, u8 opSect, u16 opItemIdx, u
 	}
 
 	u8 staOffset = OFFSETOF(nv_info_idx_t, usedState);
-	flash_writeWithCheck(idxStartAddr+opItemIdx*sizeof(nv_info_idx_t)+staOffset, 1, (u8 *)&idxInfo.usedState);
+	if(flash_writeWithCheck(idxStartAddr+opItemIdx*sizeof(nv_info_idx_t)+staOffset, 1, (u8 *)&idxInfo.usedState) == TRUE){
+		nv_idxCacheItemAdd(id, opSect, itemId, opItemIdx, idxInfo.size);
+	}else{
+		nv_idxCacheReset(id);
+	}
 
 	return NV_SUCC;
 }
@@ -475,11 +702,13 @@ nv_sts_t nv_flashReadByIndex(u8 id, u8 itemId, u8 opSect, u16 opIdx, u16 len, u8
 
 nv_sts_t nv_itemDeleteByIndex(u8 id, u8 itemId, u8 opSect, u16 opIdx){
 	nv_sts_t ret = NV_SUCC;
+	nv_compactAbort(id);
 	u32 idxStartAddr = MODULE_IDX_START(id, opSect);
 	nv_info_idx_t idx;
 	u8 staOffset = OFFSETOF(nv_info_idx_t, usedState);
 	idx.usedState = ITEM_FIELD_INVALID;
 	flash_write(idxStartAddr+opIdx*sizeof(nv_info_idx_t)+staOffset, 1, &(idx.usedState));
+	nv_idxCacheItemDelete(id, opSect, opIdx);
 	return ret;
 }
 
@@ -565,6 +794,34 @@ static void nv_exceptionDataHandler(bool single, u8 opSect, u16 id, u8 itemId, u
 }
 
 
+/* make opSect the operation sector, the old one is set invalid.
+ * A power cut between the steps is resolved by nv_sector_read(). */
+static nv_sts_t nv_sectorSwitch(u16 id, u8 oldSect, u8 opSect){
+	nv_sect_info_t sectInfo;
+
+	nv_idxCacheReset(id);
+
+	sectInfo.idName = id;
+	sectInfo.usedFlag = NV_SECTOR_VALID_READY_CHECKCRC;
+	sectInfo.opSect = opSect;
+
+	u32 sectCrc = 0xffffffff;
+	sectCrc = xcrc32(&(sectInfo.idName), 2, sectCrc);   //add (idName, opsect) to crc validation
+	sectCrc = sectCrc & 0x3f;
+	sectInfo.opSect = (sectCrc << NV_SECT_INFO_SECTNO_BITS) | sectInfo.opSect;
+	if(flash_writeWithCheck(MODULE_SECT_START(id, opSect), sizeof(nv_sect_info_t), (u8*)&sectInfo) != TRUE){
+		return NV_CHECK_SUM_ERROR;
+	}
+
+	sectInfo.usedFlag = NV_SECTOR_INVALID;
+	if(flash_writeWithCheck(MODULE_SECT_START(id, oldSect), sizeof(sectInfo.usedFlag), (u8*)&sectInfo.usedFlag) == TRUE){
+		sectInfo.usedFlag = NV_SECTOR_VALID_CHECKCRC;
+		flash_writeWithCheck(MODULE_SECT_START(id, opSect), sizeof(sectInfo.usedFlag), (u8*)&sectInfo.usedFlag);
+	}
+
+	return NV_SUCC;
+}
+
 static nv_sts_t nv_flashWriteNewHandler(bool forceChgSec, u8 single, u16 id, u8 itemId, u16 len, u8 *buf){
 	nv_sts_t ret = NV_SUCC;
 	nv_sect_info_t sectInfo;
@@ -581,6 +838,8 @@ static nv_sts_t nv_flashWriteNewHandler(bool forceChgSec, u8 single, u16 id, u8
 	/* search valid operation sub-sector */
 	ret = nv_sector_read(id, MODULE_SECTOR_NUM, &sectInfo);
 	if(ret != NV_SUCC){
+		nv_compactAbort(id);
+		nv_idxCacheReset(id);
 		opSect = 0;
 		for(s32 j = 0; j < NV_SECTOR_SIZE(id)/FLASH_SECTOR_SIZE; j++){
 			flash_erase(moduleStartAddr + j * FLASH_SECTOR_SIZE);
@@ -622,6 +881,8 @@ static nv_sts_t nv_flashWriteNewHandler(bool forceChgSec, u8 single, u16 id, u8
 
 	u8 oldSect = opSect;
 	if(sectorUpdate){
+		/* the background compaction uses the same sector */
+		nv_compactAbort(id);
 		wItemIdx = 0;
 		opSect = (opSect + 1) & (MODULE_SECTOR_NUM - 1);
 
@@ -739,31 +1000,16 @@ static nv_sts_t nv_flashWriteNewHandler(bool forceChgSec, u8 single, u16 id, u8
 		if(flash_writeWithCheck(idxStartAddr+deleteIdx*sizeof(nv_info_idx_t)+staOffset, 1, &(idxInfo[0].usedState)) != TRUE){
 			return NV_CHECK_SUM_ERROR;
 		}
+		nv_idxCacheItemDelete(id, opSect, deleteIdx);
 	}
 
 
 	if(ret == NV_SUCC){
 		if(sectorUpdate){
-			sectInfo.idName = id;
-
-			sectInfo.usedFlag = NV_SECTOR_VALID_READY_CHECKCRC;
-			sectInfo.opSect = opSect;
-
-			u32 sectCrc = 0xffffffff;
-			sectCrc = xcrc32(&(sectInfo.idName), 2, sectCrc);   //add (idName, opsect) to crc validation
-			sectCrc = sectCrc & 0x3f;
-			sectInfo.opSect = (sectCrc << NV_SECT_INFO_SECTNO_BITS) | sectInfo.opSect;
-			if(flash_writeWithCheck(MODULE_SECT_START(id, opSect), sizeof(nv_sect_info_t), (u8*)&sectInfo) != TRUE){
-				return NV_CHECK_SUM_ERROR;
-			}
-
-			sectInfo.usedFlag = NV_SECTOR_INVALID;
-			if(flash_writeWithCheck(MODULE_SECT_START(id, oldSect), sizeof(sectInfo.usedFlag), (u8*)&sectInfo.usedFlag) == TRUE){
-				sectInfo.usedFlag = NV_SECTOR_VALID_CHECKCRC;
-				flash_writeWithCheck(MODULE_SECT_START(id, opSect), sizeof(sectInfo.usedFlag), (u8*)&sectInfo.usedFlag);
-			}
+			ret = nv_sectorSwitch(id, oldSect, opSect);
 		}else{
 			 if(wItemIdx == 0){
+				nv_idxCacheReset(id);
 				sectInfo.idName = id;
 				sectInfo.usedFlag = NV_SECTOR_VALID_CHECKCRC;
 				sectInfo.opSect = opSect;
@@ -790,9 +1036,211 @@ nv_sts_t nv_flashWriteNew(u8 single, u16 id, u8 itemId, u16 len, u8 *buf){
 		ret = nv_flashWriteNewHandler(1, single, id, itemId, len, buf);
 	}
 
+	if(ret == NV_SUCC){
+		g_nvCompact.checkMask |= BIT(id);
+	}
+
 	return ret;
 }
 
+/*********************************************************************
+ * @fn      nv_compactAbort
+ *
+ * @brief   Stop the background compaction of the module, the old sector
+ *          is still the operation one, the new one is erased next time.
+ *          Needed when the old sector is changed other than by appending.
+ *
+ * @param   id - module
+ *
+ * @return  None
+ */
+void nv_compactAbort(u8 id){
+	/* from SCAN on the steps rely on the sector found by CHECK */
+	if(g_nvCompact.id == id && g_nvCompact.state >= NV_COMPACT_SCAN){
+		g_nvCompact.state = NV_COMPACT_IDLE;
+	}
+}
+
+/* free space of the operation sector, FALSE if it is low */
+static bool nv_compactFreeCheck(u8 id, u8 opSect){
+	u16 idxTotalNum = MODULE_IDX_NUM(id);
+	u16 lastIdx = 0;
+	nv_info_idx_t idx;
+
+	if(nv_index_read(id, ITEM_FIELD_IDLE, 0, opSect, idxTotalNum, &lastIdx) != NV_SUCC){
+		return TRUE;
+	}
+
+	flash_read(MODULE_IDX_START(id, opSect) + lastIdx * sizeof(nv_info_idx_t), sizeof(nv_info_idx_t), (u8 *)&idx);
+	/* a broken index is left to the sector update in nv_flashWriteNewHandler() */
+	if(!ITEM_OFT_CHECK(idx.offset, idx.size, id, opSect)){
+		return TRUE;
+	}
+
+	u32 freeSize = MODULE_SECT_END(id, opSect) - ((idx.offset + idx.size + 3) & (~0x03));
+	u16 freeIdx = idxTotalNum - 1 - lastIdx;
+
+	return (freeSize >= NV_COMPACT_FREE_SIZE(id) && freeIdx >= NV_COMPACT_FREE_IDX(id));
+}
+
+/* valid items of the operation sector must leave twice the threshold free */
+static bool nv_compactGainCheck(u8 id, u8 opSect){
+	u32 idxAddr = MODULE_IDX_START(id, opSect);
+	u32 validSize = 0;
+	u16 validNum = 0;
+	nv_info_idx_t idx;
+
+	for(u16 i = 0; i < MODULE_IDX_NUM(id); i++){
+		flash_read(idxAddr + i * sizeof(nv_info_idx_t), sizeof(nv_info_idx_t), (u8 *)&idx);
+		if(idx.usedState == ITEM_FIELD_IDLE){
+			break;
+		}
+		if(ITEM_VALID_FLAG_CHECK(idx.usedState)){
+			validSize += (idx.size + 3) & (~0x03);
+			validNum++;
+		}
+	}
+
+	u32 contextSize = NV_SECTOR_SIZE(id) - MODULE_INFO_SIZE(id);
+	if(validSize + 2 * NV_COMPACT_FREE_SIZE(id) > contextSize ||
+	   validNum + 2 * NV_COMPACT_FREE_IDX(id) > MODULE_IDX_NUM(id)){
+		return FALSE;
+	}
+	return TRUE;
+}
+
+/* copy the next valid item to the new sector, FALSE at the end of the old sector */
+static bool nv_compactCopyItem(void){
+	u8 id = g_nvCompact.id;
+	u8 oldSect = g_nvCompact.oldSect;
+	nv_info_idx_t idx;
+	itemHdr_t hdr;
+
+	while(g_nvCompact.srcIdx < MODULE_IDX_NUM(id)){
+		flash_read(MODULE_IDX_START(id, oldSect) + g_nvCompact.srcIdx * sizeof(nv_info_idx_t), sizeof(nv_info_idx_t), (u8 *)&idx);
+
+		/* the same sequence check as the sector update in nv_flashWriteNewHandler() */
+		u32 offsetExp = g_nvCompact.srcIdx ? (((g_nvCompact.offsetPrev + g_nvCompact.sizePrev) + 0x03) & (~0x03))
+										   : MODULE_CONTEXT_START(id, oldSect, 0);
+		if(idx.offset != offsetExp || (MODULE_SECT_END(id, oldSect) - idx.offset) < idx.size){
+			return FALSE;
+		}
+		g_nvCompact.offsetPrev = idx.offset;
+		g_nvCompact.sizePrev = idx.size;
+		g_nvCompact.srcIdx++;
+
+		if(!ITEM_VALID_FLAG_CHECK(idx.usedState)){
+			continue;
+		}
+
+		flash_read(idx.offset, sizeof(itemHdr_t), (u8 *)&hdr);
+		if(hdr.used == ITEM_HDR_FIELD_VALID_CHECKCRC){
+			u32 crcIdx = 0xffffffff;
+			crcIdx = xcrc32((u8 *)&idx, sizeof(nv_info_idx_t)-1, crcIdx);
+			if((crcIdx & 0xffff) != ((hdr.checkSum >> 16)&0xffff)){
+				continue;
+			}
+		}
+
+		u8 sgl = (idx.usedState == ITEM_FIELD_VALID_SINGLE);
+		if(nv_write_item(sgl, id, idx.itemId, g_nvCompact.newSect, g_nvCompact.dstIdx, idx.size-sizeof(itemHdr_t), (u8*)idx.offset, TRUE) != NV_SUCC){
+			/* leave the old sector as is */
+			g_nvCompact.state = NV_COMPACT_IDLE;
+			return TRUE;
+		}
+		g_nvCompact.dstIdx++;
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+/*********************************************************************
+ * @fn      nv_compactStep
+ *
+ * @brief   Move the sector update of a module out of nv_flashWriteNew().
+ *          When the free space of the operation sector is low, the other
+ *          sector is erased and the valid items are copied to it here,
+ *          one flash sector erase or one item per call. The sector info
+ *          is written last, so a power cut leaves the old sector valid.
+ *          Writes meanwhile are appended to the old sector and copied
+ *          too, a write to a full sector still updates it in place.
+ *
+ * @param   None
+ *
+ * @return  TRUE if there is more work
+ */
+bool nv_compactStep(void){
+	nv_sect_info_t sectInfo;
+	u8 id = g_nvCompact.id;
+
+	switch(g_nvCompact.state){
+		case NV_COMPACT_IDLE:
+			if(!g_nvCompact.checkMask){
+				return FALSE;
+			}
+			for(id = 0; !(g_nvCompact.checkMask & BIT(id)); id++);
+			g_nvCompact.checkMask &= ~BIT(id);
+			g_nvCompact.id = id;
+			g_nvCompact.state = NV_COMPACT_CHECK;
+			break;
+		case NV_COMPACT_CHECK:
+			g_nvCompact.state = NV_COMPACT_IDLE;
+			if(nv_sector_read(id, MODULE_SECTOR_NUM, &sectInfo) == NV_SUCC &&
+			   !nv_compactFreeCheck(id, sectInfo.opSect)){
+				g_nvCompact.oldSect = sectInfo.opSect;
+				g_nvCompact.state = NV_COMPACT_SCAN;
+			}
+			break;
+		case NV_COMPACT_SCAN:
+			g_nvCompact.state = NV_COMPACT_IDLE;
+			/* drop the old copies of single items, as the sector update does */
+			nv_exceptionDataHandler(0, g_nvCompact.oldSect, id, 0, 0);
+			if(nv_compactGainCheck(id, g_nvCompact.oldSect)){
+				g_nvCompact.newSect = (g_nvCompact.oldSect + 1) & (MODULE_SECTOR_NUM - 1);
+				g_nvCompact.eraseCnt = NV_SECTOR_SIZE(id) / FLASH_SECTOR_SIZE;
+				g_nvCompact.state = NV_COMPACT_ERASE;
+			}
+			break;
+		case NV_COMPACT_ERASE:
+			g_nvCompact.eraseCnt--;
+			flash_erase(MODULE_SECT_START(id, g_nvCompact.newSect) + g_nvCompact.eraseCnt * FLASH_SECTOR_SIZE);
+			if(!g_nvCompact.eraseCnt){
+				g_nvCompact.srcIdx = 0;
+				g_nvCompact.dstIdx = 0;
+				g_nvCompact.state = NV_COMPACT_COPY;
+			}
+			break;
+		case NV_COMPACT_COPY:
+			if(!nv_compactCopyItem()){
+				/* all copied, nothing can be appended to the old sector till the switch */
+				g_nvCompact.state = NV_COMPACT_IDLE;
+				/* single items rewritten after they had been copied */
+				nv_exceptionDataHandler(0, g_nvCompact.newSect, id, 0, 0);
+				nv_sectorSwitch(id, g_nvCompact.oldSect, g_nvCompact.newSect);
+			}
+			break;
+		default:
+			g_nvCompact.state = NV_COMPACT_IDLE;
+			break;
+	}
+
+	return (g_nvCompact.state != NV_COMPACT_IDLE || g_nvCompact.checkMask);
+}
+
+/*********************************************************************
+ * @fn      nv_compactBusy
+ *
+ * @brief   Background compaction is pending, see nv_compactStep().
+ *
+ * @param   None
+ *
+ * @return  TRUE if busy
+ */
+bool nv_compactBusy(void){
+	return (g_nvCompact.state != NV_COMPACT_IDLE || g_nvCompact.checkMask);
+}
+
 
 nv_sts_t nv_flashReadNew(u8 single, u8 id, u8 itemId, u16 len, u8 *buf){
 	nv_sts_t ret = NV_SUCC;
@@ -1016,6 +1464,8 @@ nv_sts_t nv_nwkFrameCountFromFlash(u32 *frameCount){
 }
 
 nv_sts_t nv_resetModule(u8 modules){
+	nv_compactAbort(modules);
+	nv_idxCacheReset(modules);
 	u32 eraseAddr = MODULES_START_ADDR(modules);
 	u8 sectNumber = NV_SECTOR_SIZE(modules)/FLASH_SECTOR_SIZE;
 	for(s32 i = 0; i < MODULE_SECTOR_NUM; i++){
@@ -1042,6 +1492,16 @@ nv_sts_t nv_init(u8 rst){
 		/* if reset is true, erase all flash for NV */
 		nv_resetAll();
 	}
+
+#if NV_INDEX_CACHE_ENABLE
+	/* build the index cache of each module before the stack restores its tables */
+	nv_sect_info_t sectInfo;
+	foreach(i, NV_MAX_MODULS){
+		if(i != NV_MODULE_NWK_FRAME_COUNT){
+			nv_sector_read(i, MODULE_SECTOR_NUM, &sectInfo);
+		}
+	}
+#endif
 	return NV_SUCC;
 }
 
@@ -421,9 +421,24 @@ typedef enum{
 #define FRAMECOUNT_PAYLOAD_START(opSect)		(((MODULE_SECT_START(NV_MODULE_NWK_FRAME_COUNT, opSect) + sizeof(nv_sect_info_t)) + 0x03) & (~0x03))
 #define FRAMECOUNT_NUM_PER_SECT()				((((FLASH_SECTOR_SIZE - sizeof(nv_sect_info_t)) & (~0x03))) / 4)
 
+/* RAM copy of the index of the operation sector, per module, see nv_index_read() */
+#ifndef NV_INDEX_CACHE_ENABLE
+#define NV_INDEX_CACHE_ENABLE					0
+#endif
+
+/* items per module, the ones over it are searched in flash */
+#ifndef NV_INDEX_CACHE_ITEM_NUM
+#define NV_INDEX_CACHE_ITEM_NUM					8
+#endif
+
+/* background compaction starts when less than a quarter of the sector is free */
+#define NV_COMPACT_FREE_SIZE(id)				((NV_SECTOR_SIZE(id) - MODULE_INFO_SIZE(id)) / 4)
+#define NV_COMPACT_FREE_IDX(id)					(MODULE_IDX_NUM(id) / 4)
+
 
 
 
+nv_sts_t nv_init(u8 rst);
 nv_sts_t nv_resetAll(void);
 nv_sts_t nv_resetModule(u8 modules);
 nv_sts_t nv_flashWriteNew(u8 single, u16 id, u8 itemId, u16 len, u8 *buf);
@@ -439,4 +454,7 @@ void nv_facrotyNewRstFlagClear(void);
 nv_sts_t nv_nwkFrameCountSaveToFlash(u32 frameCount);
 nv_sts_t nv_nwkFrameCountFromFlash(u32 *frameCount);
 nv_sts_t nv_flashSingleItemSizeGet(u8 id, u8 itemId, u16 *len);
+bool nv_compactStep(void);
+bool nv_compactBusy(void);
+void nv_compactAbort(u8 id);
 
@@ -388,7 +388,7 @@ void drv_pm_lowPowerEnter(void)
 	ev_timer_event_t *timerEvt = ev_timer_nearestGet();
 	if(timerEvt){
 		wakeupSrc |= PM_WAKEUP_SRC_TIMER;
-		sleepTime = timerEvt->timeout;
+		sleepTime = ev_timer_remainGet(timerEvt);
 
 		if(sleepTime){
 			if(sleepTime > PM_NORMAL_SLEEP_MAX){
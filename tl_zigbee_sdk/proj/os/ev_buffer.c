@@ -27,19 +27,18 @@
 #include "ev_buffer.h"
 
 
-#define DEFAULT_BUFFER_GROUP_NUM                 4
-
 /**************************** Private Variable Definitions *******************/
 typedef struct {
 	mem_pool_t *qHead;
 	u16 size;
 	u8 availBufNum;
-	u8 reserved;
+	u8 bufNum;
 } ev_buf_groups_t;
 
 
 typedef struct bufm_vars {
     ev_buf_groups_t bufGroups[DEFAULT_BUFFER_GROUP_NUM];
+    ev_buf_stats_t stats;
 } ev_buf_vars_t;
 
 
@@ -53,28 +52,21 @@ MEMPOOL_DECLARE(size_2_pool, size_2_mem, BUFFER_GROUP_2, BUFFER_NUM_IN_GROUP2);
 MEMPOOL_DECLARE(size_3_pool, size_3_mem, BUFFER_GROUP_3, BUFFER_NUM_IN_GROUP3);
 
 /*********************************************************************
- * @fn      ev_buf_isExisted
+ * @fn      ev_buf_groupIndex
  *
- * @brief   Return whether the buffer is in the available buffer 
+ * @brief   Return the smallest group which fits the size, the group
+ *          sizes are constants, so there is no walk over bufGroups
  *
- * @param   index
- * @param   block
+ * @param   size - requested size, 1 .. MAX_BUFFER_SIZE
  *
- * @return  TRUE or FALSE
+ * @return  group index
  */
-u8 ev_buf_isExisted(u8 index, mem_block_t *block)
+static inline u8 ev_buf_groupIndex(u16 size)
 {
-    mem_pool_t *pool = (mem_pool_t *)ev_buf_v->bufGroups[index].qHead;
-    mem_block_t *curBlock = pool->free_list;
-
-    while(curBlock){
-        if(block == curBlock){
-            return TRUE;
-        } 
-        curBlock = curBlock->next_block;
-    }
-
-    return FALSE;
+	if(size > BUFFER_GROUP_1 - OFFSETOF(ev_bufItem_t, data)){
+		return (size > BUFFER_GROUP_2 - OFFSETOF(ev_bufItem_t, data)) ? 3 : 2;
+	}
+	return (size > BUFFER_GROUP_0 - OFFSETOF(ev_bufItem_t, data)) ? 1 : 0;
 }
 
 u8 *ev_buf_retrieveMempoolHeader(u8 *pd)
@@ -106,6 +98,14 @@ void ev_buf_reset(void)
         ev_buf_v->bufGroups[i].availBufNum = buffCnt[i];
         ev_buf_v->bufGroups[i].qHead = mempool_init(memPool[i], mem[i], size[i], buffCnt[i]);
         ev_buf_v->bufGroups[i].size = size[i];
+        ev_buf_v->bufGroups[i].bufNum = buffCnt[i];
+
+        /* the tag of a free block survives in the pool, mempool only uses the next pointer */
+        for(u8 j = 0; j < buffCnt[i]; j++){
+            ev_bufItem_t *pBuf = (ev_bufItem_t *)(mem[i] + j * MEMPOOL_ITEMSIZE_2_BLOCKSIZE(size[i]));
+            pBuf->groupIndex = i;
+            pBuf->flag = EV_BUF_FLAG_FREE;
+        }
     }  
 }
 
@@ -146,21 +146,19 @@ u8 *ev_buf_allocate(u16 size)
         /* the size parameter is wrong */
         return NULL;
     }
+    u8 fit = ev_buf_groupIndex(size);
+    u8 index = fit;
     u32 r = drv_disable_irq();
-    u8 index = U8_MAX;
 
-    /* find related the buffer blocks */
-    for(u8 i = 0; i < DEFAULT_BUFFER_GROUP_NUM; i++){
-        if((size <= ev_buf_v->bufGroups[i].size - OFFSETOF(ev_bufItem_t, data)) && ev_buf_v->bufGroups[i].availBufNum){
-            index = i;
-            break;
+    /* the fitting group is empty, borrow from a larger one */
+    while(!ev_buf_v->bufGroups[index].availBufNum){
+        if(++index == DEFAULT_BUFFER_GROUP_NUM){
+            /* no available buffer */
+            ev_buf_v->stats.failCnt[fit]++;
+            drv_restore_irq(r);
+            return NULL;
         }
     }
-    if((index == U8_MAX ) || (!ev_buf_v->bufGroups[index].availBufNum)){
-        /* no available buffer */
-    	drv_restore_irq(r);
-        return NULL;
-    }
     u8 *temp = (u8 *)mempool_alloc(ev_buf_v->bufGroups[index].qHead);
     if(!temp){
     	drv_restore_irq(r);
@@ -168,11 +166,20 @@ u8 *ev_buf_allocate(u16 size)
     }
     ev_buf_v->bufGroups[index].availBufNum--;
 
-    ev_bufItem_t *pNewBuf = (ev_bufItem_t *)(temp - 4);
+    if(index != fit){
+        ev_buf_v->stats.borrowCnt[fit]++;
+    }
+
+    u8 used = ev_buf_v->bufGroups[index].bufNum - ev_buf_v->bufGroups[index].availBufNum;
+    if(used > ev_buf_v->stats.usedMax[index]){
+        ev_buf_v->stats.usedMax[index] = used;
+    }
+
+    ev_bufItem_t *pNewBuf = (ev_bufItem_t *)mempool_header((char *)temp);
     pNewBuf->groupIndex = index;
+    pNewBuf->flag = EV_BUF_FLAG_USED;
 #if EV_BUFFER_DEBUG
     pNewBuf->line = line;
-    pNewBuf->flag = 0xfe;
 #endif
     drv_restore_irq(r);
     return pNewBuf->data;
@@ -213,7 +220,8 @@ buf_sts_t ev_buf_free(u8 *pBuf)
     ev_bufItem_t *pDelBuf = ev_buf_getHead(pBuf);
 
     /* check whether the buffer is duplicated release */
-    if(ev_buf_isExisted(pDelBuf->groupIndex, (mem_block_t *)pDelBuf)){
+    if(pDelBuf->flag != EV_BUF_FLAG_USED){
+        ev_buf_v->stats.dupFreeCnt++;
 
 #if EV_BUFFER_DEBUG
     	T_DBG_evFreeBuf = (u32)pBuf;
@@ -229,9 +237,9 @@ buf_sts_t ev_buf_free(u8 *pBuf)
     mempool_free(ev_buf_v->bufGroups[pDelBuf->groupIndex].qHead, ev_buf_retrieveMempoolHeader(pBuf));
     ev_buf_v->bufGroups[pDelBuf->groupIndex].availBufNum++;    
 
+    pDelBuf->flag = EV_BUF_FLAG_FREE;
 #if EV_BUFFER_DEBUG
     pDelBuf->line = line;
-    pDelBuf->flag = 0xff;
 #endif
 
     drv_restore_irq(r);
@@ -264,11 +272,10 @@ ev_bufItem_t *ev_buf_getHead(u8 *pd)
  */
 u8 *ev_buf_getTail(u8 *pd, int offsetToTail)
 {
-	u32 index;
-	u16 size[DEFAULT_BUFFER_GROUP_NUM] = {BUFFER_GROUP_0, BUFFER_GROUP_1, BUFFER_GROUP_2};
+	u8 index = ev_buf_getHead(pd)->groupIndex;
+	u16 size[DEFAULT_BUFFER_GROUP_NUM] = {BUFFER_GROUP_0, BUFFER_GROUP_1, BUFFER_GROUP_2, BUFFER_GROUP_3};
 
-	memcpy((u8*)&index, pd - 4, 4);
-	assert((index < 3) && (index >= 0));
+	assert(index < DEFAULT_BUFFER_GROUP_NUM);
 	return (u8*)(pd - 8 + size[index] - offsetToTail);
 }
 
@@ -297,4 +304,16 @@ u16 ev_buf_getFreeMaxSize(void)
 	return size;
 }
 
-
+/*********************************************************************
+ * @fn      ev_buf_statsGet
+ *
+ * @brief   Get the EV buffer statistics
+ *
+ * @param   None
+ *
+ * @return  Pointer to the statistics
+ */
+const ev_buf_stats_t *ev_buf_statsGet(void)
+{
+	return &ev_buf_v->stats;
+}
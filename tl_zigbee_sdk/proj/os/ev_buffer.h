@@ -52,6 +52,8 @@
 #define BUFFER_GROUP_3                   	512
 #define MAX_BUFFER_SIZE                  	(BUFFER_GROUP_3 - OFFSETOF(ev_bufItem_t, data))
 
+#define DEFAULT_BUFFER_GROUP_NUM            4
+
 /** @} end of group ev_buffer_groups */
 
 /**
@@ -84,16 +86,29 @@
  */
 typedef struct ev_bufItem {
     struct ev_bufItem *next;
-#if EV_BUFFER_DEBUG
     u8  groupIndex;
-    u8  flag;
+    u8  flag;           //!< EV_BUF_FLAG_USED or EV_BUF_FLAG_FREE
+#if EV_BUFFER_DEBUG
     u16 line;
 #else
-    u32 groupIndex;
+    u16 reserved;
 #endif
     u8  data[1];
 } ev_bufItem_t;
 
+#define EV_BUF_FLAG_USED					0xfe
+#define EV_BUF_FLAG_FREE					0xff
+
+/**
+ *  @brief Definition of the EV buffer statistics, to size the buffer groups
+ */
+typedef struct {
+	u8  usedMax[DEFAULT_BUFFER_GROUP_NUM];		//!< high-water mark of the used buffers
+	u16 borrowCnt[DEFAULT_BUFFER_GROUP_NUM];	//!< served from a larger group, this one was empty
+	u16 failCnt[DEFAULT_BUFFER_GROUP_NUM];		//!< no buffer in this and larger groups
+	u16 dupFreeCnt;								//!< the same buffer freed more than once
+} ev_buf_stats_t;
+
 /**
  *  @brief Definition error code of EV buffer operation
  */
@@ -181,6 +196,15 @@ u8 is_ev_buf(void *arg);
 
 u16 ev_buf_getFreeMaxSize(void);
 
+/**
+ * @brief       Get the EV buffer statistics, they are cleared by ev_buf_reset()
+ *
+ * @param       None
+ *
+ * @return      Pointer to the statistics
+ */
+const ev_buf_stats_t *ev_buf_statsGet(void);
+
 u8 *long_ev_buf_get(void);
 /**  @} end of group EV_BUFFER_FUNCTIONS */
 
@@ -27,8 +27,10 @@
 #include "ev_timer.h"
 
 typedef struct{
-	ev_timer_event_t *timer_head;		//timer events is sorted, use single linked list
-	ev_timer_event_t *timer_nearest;	//the nearest fired timer
+	ev_timer_event_t *timer_head;		//timer events is sorted by deadline, use single linked list
+	ev_timer_event_t *timer_expired;	//expired timer events, callbacks are being executed
+	ev_timer_event_t *timer_free;		//free timer events of the pool
+	u32 timer_now;						//in millisecond, time base of the deadlines
 
 	ev_timer_event_pool_t timerEventPool;
 }ev_timer_ctrl_t;
@@ -39,9 +41,17 @@ ev_timer_ctrl_t ev_timer;
 static u32 prevSysTick = 0;
 static u32 remSysTick = 0;
 
+#define EV_TIMER_TICK_1MS			(S_TIMER_CLOCK_1US * 1000)
+#define EV_TIMER_EXPIRED(evt, now)	((s32)((evt)->deadline - (now)) <= 0)
+
 void ev_timer_init(void)
 {
 	memset((u8 *)&ev_timer, 0, sizeof(ev_timer));
+
+	for(s32 i = g_ev_timer_maxNum - 1; i >= 0; i--){
+		ev_timer.timerEventPool.evt[i].next = ev_timer.timer_free;
+		ev_timer.timer_free = &ev_timer.timerEventPool.evt[i];
+	}
 }
 
 void ev_timer_setPrevSysTick(u32 tick)
@@ -51,51 +61,76 @@ void ev_timer_setPrevSysTick(u32 tick)
 
 ev_timer_event_t *ev_timer_nearestGet(void)
 {
-	return ev_timer.timer_nearest;
+	return ev_timer.timer_head;
 }
 
-ev_timer_event_t *ev_timer_freeGet(void)
+u32 ev_timer_remainGet(ev_timer_event_t *evt)
 {
-	if(ev_timer.timerEventPool.used_num >= g_ev_timer_maxNum){
-		return NULL;
+	if(EV_TIMER_EXPIRED(evt, ev_timer.timer_now)){
+		return 0;
 	}
+	return evt->deadline - ev_timer.timer_now;
+}
 
-	for(u8 i = 0; i < g_ev_timer_maxNum; i++){
-		if(ev_timer.timerEventPool.evt[i].used == 0){
-			ev_timer.timerEventPool.evt[i].used = 1;
-			ev_timer.timerEventPool.used_num++;
-			return &ev_timer.timerEventPool.evt[i];
-		}
+/* current time, including the ticks not yet passed to ev_timer_update() */
+static u32 ev_timer_nowGet(void)
+{
+	return ev_timer.timer_now + (clock_time() - prevSysTick + remSysTick) / EV_TIMER_TICK_1MS;
+}
+
+ev_timer_event_t *ev_timer_freeGet(void)
+{
+	ev_timer_event_t *timerEvt = ev_timer.timer_free;
+
+	if(timerEvt){
+		ev_timer.timer_free = timerEvt->next;
+		timerEvt->next = NULL;
+		timerEvt->used = 1;
+		ev_timer.timerEventPool.used_num++;
 	}
 
-	return NULL;
+	return timerEvt;
 }
 
 void ev_timer_poolDelUpdate(ev_timer_event_t *evt)
 {
-	evt->isRunning = 0;
-	evt->curSysTick = 0;
-
 	if(((u32)evt >= (u32)&ev_timer.timerEventPool.evt[0]) &&
 	   ((u32)evt <= (u32)&ev_timer.timerEventPool.evt[g_ev_timer_maxNum - 1]) &&
 	   (evt->used)){
 		evt->used = 0;
 		ev_timer.timerEventPool.used_num--;
+
+		evt->next = ev_timer.timer_free;
+		ev_timer.timer_free = evt;
 	}
 }
 
-void ev_timer_nearestUpdate(void)
+static bool ev_timer_listDelete(ev_timer_event_t **head, ev_timer_event_t *evt)
 {
-	ev_timer_event_t *timerEvt = ev_timer.timer_head;
-
-	ev_timer.timer_nearest = ev_timer.timer_head;
+	ev_timer_event_t **p = head;
 
-	while(timerEvt){
-		if(timerEvt->timeout < ev_timer.timer_nearest->timeout){
-			ev_timer.timer_nearest = timerEvt;
+	while(*p){
+		if(*p == evt){
+			*p = evt->next;
+			evt->next = NULL;
+			return TRUE;
 		}
-		timerEvt = timerEvt->next;
+		p = &(*p)->next;
 	}
+	return FALSE;
+}
+
+/* timers with the same deadline are kept in the order of adding */
+static void ev_timer_listInsert(ev_timer_event_t *evt)
+{
+	ev_timer_event_t **p = &ev_timer.timer_head;
+
+	while(*p && (s32)((*p)->deadline - evt->deadline) <= 0){
+		p = &(*p)->next;
+	}
+
+	evt->next = *p;
+	*p = evt;
 }
 
 bool ev_timer_enough(void)
@@ -108,14 +143,18 @@ bool ev_timer_enough(void)
 
 bool ev_timer_exist(ev_timer_event_t *evt)
 {
-	ev_timer_event_t *timerEvt = ev_timer.timer_head;
-
-    while(timerEvt){
-        if(timerEvt == evt){
-            return TRUE;
-        }
-        timerEvt = timerEvt->next;
-    }
+	ev_timer_event_t *lists[] = {ev_timer.timer_head, ev_timer.timer_expired};
+
+	for(u8 i = 0; i < sizeof(lists)/sizeof(lists[0]); i++){
+		ev_timer_event_t *timerEvt = lists[i];
+
+		while(timerEvt){
+			if(timerEvt == evt){
+				return TRUE;
+			}
+			timerEvt = timerEvt->next;
+		}
+	}
     return FALSE;
 }
 
@@ -126,24 +165,18 @@ void ev_on_timer(ev_timer_event_t *evt, u32 timeout)
 		return;
 	}
 
-	evt->period = timeout;
-
 	u32 r = drv_disable_irq();
 
-	ev_timer_event_t *out = NULL;
-
-	LIST_EXIST(ev_timer.timer_head, evt, out);
-	if(out){
-		out->timeout = evt->period;
-	}else{
-		if(evt->isRunning == 0){
-			evt->curSysTick = clock_time();
-		}
-		evt->timeout = evt->period;
-		LIST_ADD(ev_timer.timer_head, evt);
+	/* restart if it already exists */
+	if(!ev_timer_listDelete(&ev_timer.timer_head, evt)){
+		ev_timer_listDelete(&ev_timer.timer_expired, evt);
 	}
 
-	ev_timer_nearestUpdate();
+	evt->period = timeout;
+	evt->timeout = timeout;
+	evt->deadline = ev_timer_nowGet() + timeout;
+
+	ev_timer_listInsert(evt);
 
 	drv_restore_irq(r);
 }
@@ -155,19 +188,12 @@ void ev_unon_timer(ev_timer_event_t *evt)
 		return;
 	}
 
-	ev_timer_event_t *out = NULL;
-	LIST_EXIST(ev_timer.timer_head, evt, out);
-	if(!out){
-		return;
-	}
-
 	u32 r = drv_disable_irq();
 
-	ev_timer_poolDelUpdate(evt);
-
-	LIST_DELETE(ev_timer.timer_head, evt);
-
-	ev_timer_nearestUpdate();
+	if(ev_timer_listDelete(&ev_timer.timer_head, evt) ||
+	   ev_timer_listDelete(&ev_timer.timer_expired, evt)){
+		ev_timer_poolDelUpdate(evt);
+	}
 
 	drv_restore_irq(r);
 }
@@ -221,6 +247,7 @@ u8 ev_timer_taskCancel(ev_timer_event_t **evt)
 	return SUCCESS;
 }
 
+/* deadlines are absolute, only the time base is moved */
 void ev_timer_update(u32 updateTime)
 {
 	if(updateTime == 0){
@@ -229,72 +256,63 @@ void ev_timer_update(u32 updateTime)
 
 	u32 r = drv_disable_irq();
 
-	u32 updateTimeMs = 0;
-	u32 curSysTick = clock_time();
-
 	ev_rtc_update(updateTime);
 
-	ev_timer_event_t *timerEvt = ev_timer.timer_head;
+	ev_timer.timer_now += updateTime;
 
-	while(timerEvt){
-		if(timerEvt->isRunning){
-			/* Elapsed time, including time that may be blocked. */
-			updateTimeMs = updateTime;
-		}else{
-			/* Just calculate the elapsed time from the time of registration to the present. */
-			updateTimeMs = (curSysTick - timerEvt->curSysTick) / (S_TIMER_CLOCK_1US * 1000);
+	drv_restore_irq(r);
+}
 
-			timerEvt->isRunning = 1;
-		}
+void ev_timer_executeCB(void)
+{
+	u32 r = drv_disable_irq();
 
-		if(timerEvt->timeout > updateTimeMs){
-			timerEvt->timeout -= updateTimeMs;
-		}else{
-			timerEvt->timeout = 0;
-		}
+	/* the list is sorted, expired timers are at the head */
+	ev_timer_event_t **p = &ev_timer.timer_head;
+	while(*p && EV_TIMER_EXPIRED(*p, ev_timer.timer_now)){
+		p = &(*p)->next;
+	}
 
-		timerEvt = timerEvt->next;
+	if(p != &ev_timer.timer_head){
+		ev_timer.timer_expired = ev_timer.timer_head;
+		ev_timer.timer_head = *p;
+		*p = NULL;
 	}
 
 	drv_restore_irq(r);
-}
 
-void ev_timer_executeCB(void)
-{
-	ev_timer_event_t *timerEvt = ev_timer.timer_head;
-	ev_timer_event_t *prev_head = timerEvt;
+	/* timers added or restarted by callbacks are not executed until the next time */
+	while(ev_timer.timer_expired){
+		ev_timer_event_t *timerEvt = ev_timer.timer_expired;
 
-	while(timerEvt){
-		if(timerEvt->timeout == 0){
-			/* start executing callback function */
-			timerEvt->isBusy = 1;
+		/* start executing callback function */
+		timerEvt->isBusy = 1;
 
-			s32 t = timerEvt->cb(timerEvt->data);
+		s32 t = timerEvt->cb(timerEvt->data);
 
-			if(t < 0){
-				ev_unon_timer(timerEvt);
-			}else if(t == 0){
-				timerEvt->timeout = timerEvt->period;
-			}else{
-				timerEvt->period = (u32)t;
-				timerEvt->timeout = timerEvt->period;
-			}
+		/* callback function execution ended */
+		timerEvt->isBusy = 0;
 
-			/* callback function execution ended */
-			timerEvt->isBusy = 0;
+		r = drv_disable_irq();
 
-			if(prev_head != ev_timer.timer_head){
-				timerEvt = ev_timer.timer_head;
-				prev_head = timerEvt;
+		/* still expired unless it was restarted or cancelled by the callback */
+		if(ev_timer_listDelete(&ev_timer.timer_expired, timerEvt)){
+			if(t < 0){
+				ev_timer_poolDelUpdate(timerEvt);
 			}else{
-				timerEvt = timerEvt->next;
+				if(t > 0){
+					timerEvt->period = (u32)t;
+				}
+				timerEvt->timeout = timerEvt->period;
+				timerEvt->deadline = ev_timer.timer_now + timerEvt->period;
+				ev_timer_listInsert(timerEvt);
 			}
-		}else{
-			timerEvt = timerEvt->next;
+		}else if(t < 0){
+			ev_unon_timer(timerEvt);
 		}
-	}
 
-	ev_timer_nearestUpdate();
+		drv_restore_irq(r);
+	}
 }
 
 void ev_timer_process(void)
@@ -309,11 +327,11 @@ void ev_timer_process(void)
 		/* store current ticks. */
 		prevSysTick = currSysTick;
 
-		updateTime = sysTicks / (S_TIMER_CLOCK_1US * 1000);
-		remSysTick += sysTicks % (S_TIMER_CLOCK_1US * 1000);
+		updateTime = sysTicks / EV_TIMER_TICK_1MS;
+		remSysTick += sysTicks % EV_TIMER_TICK_1MS;
 
-		updateTime += remSysTick / (S_TIMER_CLOCK_1US * 1000);
-		remSysTick = remSysTick % (S_TIMER_CLOCK_1US * 1000);
+		updateTime += remSysTick / EV_TIMER_TICK_1MS;
+		remSysTick = remSysTick % EV_TIMER_TICK_1MS;
 
 		/* more than 1 ms. */
 		if(updateTime){
@@ -321,6 +339,8 @@ void ev_timer_process(void)
 		}
 
 		/* execute callback */
-		ev_timer_executeCB();
+		if(ev_timer.timer_head && EV_TIMER_EXPIRED(ev_timer.timer_head, ev_timer.timer_now)){
+			ev_timer_executeCB();
+		}
 	}
 }
@@ -45,12 +45,12 @@ typedef struct ev_timer_event_t {
 
     ev_timer_callback_t     cb;     //!< Callback function when expire, this must be specified
     void *data;         			//!< Callback function arguments.
-    u32 timeout;             		//!< In millisecond
+    u32 timeout;             		//!< In millisecond, the last requested timeout
     u32 period;      				//!< Used internal
-    u32 curSysTick;					//!< Used internal, system tick when registering
+    u32 deadline;					//!< Used internal, expire time in millisecond of the timer time base
 	u8 resv;
 	u8 isBusy;						//!< Used internal
-	u8 isRunning;					//!< Used internal
+	u8 resv1;
     u8 used;						//!< Used internal
 } ev_timer_event_t;
 
@@ -91,6 +91,15 @@ void ev_timer_process(void);
  */
 ev_timer_event_t *ev_timer_nearestGet(void);
 
+/**
+ * @brief       Get the time left until a timer event expires
+ *
+ * @param[in]   evt  - The timer event
+ *
+ * @return      Time in millisecond, 0 if the timer is already expired
+ */
+u32 ev_timer_remainGet(ev_timer_event_t *evt);
+
 /**
   * @brief       Check whether a specified timer exist or not
   *
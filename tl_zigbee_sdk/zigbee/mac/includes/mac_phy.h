@@ -188,6 +188,18 @@ void rf_setRxBuf(u8 *pBuf);
  */
 u8 rf_TrxStateGet(void);
 
+/*********************************************************************
+ * @fn      rf_stateTimeGet
+ *
+ * @brief   Get the time in each TRX state since the previous call
+ *          and start counting again.
+ *
+ * @param   pTime - RF_STATE_OFF + 1 values in us, NULL - only restart
+ *
+ * @return  none
+ */
+void rf_stateTimeGet(u32 *pTime);
+
 /*********************************************************************
  * @fn      rf_setTrxState
  *
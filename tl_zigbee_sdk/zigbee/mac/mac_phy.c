@@ -80,15 +80,27 @@ u8 fPtaEn = 0;
 u32 rf_pta_priority_pin = 0;
 u32 rf_pta_active_pin = 0;
 
+//time in each rfMode since the last rf_stateTimeGet(), for the energy accounting
+static u32 rf_stateTime[RF_STATE_OFF + 1];
+static u32 rf_stateTick = 0;
+
 static bool isWLANActive(void);
 
 /**********************************************************************
  * LOCAL FUNCTIONS
  */
+//close the time of the current rfMode, called before it is changed
+#define RF_STATE_TIME_UPDATE()	do{	\
+									u32 now = clock_time();	\
+									rf_stateTime[rfMode] += (now - rf_stateTick) / sys_tick_per_us;	\
+									rf_stateTick = now;	\
+								}while(0)
+
 #if RF_SRX_MODE
 //switch single RX to manual TX
 #define ZB_SWITCH_TO_TXMODE()    do{ \
 									if(rfMode != RF_STATE_TX || ZB_RADIO_TRX_STA_GET() != RF_MODE_TX){	\
+										RF_STATE_TIME_UPDATE();	\
 										rfMode = RF_STATE_TX;	\
 										if(fPaEn){	\
 											drv_gpio_write(rf_pa_txen_pin, 1); 		\
@@ -105,6 +117,7 @@ static bool isWLANActive(void);
 //switch manual TX to single RX
 #define ZB_SWITCH_TO_RXMODE()	do{	\
 									if(rfMode != RF_STATE_RX || ZB_RADIO_TRX_STA_GET() != RF_MODE_AUTO){	\
+										RF_STATE_TIME_UPDATE();	\
 										rfMode = RF_STATE_RX;	\
 										if(fPaEn){	\
 											drv_gpio_write(rf_pa_txen_pin, 0); 		\
@@ -121,6 +134,7 @@ static bool isWLANActive(void);
 //switch manual RX to manual TX
 #define ZB_SWITCH_TO_TXMODE()    do{ \
 									if(rfMode != RF_STATE_TX || ZB_RADIO_TRX_STA_GET() != RF_MODE_TX){	\
+										RF_STATE_TIME_UPDATE();	\
 										rfMode = RF_STATE_TX;	\
 										if(fPaEn){	\
 											drv_gpio_write(rf_pa_txen_pin, 1); 		\
@@ -136,6 +150,7 @@ static bool isWLANActive(void);
 //switch manual TX to manual RX
 #define ZB_SWITCH_TO_RXMODE()    do{ \
 									if(rfMode != RF_STATE_RX || ZB_RADIO_TRX_STA_GET() != RF_MODE_RX){	\
+										RF_STATE_TIME_UPDATE();	\
 										rfMode = RF_STATE_RX;	\
 										if(fPaEn){	\
 											drv_gpio_write(rf_pa_txen_pin, 0); 		\
@@ -151,6 +166,7 @@ static bool isWLANActive(void);
 
 #define ZB_SWITCH_TO_OFFMODE()	do{	\
 									if(rfMode != RF_STATE_OFF || ZB_RADIO_TRX_STA_GET() != RF_MODE_OFF){	\
+										RF_STATE_TIME_UPDATE();	\
 										rfMode = RF_STATE_OFF;	\
 										rf_paShutDown();		\
 										if(fPtaEn){	\
@@ -269,6 +285,30 @@ u8 rf_TrxStateGet(void)
 	return rfMode;
 }
 
+/*********************************************************************
+ * @fn      rf_stateTimeGet
+ *
+ * @brief   Get the time in each TRX state since the previous call
+ *          and start counting again.
+ *
+ * @param   pTime - RF_STATE_OFF + 1 values in us, NULL - only restart,
+ *                  e.g. after the sleep
+ *
+ * @return  none
+ */
+void rf_stateTimeGet(u32 *pTime)
+{
+	u32 r = drv_disable_irq();
+
+	RF_STATE_TIME_UPDATE();
+	if(pTime){
+		memcpy(pTime, rf_stateTime, sizeof(rf_stateTime));
+	}
+	memset(rf_stateTime, 0, sizeof(rf_stateTime));
+
+	drv_restore_irq(r);
+}
+
 /*********************************************************************
  * @fn      rf_setTrxState
  *
@@ -319,6 +359,7 @@ void rf_setChannel(u8 chn)
 
 	u8 phySta = ZB_RADIO_TRX_STA_GET();
 	ZB_RADIO_TRX_SWITCH(phySta, LOGICCHANNEL_TO_PHYSICAL(chn));
+	RF_STATE_TIME_UPDATE();
 	if(phySta == RF_MODE_RX || phySta == RF_MODE_AUTO) {
 		rfMode = RF_STATE_RX;
 	}else if(phySta == RF_MODE_TX){
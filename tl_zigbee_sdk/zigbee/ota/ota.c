@@ -35,6 +35,30 @@
 #define FLASH_WRITE_COUNT_GET(size)		((size / (110 * OTA_IMAGE_MAX_DATA_SIZE)) + 1)
 #define TL_IMAGE_START_FLAG				0x4b
 #define TL_START_UP_FLAG_WHOLE			0x544c4e4b
+#define TL_IMAGE_SIZE_OFFSET			0x18
+
+/*
+ * OTA_UPGRADE_IMAGE_LZ_TAG_ID element, made by tools/make_ota.py
+ * header: u32 image length, u32 CRC of the running image (0 - no delta)
+ * token:  bits 7-6 type, bits 5-0 count - 1, 0x3f - u16 count - 64 follows
+ *         literal - count bytes follow
+ *         copy    - u24 source offset follows, source must not overlap the output
+ */
+#define OTA_LZ_HDR_LEN					8
+#define OTA_LZ_CNT_MAX					4096
+#define OTA_LZ_CNT_MASK					0x3f
+#define OTA_LZ_TYPE_MASK				0xc0
+#define OTA_LZ_TYPE_LITERAL				0x00
+#define OTA_LZ_TYPE_COPY_NEW			0x40	//from the image being downloaded
+#define OTA_LZ_TYPE_COPY_RUN			0x80	//from the running image
+
+enum{
+	OTA_LZ_STATE_HDR,
+	OTA_LZ_STATE_TOKEN,
+	OTA_LZ_STATE_CNT_EXT,
+	OTA_LZ_STATE_SRC,
+	OTA_LZ_STATE_LITERAL,
+};
 
 /**********************************************************************
  * TYPEDEFS
@@ -51,6 +75,12 @@ typedef struct _attribute_packed_{
 	ota_serverAddr_t  	otaServerAddrInfo;
 }ota_updateInfo_t;
 
+typedef struct{
+	u32 addr;						//flash address of buf[0]
+	u16 len;						//bytes in buf, never cross the page of addr
+	u8	buf[FLASH_PAGE_SIZE];
+}ota_pageBuf_t;
+
 #if 0
 u8 ota_imageNotifyHandler(apsdeDataInd_t *pInd, ota_imageNotify_t *pImageNotify);
 u8 ota_queryNextImageReqHandler(apsdeDataInd_t *pInd, ota_queryNextImageReq_t *pQueryNextImageReq);
@@ -108,15 +138,27 @@ bool g_otaEncryptionNeeded = 0;
 
 ev_timer_event_t otaTimer;
 
+//image data is collected here and written to flash by whole pages
+static ota_pageBuf_t otaPageBuf;
+
+#if OTA_IMAGE_PAGE_SIZE
+//file offset after the last block of the requested image page
+static u32 otaPageEndOffset = 0;
+//server does not answer image page req
+static bool otaPageReqDisable = FALSE;
+#endif
+
 /**********************************************************************
  * FUNCTIONS
  */
 void ota_queryNextImageReq(u8 dstEp, u16 dstAddr, u16 profileId);
 void ota_imageBlockReq(u8 dstEp, u16 dstAddr, u16 profileId);
+void ota_imagePageReq(u8 dstEp, u16 dstAddr, u16 profileId);
 void ota_sendImageBlockReq(void *arg);
 void ota_upgradeEndReqSend(ota_upgradeEndReq_t *req);
 void ota_upgradeWait(u32 seconds);
 void ota_upgradeComplete(u8 status);
+static bool ota_clientInfoVerify(void);
 
 /**********************************************************************
  * @brief		get mcu boot address
@@ -280,7 +322,26 @@ void ota_clientInfoRecover(void)
 	if(pInfo){
 		if(nv_flashReadNew(1, NV_MODULE_OTA, NV_ITEM_OTA_HDR_SERVERINFO, sizeof(ota_updateInfo_t), (u8 *)pInfo) == NV_SUCC){
 			if(pInfo->hdrInfo.otaUpgradeFileID == OTA_UPGRADE_FILE_ID){
-				if(nv_flashReadNew(1, NV_MODULE_OTA, NV_ITEM_OTA_CODE, sizeof(ota_clientInfo_t), (u8 *)&otaClientInfo) != NV_SUCC){
+				u16 infoLen = 0;
+				if(nv_flashSingleItemSizeGet(NV_MODULE_OTA, NV_ITEM_OTA_CODE, &infoLen) != NV_SUCC){
+					ev_buf_free((u8 *)pInfo);
+					return;
+				}
+
+				//a checkpoint of another layout, e.g. saved by the firmware before the update, is never resumed
+				if((infoLen != sizeof(ota_clientInfo_t)) ||
+				   (nv_flashReadNew(1, NV_MODULE_OTA, NV_ITEM_OTA_CODE, sizeof(ota_clientInfo_t), (u8 *)&otaClientInfo) != NV_SUCC) ||
+				   (otaClientInfo.infoVer != OTA_CLIENT_INFO_VER)){
+					ota_clientInfoReset();
+					ev_buf_free((u8 *)pInfo);
+					return;
+				}
+
+				//flash does not match the checkpoint, the download starts from the beginning
+				if(ota_clientInfoVerify() != TRUE){
+					memset((u8 *)&otaClientInfo, 0, sizeof(otaClientInfo));
+					otaClientInfo.clientOtaFlg = OTA_FLAG_INIT_DONE;
+					otaClientInfo.crcValue = 0xffffffff;
 					ev_buf_free((u8 *)pInfo);
 					return;
 				}
@@ -582,8 +643,401 @@ void ota_queryStart(u16 seconds)
 	}
 }
 
+/**********************************************************************
+ * @brief		discard the image data not written to flash yet
+ */
+static void ota_pageBufReset(void)
+{
+	otaPageBuf.len = 0;
+}
+
+/**********************************************************************
+ * @brief		write the collected image data to flash
+ *
+ * return 		TRUE - written and verified, or nothing to write
+ */
+static bool ota_pageBufFlush(void)
+{
+	if(otaPageBuf.len){
+		if(flash_writeWithCheck(otaPageBuf.addr, otaPageBuf.len, otaPageBuf.buf) != TRUE){
+			return FALSE;
+		}
+		otaPageBuf.addr += otaPageBuf.len;
+		otaPageBuf.len = 0;
+	}
+
+	return TRUE;
+}
+
+/**********************************************************************
+ * @brief		collect image data, the page is written when it is full
+ *
+ * return 		TRUE - success
+ */
+static bool ota_pageBufWrite(u32 addr, u32 len, u8 *pData)
+{
+	while(len){
+		if(otaPageBuf.len && (addr != otaPageBuf.addr + otaPageBuf.len)){
+			if(ota_pageBufFlush() != TRUE){
+				return FALSE;
+			}
+		}
+		if(!otaPageBuf.len){
+			otaPageBuf.addr = addr;
+		}
+
+		u32 room = FLASH_PAGE_SIZE - ((otaPageBuf.addr + otaPageBuf.len) & (FLASH_PAGE_SIZE - 1));
+		u32 copyLen = (len < room) ? len : room;
+
+		memcpy(&otaPageBuf.buf[otaPageBuf.len], pData, copyLen);
+		otaPageBuf.len += copyLen;
+		addr += copyLen;
+		pData += copyLen;
+		len -= copyLen;
+
+		if(copyLen == room){
+			if(ota_pageBufFlush() != TRUE){
+				return FALSE;
+			}
+		}
+	}
+
+	return TRUE;
+}
+
+/**********************************************************************
+ * @brief		end of the image data covered by the CRC, the CRC itself follows
+ */
+static u32 ota_imageDataEnd(void)
+{
+	if(otaClientInfo.otaElementTag == OTA_UPGRADE_IMAGE_LZ_TAG_ID){
+		return otaClientInfo.otaOutLen;
+	}
+
+	return otaClientInfo.otaElementLen - otaClientInfo.otaElementInfo2;
+}
+
+/**********************************************************************
+ * @brief		image bytes written so far
+ */
+static u32 ota_imageDataPos(void)
+{
+	if(otaClientInfo.otaElementTag == OTA_UPGRADE_IMAGE_LZ_TAG_ID){
+		return otaClientInfo.otaOutPos;
+	}
+
+	return otaClientInfo.otaElementPos;
+}
+
+/**********************************************************************
+ * @brief		image data to flash, with CRC and start flag check
+ *
+ * return 		TRUE - success
+ */
+static bool ota_imageWrite(u32 pos, u8 *pData, u32 len)
+{
+	u32 dataEndPos = ota_imageDataEnd();
+
+	//Calculate CRC value
+	if(pos + 4 < dataEndPos){
+		u32 crcLen = (dataEndPos - 4 - pos < len) ? (dataEndPos - 4 - pos) : len;
+		otaClientInfo.crcValue = xcrc32(pData, crcLen, otaClientInfo.crcValue);
+	}
+
+	if((pos <= FLASH_TLNK_FLAG_OFFSET) && (FLASH_TLNK_FLAG_OFFSET < pos + len)){
+		if(pData[FLASH_TLNK_FLAG_OFFSET - pos] != TL_IMAGE_START_FLAG){
+			return FALSE;
+		}
+		pData[FLASH_TLNK_FLAG_OFFSET - pos] = 0xff;
+	}
+
+	u32 baseAddr = (mcuBootAddr) ? 0 : FLASH_ADDR_OF_OTA_IMAGE;
+	return ota_pageBufWrite(baseAddr + pos, len, pData);
+}
+
+/**********************************************************************
+ * @brief		CRC of the running image, the delta is made against it
+ */
+static u32 ota_lzBaseCrcGet(void)
+{
+	u32 fwLen = 0;
+	u32 crc = 0;
+
+	flash_read(mcuBootAddr + TL_IMAGE_SIZE_OFFSET, 4, (u8 *)&fwLen);
+	if((fwLen < 4) || (fwLen > FLASH_OTA_IMAGE_MAX_SIZE)){
+		return 0;
+	}
+	flash_read(mcuBootAddr + fwLen - 4, 4, (u8 *)&crc);
+
+	return crc;
+}
+
+/**********************************************************************
+ * @brief		copy from the image being downloaded or from the running image
+ *
+ * return 		TRUE - success
+ */
+static bool ota_lzCopy(void)
+{
+	u32 cnt = otaClientInfo.lzCnt;
+	u32 srcAddr;
+	u8 buf[64];
+
+	if(otaClientInfo.otaOutPos + cnt > otaClientInfo.otaOutLen){
+		return FALSE;
+	}
+
+	if((otaClientInfo.lzToken & OTA_LZ_TYPE_MASK) == OTA_LZ_TYPE_COPY_RUN){
+		if(!otaClientInfo.lzBase || (otaClientInfo.lzSrc + cnt > FLASH_OTA_IMAGE_MAX_SIZE)){
+			return FALSE;
+		}
+		srcAddr = mcuBootAddr + otaClientInfo.lzSrc;
+	}else{
+		if(otaClientInfo.lzSrc + cnt > otaClientInfo.otaOutPos){
+			return FALSE;
+		}
+		srcAddr = ((mcuBootAddr) ? 0 : FLASH_ADDR_OF_OTA_IMAGE) + otaClientInfo.lzSrc;
+	}
+
+	while(cnt){
+		u32 len = (cnt < sizeof(buf)) ? cnt : sizeof(buf);
+
+		flash_read(srcAddr, len, buf);
+		//the source may be still in the page buffer
+		if(otaPageBuf.len && (srcAddr + len > otaPageBuf.addr) && (srcAddr < otaPageBuf.addr + otaPageBuf.len)){
+			u32 from = (srcAddr > otaPageBuf.addr) ? srcAddr : otaPageBuf.addr;
+			u32 to = (srcAddr + len < otaPageBuf.addr + otaPageBuf.len) ? (srcAddr + len) : (otaPageBuf.addr + otaPageBuf.len);
+			memcpy(&buf[from - srcAddr], &otaPageBuf.buf[from - otaPageBuf.addr], to - from);
+		}
+		//start flag is cleared in flash until the upgrade
+		if((otaClientInfo.lzSrc <= FLASH_TLNK_FLAG_OFFSET) && (FLASH_TLNK_FLAG_OFFSET < otaClientInfo.lzSrc + len)){
+			buf[FLASH_TLNK_FLAG_OFFSET - otaClientInfo.lzSrc] = TL_IMAGE_START_FLAG;
+		}
+		if(ota_imageWrite(otaClientInfo.otaOutPos, buf, len) != TRUE){
+			return FALSE;
+		}
+
+		srcAddr += len;
+		otaClientInfo.lzSrc += len;
+		otaClientInfo.otaOutPos += len;
+		cnt -= len;
+	}
+
+	return TRUE;
+}
+
+/**********************************************************************
+ * @brief		count of the token is known
+ */
+static void ota_lzCntDone(void)
+{
+	otaClientInfo.lzIdx = 0;
+	otaClientInfo.lzSrc = 0;
+	otaClientInfo.lzState = ((otaClientInfo.lzToken & OTA_LZ_TYPE_MASK) == OTA_LZ_TYPE_LITERAL) ? OTA_LZ_STATE_LITERAL
+																								 : OTA_LZ_STATE_SRC;
+}
+
+/**********************************************************************
+ * @brief		streaming decoder of the OTA_UPGRADE_IMAGE_LZ_TAG_ID element
+ *
+ * return 		TRUE - success
+ */
+static bool ota_lzDecode(u8 *pData, u32 len)
+{
+	u32 i = 0;
+
+	while(i < len){
+		switch(otaClientInfo.lzState)
+		{
+			case OTA_LZ_STATE_HDR:
+				if(otaClientInfo.lzIdx < 4){
+					otaClientInfo.otaOutLen |= (u32)pData[i++] << (8 * otaClientInfo.lzIdx);
+				}else{
+					otaClientInfo.lzSrc |= (u32)pData[i++] << (8 * (otaClientInfo.lzIdx - 4));
+				}
+				if(++otaClientInfo.lzIdx == OTA_LZ_HDR_LEN){
+					if((otaClientInfo.otaOutLen > FLASH_OTA_IMAGE_MAX_SIZE) || (otaClientInfo.otaOutLen <= 4)){
+						return FALSE;
+					}
+					//the slot is erased for the file at the start, the decoded image may be longer
+					u32 baseAddr = (mcuBootAddr) ? 0 : FLASH_ADDR_OF_OTA_IMAGE;
+					for(u32 sect = g_otaCtx.downloadImageSize / FLASH_SECTOR_SIZE + 1; sect * FLASH_SECTOR_SIZE < otaClientInfo.otaOutLen; sect++){
+						flash_erase(baseAddr + sect * FLASH_SECTOR_SIZE);
+					}
+					//delta is made against another image
+					if(otaClientInfo.lzSrc){
+						if(otaClientInfo.lzSrc != ota_lzBaseCrcGet()){
+							return FALSE;
+						}
+						otaClientInfo.lzBase = 1;
+					}
+					otaClientInfo.lzState = OTA_LZ_STATE_TOKEN;
+				}
+				break;
+			case OTA_LZ_STATE_TOKEN:
+				otaClientInfo.lzToken = pData[i++];
+				if((otaClientInfo.lzToken & OTA_LZ_TYPE_MASK) == OTA_LZ_TYPE_MASK){
+					return FALSE;
+				}
+				otaClientInfo.lzCnt = (otaClientInfo.lzToken & OTA_LZ_CNT_MASK) + 1;
+				if(otaClientInfo.lzCnt == OTA_LZ_CNT_MASK + 1){
+					otaClientInfo.lzIdx = 0;
+					otaClientInfo.lzSrc = 0;
+					otaClientInfo.lzState = OTA_LZ_STATE_CNT_EXT;
+				}else{
+					ota_lzCntDone();
+				}
+				break;
+			case OTA_LZ_STATE_CNT_EXT:
+				otaClientInfo.lzSrc |= (u32)pData[i++] << (8 * otaClientInfo.lzIdx);
+				if(++otaClientInfo.lzIdx == 2){
+					if(otaClientInfo.lzSrc > OTA_LZ_CNT_MAX - OTA_LZ_CNT_MASK - 1){
+						return FALSE;
+					}
+					otaClientInfo.lzCnt += otaClientInfo.lzSrc;
+					ota_lzCntDone();
+				}
+				break;
+			case OTA_LZ_STATE_SRC:
+				otaClientInfo.lzSrc |= (u32)pData[i++] << (8 * otaClientInfo.lzIdx);
+				if(++otaClientInfo.lzIdx == 3){
+					if(ota_lzCopy() != TRUE){
+						return FALSE;
+					}
+					otaClientInfo.lzState = OTA_LZ_STATE_TOKEN;
+				}
+				break;
+			case OTA_LZ_STATE_LITERAL:
+			{
+				u32 copyLen = (len - i < otaClientInfo.lzCnt) ? (len - i) : otaClientInfo.lzCnt;
+
+				if(otaClientInfo.otaOutPos + copyLen > otaClientInfo.otaOutLen){
+					return FALSE;
+				}
+				if(ota_imageWrite(otaClientInfo.otaOutPos, &pData[i], copyLen) != TRUE){
+					return FALSE;
+				}
+				otaClientInfo.otaOutPos += copyLen;
+				otaClientInfo.lzCnt -= copyLen;
+				i += copyLen;
+
+				if(!otaClientInfo.lzCnt){
+					otaClientInfo.lzState = OTA_LZ_STATE_TOKEN;
+				}
+				break;
+			}
+			default:
+				return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+/**********************************************************************
+ * @brief		save the download checkpoint, the image data goes to flash first
+ *
+ * return 		TRUE - success
+ */
+static bool ota_clientInfoSave(void)
+{
+	//the offset saved must not be ahead of the flash
+	if(ota_pageBufFlush() != TRUE){
+		return FALSE;
+	}
+
+	otaClientInfo.infoVer = OTA_CLIENT_INFO_VER;
+
+	return (nv_flashWriteNew(1, NV_MODULE_OTA, NV_ITEM_OTA_CODE, sizeof(ota_clientInfo_t), (u8 *)&otaClientInfo) == NV_SUCC);
+}
+
+/**********************************************************************
+ * @brief		check the image data already written to flash against the checkpoint
+ *
+ * return 		TRUE - the download can be resumed
+ */
+static bool ota_clientInfoVerify(void)
+{
+	//header is downloaded again, complete image is validated before the upgrade
+	if(otaClientInfo.clientOtaFlg != OTA_FLAG_IMAGE_ELEMENT){
+		return TRUE;
+	}
+
+	if((otaClientInfo.otaElementPos > otaClientInfo.otaElementLen) ||
+	   (otaClientInfo.otaElementLen > FLASH_OTA_IMAGE_MAX_SIZE)){
+		return FALSE;
+	}
+
+	u32 dataPos = ota_imageDataPos();
+	u32 dataEndPos = ota_imageDataEnd();
+
+	//nothing is written yet
+	if(!dataPos){
+		return (otaClientInfo.crcValue == 0xffffffff);
+	}
+	if((dataEndPos < 4) || (dataEndPos > FLASH_OTA_IMAGE_MAX_SIZE) || (otaClientInfo.otaOutPos > otaClientInfo.otaOutLen)){
+		return FALSE;
+	}
+
+	//the same bytes as the CRC of ota_imageWrite
+	u32 baseAddr = (mcuBootAddr) ? 0 : FLASH_ADDR_OF_OTA_IMAGE;
+	u32 crcEnd = (dataPos + 4 < dataEndPos) ? dataPos : (dataEndPos - 4);
+	u32 crcValue = 0xffffffff;
+	u8 buf[64];
+
+	for(u32 pos = 0; pos < crcEnd; pos += sizeof(buf)){
+		u32 len = (crcEnd - pos < sizeof(buf)) ? (crcEnd - pos) : sizeof(buf);
+
+		flash_read(baseAddr + pos, len, buf);
+		//start flag is written to flash after the CRC
+		if((pos <= FLASH_TLNK_FLAG_OFFSET) && (FLASH_TLNK_FLAG_OFFSET < pos + len)){
+			buf[FLASH_TLNK_FLAG_OFFSET - pos] = TL_IMAGE_START_FLAG;
+		}
+		crcValue = xcrc32(buf, len, crcValue);
+	}
+
+	return (crcValue == otaClientInfo.crcValue);
+}
+
+/**********************************************************************
+ * @brief		drop the download checkpoint, the next OTA starts from offset 0
+ *
+ * return 		none
+ */
+void ota_clientInfoReset(void)
+{
+	nv_resetModule(NV_MODULE_OTA);
+
+	memset((u8 *)&otaClientInfo, 0, sizeof(otaClientInfo));
+	otaClientInfo.clientOtaFlg = OTA_FLAG_INIT_DONE;
+	otaClientInfo.crcValue = 0xffffffff;
+
+	zcl_attr_imageTypeID = 0xffff;
+	zcl_attr_fileOffset = 0xffffffff;
+	zcl_attr_downloadFileVer = 0xffffffff;
+}
+
+/**********************************************************************
+ * @brief		the download may be resumed from the checkpoint
+ *
+ * return 		TRUE - the image data in flash shall be kept
+ */
+bool ota_clientInfoResumable(void)
+{
+	return ((zcl_attr_fileOffset != 0xffffffff) && (zcl_attr_fileOffset > 4096));
+}
+
 void ota_upgradeComplete(u8 status)
 {
+	if(status == ZCL_STA_INVALID_IMAGE){
+		ota_pageBufReset();
+	}else if(status == ZCL_STA_SUCCESS){
+		ota_pageBufFlush();
+	}else{
+		//keep the progress, the download is resumed from here
+		ota_clientInfoSave();
+	}
+
 	/* shall free this buffer */
 	if(pOtaUpdateInfo){
 		ev_buf_free((u8 *)pOtaUpdateInfo);
@@ -608,15 +1062,7 @@ void ota_upgradeComplete(u8 status)
 		 * 
         */
 		if(status == ZCL_STA_INVALID_IMAGE){
-			nv_resetModule(NV_MODULE_OTA);
-
-			memset((u8 *)&otaClientInfo, 0, sizeof(otaClientInfo));
-			otaClientInfo.clientOtaFlg = OTA_FLAG_INIT_DONE;
-			otaClientInfo.crcValue = 0xffffffff;
-
-			zcl_attr_imageTypeID = 0xffff;
-			zcl_attr_fileOffset = 0xffffffff;
-			zcl_attr_downloadFileVer = 0xffffffff;
+			ota_clientInfoReset();
 		}
 
 		if(otaCb){
@@ -656,6 +1102,12 @@ s32 ota_imageBlockRspWait(void *arg)
 		 * */
 		TL_SCHEDULE_TASK(ota_imageBlockRspTimeout, NULL);  //ota_upgradeComplete(ZCL_STA_ABORT);
 	}else{
+#if OTA_IMAGE_PAGE_SIZE
+		//nothing of the page has been received, continue with image block req
+		if(g_otaCtx.imageBlockRetry >= OTA_MAX_IMAGE_PAGE_RETRIES){
+			otaPageReqDisable = TRUE;
+		}
+#endif
 		//send another image block req
 		TL_SCHEDULE_TASK(ota_sendImageBlockReq, NULL);
 	}
@@ -663,9 +1115,29 @@ s32 ota_imageBlockRspWait(void *arg)
 	return -1;
 }
 
+/**********************************************************************
+ * @brief		the rest of the requested image page is still expected
+ */
+static bool ota_imagePageRemain(void)
+{
+#if OTA_IMAGE_PAGE_SIZE
+	return (!otaPageReqDisable && (zcl_attr_fileOffset < otaPageEndOffset));
+#else
+	return FALSE;
+#endif
+}
+
 void sendImageBlockReq(void *arg)
 {
+#if OTA_IMAGE_PAGE_SIZE
+	if(!otaPageReqDisable){
+		ota_imagePageReq(g_otaCtx.otaServerEpInfo.dstEp, g_otaCtx.otaServerEpInfo.dstAddr.shortAddr, g_otaCtx.otaServerEpInfo.profileId);
+	}else{
+		ota_imageBlockReq(g_otaCtx.otaServerEpInfo.dstEp, g_otaCtx.otaServerEpInfo.dstAddr.shortAddr, g_otaCtx.otaServerEpInfo.profileId);
+	}
+#else
 	ota_imageBlockReq(g_otaCtx.otaServerEpInfo.dstEp, g_otaCtx.otaServerEpInfo.dstAddr.shortAddr, g_otaCtx.otaServerEpInfo.profileId);
+#endif
 
 	//start a timer to wait image block rsp
 	otaTimer.cb = ota_imageBlockRspWait;
@@ -785,8 +1257,9 @@ void ota_saveUpdateInfo2NV(void *arg)
 
 	if((++cnt >= FLASH_WRITE_COUNT_GET(g_otaCtx.downloadImageSize)
 		|| (zcl_attr_imageUpgradeStatus == IMAGE_UPGRADE_STATUS_DOWNLOAD_COMPLETE))){
-		cnt = 0;
-		nv_flashWriteNew(1, NV_MODULE_OTA, NV_ITEM_OTA_CODE, sizeof(ota_clientInfo_t), (u8 *)&otaClientInfo);
+		if(ota_clientInfoSave() == TRUE){
+			cnt = 0;
+		}
 	}
 }
 
@@ -992,6 +1465,12 @@ u8 ota_imageDataProcess(u8 len, u8 *pData)
 			case OTA_FLAG_IMAGE_ELEM_TAG2:
 				otaClientInfo.otaElementTag |= ((u16)pData[i] << 8) & 0xff00;
 				otaClientInfo.otaElementPos = 0;
+				otaClientInfo.otaOutPos = 0;
+				otaClientInfo.otaOutLen = 0;
+				otaClientInfo.lzSrc = 0;
+				otaClientInfo.lzState = OTA_LZ_STATE_HDR;
+				otaClientInfo.lzIdx = 0;
+				otaClientInfo.lzBase = 0;
 				otaClientInfo.clientOtaFlg = OTA_FLAG_IMAGE_ELEM_LEN1;
 				break;
 			case OTA_FLAG_IMAGE_ELEM_LEN1:
@@ -1032,9 +1511,10 @@ u8 ota_imageDataProcess(u8 len, u8 *pData)
 				}
 
 				if((otaClientInfo.otaElementTag == OTA_UPGRADE_IMAGE_TAG_ID) ||
-				   (otaClientInfo.otaElementTag == OTA_UPGRADE_IMAGE_AES_TAG_ID)){
+				   (otaClientInfo.otaElementTag == OTA_UPGRADE_IMAGE_AES_TAG_ID) ||
+				   (otaClientInfo.otaElementTag == OTA_UPGRADE_IMAGE_LZ_TAG_ID)){
 					//if g_otaEncryptionNeeded is set, it will reject the un-encrypted ota image data.
-					if((otaClientInfo.otaElementTag == OTA_UPGRADE_IMAGE_TAG_ID) &&
+					if((otaClientInfo.otaElementTag != OTA_UPGRADE_IMAGE_AES_TAG_ID) &&
 						g_otaEncryptionNeeded){
 						return ZCL_STA_INVALID_IMAGE;
 					}
@@ -1046,51 +1526,48 @@ u8 ota_imageDataProcess(u8 len, u8 *pData)
 						copyLen = otaClientInfo.otaElementLen - otaClientInfo.otaElementPos;
 					}
 
-					if(otaClientInfo.otaElementTag == OTA_UPGRADE_IMAGE_AES_TAG_ID){
-						u8 tmpBuf[16];
-						for(u8 j = 0; j < copyLen; j += 16){
-							memset(tmpBuf, 0xff, 16);
-							memcpy(tmpBuf, &pData[i + j], 16);
-							drv_aes_decrypt((u8 *)otaAesKey, tmpBuf, &pData[i + j]);
+					if(otaClientInfo.otaElementTag == OTA_UPGRADE_IMAGE_LZ_TAG_ID){
+						//decoded image goes to flash
+						if(ota_lzDecode(&pData[i], copyLen) != TRUE){
+							return ZCL_STA_INVALID_IMAGE;
 						}
-					}
-
-					//Calculate CRC value
-					u32 dataEndPos = otaClientInfo.otaElementLen - otaClientInfo.otaElementInfo2;
-					u8 crcLen = 0;
-					if(dataEndPos - otaClientInfo.otaElementPos <= 4){
-						crcLen = 0;
-					}else if(dataEndPos - 4 - otaClientInfo.otaElementPos >= dataSize){
-						crcLen = dataSize;
 					}else{
-						crcLen = dataEndPos - 4 - otaClientInfo.otaElementPos;
-					}
-					otaClientInfo.crcValue = xcrc32(&pData[i], crcLen, otaClientInfo.crcValue);
+						if(otaClientInfo.otaElementTag == OTA_UPGRADE_IMAGE_AES_TAG_ID){
+							u8 tmpBuf[16];
+							for(u8 j = 0; j < copyLen; j += 16){
+								memset(tmpBuf, 0xff, 16);
+								memcpy(tmpBuf, &pData[i + j], 16);
+								drv_aes_decrypt((u8 *)otaAesKey, tmpBuf, &pData[i + j]);
+							}
+						}
 
-					//write image to flash
-					if((otaClientInfo.otaElementPos < FLASH_TLNK_FLAG_OFFSET + 1) &&
-					  ((otaClientInfo.otaElementPos + dataSize) >= FLASH_TLNK_FLAG_OFFSET + 1)){
-						if(pData[i + (FLASH_TLNK_FLAG_OFFSET - otaClientInfo.otaElementPos)] != TL_IMAGE_START_FLAG){
+						//write image to flash
+						if(ota_imageWrite(otaClientInfo.otaElementPos, &pData[i], copyLen) != TRUE){
 							return ZCL_STA_INVALID_IMAGE;
 						}
-						pData[i + (FLASH_TLNK_FLAG_OFFSET - otaClientInfo.otaElementPos)] = 0xff;
-					}
-					u32 baseAddr = (mcuBootAddr) ? 0 : FLASH_ADDR_OF_OTA_IMAGE;
-					if(flash_writeWithCheck(baseAddr + otaClientInfo.otaElementPos, copyLen, &pData[i]) != TRUE){
-						return ZCL_STA_INVALID_IMAGE;
 					}
-					
+
 					otaClientInfo.otaElementPos += copyLen;
 					zcl_attr_fileOffset += copyLen;
 
 					otaClientInfo.offset = zcl_attr_fileOffset;
 
 					if(otaClientInfo.otaElementPos == otaClientInfo.otaElementLen){
+						if((otaClientInfo.otaElementTag == OTA_UPGRADE_IMAGE_LZ_TAG_ID) &&
+						   ((otaClientInfo.lzState != OTA_LZ_STATE_TOKEN) || (otaClientInfo.otaOutPos != otaClientInfo.otaOutLen))){
+							return ZCL_STA_INVALID_IMAGE;
+						}
+
+						if(ota_pageBufFlush() != TRUE){
+							return ZCL_STA_INVALID_IMAGE;
+						}
+
+						u32 baseAddr = (mcuBootAddr) ? 0 : FLASH_ADDR_OF_OTA_IMAGE;
 						u16 crcFirmware = 0;
 						flash_read(baseAddr + 6, 2, (u8 *)&crcFirmware);
 						if(((crcFirmware & 0xff) == 0x5D) && ((crcFirmware >> 8) & 0xff) == 0x02){
 							u32 crcReceived;
-							flash_read(baseAddr + dataEndPos - 4, 4, (u8 *)&crcReceived);
+							flash_read(baseAddr + ota_imageDataEnd() - 4, 4, (u8 *)&crcReceived);
 
 							if(crcReceived != otaClientInfo.crcValue){
 								return ZCL_STA_INVALID_IMAGE;
@@ -1188,6 +1665,40 @@ void ota_imageBlockReq(u8 dstEp, u16 dstAddr, u16 profileId)
 	zcl_ota_imageBlockReqCmdSend(g_otaCtx.simpleDesc->endpoint, &dstEpInfo, FALSE, &req);
 }
 
+void ota_imagePageReq(u8 dstEp, u16 dstAddr, u16 profileId)
+{
+#if OTA_IMAGE_PAGE_SIZE
+	ota_imagePageReq_t req;
+	memset((u8 *)&req, 0, sizeof(req));
+	req.fc = 0;
+	req.manuCode = g_otaCtx.pOtaPreamble->manufacturerCode;
+	req.imageType = g_otaCtx.pOtaPreamble->imageType;
+	req.fileVer = zcl_attr_downloadFileVer;
+	req.fileOffset = zcl_attr_fileOffset;
+	req.maxDataSize = OTA_IMAGE_MAX_DATA_SIZE;
+
+	if(g_otaCtx.downloadImageSize - zcl_attr_fileOffset < OTA_IMAGE_PAGE_SIZE){
+		req.pageSize = g_otaCtx.downloadImageSize - zcl_attr_fileOffset;
+	}else{
+		req.pageSize = OTA_IMAGE_PAGE_SIZE;
+	}
+	req.rspSpacing = OTA_IMAGE_PAGE_RSP_SPACING;
+
+	otaPageEndOffset = zcl_attr_fileOffset + req.pageSize;
+
+	epInfo_t dstEpInfo;
+	memset((u8 *)&dstEpInfo, 0, sizeof(dstEpInfo));
+	dstEpInfo.dstAddrMode = APS_SHORT_DSTADDR_WITHEP;
+	dstEpInfo.dstAddr.shortAddr = dstAddr;
+	dstEpInfo.dstEp = dstEp;
+	dstEpInfo.profileId = profileId;
+	dstEpInfo.txOptions |= APS_TX_OPT_ACK_TX;
+	dstEpInfo.txOptions |= g_otaCtx.otaServerEpInfo.txOptions;
+
+	zcl_ota_imagePageReqCmdSend(g_otaCtx.simpleDesc->endpoint, &dstEpInfo, FALSE, &req);
+#endif
+}
+
 void ota_upgradeEndReqSend(ota_upgradeEndReq_t *req)
 {
 	epInfo_t dstEpInfo;
@@ -1416,6 +1927,10 @@ static status_t ota_queryNextImageRspHandler(zclIncomingAddrInfo_t *pAddrInfo, o
 
 		zcl_attr_imageUpgradeStatus = IMAGE_UPGRADE_STATUS_DOWNLOAD_IN_PROGRESS;
 
+#if OTA_IMAGE_PAGE_SIZE
+		otaPageReqDisable = FALSE;
+#endif
+
 		//stop server query start timer
 		ev_unon_timer(&otaTimer);
 
@@ -1429,7 +1944,10 @@ static status_t ota_queryNextImageRspHandler(zclIncomingAddrInfo_t *pAddrInfo, o
 			zcl_attr_fileOffset > 4096){
 			/* OTA from offset xxxx */
 
-			if(otaClientInfo.offset == g_otaCtx.downloadImageSize){
+			if(ota_clientInfoVerify() != TRUE){
+				/* the image data has been changed since the checkpoint, restart OTA from 0 */
+				ota_clientInfoReset();
+			}else if(otaClientInfo.offset == g_otaCtx.downloadImageSize){
 				/* the whole image already has been received, shall validate the image */
 				if(otaClientInfo.otaElementPos == otaClientInfo.otaElementLen){
 					/* validate the CRC */
@@ -1438,7 +1956,7 @@ static status_t ota_queryNextImageRspHandler(zclIncomingAddrInfo_t *pAddrInfo, o
 					flash_read(baseAddr + 6, 2, (u8 *)&crcFirmware);
 					if(((crcFirmware & 0xff) == 0x5D) && ((crcFirmware >> 8) & 0xff) == 0x02){
 						u32 crcReceived;
-						flash_read(baseAddr + otaClientInfo.otaElementLen - otaClientInfo.otaElementInfo2 - 4, 4, (u8 *)&crcReceived);
+						flash_read(baseAddr + ota_imageDataEnd() - 4, 4, (u8 *)&crcReceived);
 
 						/* if CRC is correct, exit and reboot directly, or restart OTA from 0 */
 						if(crcReceived == otaClientInfo.crcValue){
@@ -1482,6 +2000,7 @@ static status_t ota_queryNextImageRspHandler(zclIncomingAddrInfo_t *pAddrInfo, o
 		for(u16 i = 0; i < sectorNumUsed; i++){
 			flash_erase(baseAddr + i * FLASH_SECTOR_SIZE);
 		}
+		ota_pageBufReset();
 
 		pOtaUpdateInfo = (ota_updateInfo_t *)ev_buf_allocate(sizeof(ota_updateInfo_t));
 		if(!pOtaUpdateInfo){
@@ -1502,6 +2021,12 @@ static status_t ota_queryNextImageRspHandler(zclIncomingAddrInfo_t *pAddrInfo, o
 				otaCb->processMsgCbFunc(OTA_EVT_START, pQueryNextImageRsp->st);
 			}
 		}
+	}else if((pQueryNextImageRsp->st == ZCL_STA_NO_IMAGE_AVAILABLE) && ota_clientInfoResumable()){
+		/* the server has no image any more, the partial download is abandoned */
+		ota_clientInfoReset();
+		if(otaCb){
+			otaCb->processMsgCbFunc(OTA_EVT_COMPLETE, pQueryNextImageRsp->st);
+		}
 	}
 
 	return ZCL_STA_SUCCESS;
@@ -1549,6 +2074,11 @@ static status_t ota_imageBlockRspHandler(zclIncomingAddrInfo_t *pAddrInfo, ota_i
 
 					g_otaCtx.upgradeEndRetry = 0;
 					ota_upgradeWait(OTA_MAX_IMAGE_BLOCK_RSP_WAIT_TIME);
+				}else if(ota_imagePageRemain()){
+					//the server sends the rest of the page, wait for the next block
+					otaTimer.cb = ota_imageBlockRspWait;
+					otaTimer.data = NULL;
+					ev_on_timer(&otaTimer, OTA_MAX_IMAGE_BLOCK_RSP_WAIT_TIME * 1000);
 				}else{
 					ota_sendImageBlockReq(NULL);
 				}
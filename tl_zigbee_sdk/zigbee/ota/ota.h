@@ -38,6 +38,9 @@
 
 #define OTA_UPGRADE_IMAGE_TAG_ID					0x0000	//Upgrade Image
 #define OTA_UPGRADE_IMAGE_AES_TAG_ID				0xF000	//Upgrade Image with AES, Manufacturer Specific Use
+#define OTA_UPGRADE_IMAGE_LZ_TAG_ID					0xF001	//Upgrade Image compressed or delta to the running image, Manufacturer Specific Use
+
+#define OTA_CLIENT_INFO_VER							1		//layout of ota_clientInfo_t in NV, a checkpoint of another layout is dropped
 
 #define OTA_QUERY_START_JITTER						(5 * 1000)//ms
 #define OTA_PERIODIC_QUERY_INTERVAL					(5 * 60)//s
@@ -46,8 +49,17 @@
 
 #define OTA_IMAGE_BLOCK_FC							BLOCK_FC_BITMASK_MIN_PERIOD_PRESENT//BLOCK_FC_BITMASK_GENERIC
 
+/* image page req - one req, the server streams the blocks of the page */
+#ifndef OTA_IMAGE_PAGE_SIZE
+#define OTA_IMAGE_PAGE_SIZE							0	//bytes, 0 - image block req only
+#endif
+#ifndef OTA_IMAGE_PAGE_RSP_SPACING
+#define OTA_IMAGE_PAGE_RSP_SPACING					250	//ms between image block rsp of the page
+#endif
+
 
 #define OTA_MAX_IMAGE_BLOCK_RETRIES					10
+#define OTA_MAX_IMAGE_PAGE_RETRIES					3	//then image block req is used
 #define OTA_MAX_UPGRADE_END_REQ_RETRIES				2
 #define OTA_IEEE_ADDR_REQ_RETRIES					3
 
@@ -168,6 +180,16 @@ typedef struct _attribute_packed_{
 	u8		otaElementInfo1;//manufacturer specific use
 	u8		otaElementInfo2;//manufacturer specific use, fillNum
 	u8		clientOtaFlg;
+	//OTA_UPGRADE_IMAGE_LZ_TAG_ID decoder
+	u32		otaOutPos;		//image bytes written
+	u32		otaOutLen;		//image length
+	u32		lzSrc;			//copy source offset
+	u16		lzCnt;			//literal or copy bytes left
+	u8		lzToken;
+	u8		lzState;
+	u8		lzIdx;			//byte of the multi-byte field
+	u8		lzBase;			//copy from the running image allowed
+	u8		infoVer;		//OTA_CLIENT_INFO_VER
 }ota_clientInfo_t;
 
 typedef enum{
@@ -215,6 +237,8 @@ void ota_queryStart(u16 seconds);
 void ota_serverAddrPerprogrammed(addrExt_t ieeeAddr, u8 srvEndPoint);
 void ota_mcuReboot(void);
 void ota_upgradeAbort(void);
+void ota_clientInfoReset(void);
+bool ota_clientInfoResumable(void);
 u32 mcuBootAddrGet(void);
 bool ota_newImageValid(u32 new_image_addr);
 #endif	/* OTA_H */
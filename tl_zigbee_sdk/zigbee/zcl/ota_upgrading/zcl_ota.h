@@ -259,6 +259,7 @@ status_t zcl_ota_imageBlockReqSend(u8 srcEp, epInfo_t *pDstEpInfo, u8 disableDef
 #define zcl_ota_imageBlockReqCmdSend(a,b,c,d)	(zcl_ota_imageBlockReqSend((a), (b), (c), ZCL_SEQ_NUM, (d)))
 
 status_t zcl_ota_imagePageReqSend(u8 srcEp, epInfo_t *pDstEpInfo, u8 disableDefaultRsp, u8 seqNo, ota_imagePageReq_t *pReq);
+#define zcl_ota_imagePageReqCmdSend(a,b,c,d)	(zcl_ota_imagePageReqSend((a), (b), (c), ZCL_SEQ_NUM, (d)))
 
 status_t zcl_ota_imageBlockRspSend(u8 srcEp, epInfo_t *pDstEpInfo, u8 disableDefaultRsp, u8 seqNo, ota_imageBlockRsp_t *pRsp);
 #define zcl_ota_imageBlockRspCmdSend(a,b,c,d,e)	(zcl_ota_imageBlockRspSend((a), (b), (c), (d), (e)))
@@ -493,6 +493,8 @@ _CODE_ZCL_ status_t zcl_setAttrVal(u8 endpoint, u16 clusterId, u16 attrId, u8 *v
 	u16 len = zcl_getAttrSize(pAttrEntry->type, val);
 	memcpy(pAttrEntry->data, val, len);
 
+	zcl_reportingDirtySet(endpoint, clusterId, attrId);
+
 	return ZCL_STA_SUCCESS;
 }
 
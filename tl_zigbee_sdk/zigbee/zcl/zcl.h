@@ -795,6 +795,8 @@ status_t zcl_reportAttrs(u8 srcEp, epInfo_t *pDstEpInfo, u8 disableDefaultRsp, u
 //for internal
 void zcl_reportingTabInit(void);
 u8 zcl_reportingEntryActiveNumGet(void);
+void zcl_reportingDirtySet(u8 endpoint, u16 clusterId, u16 attrID);
+u32 zcl_reportingDirtyGet(void);
 reportCfgInfo_t *zcl_reportCfgInfoEntryFind(u8 endpoint, u16 clusterId, u16 attrID);
 reportCfgInfo_t *zcl_reportCfgInfoEntryFreeGet(void);
 void zcl_reportCfgInfoEntryClear(reportCfgInfo_t *pEntry);
@@ -38,6 +38,13 @@ zcl_reportingTab_t reportingTab;
  */
 ev_timer_event_t *reportAttrTimerEvt = NULL;
 
+//bit per reportingTab entry, set if the attribute value or the entry is changed
+static u32 reportingDirty = 0;
+
+#if (ZCL_REPORTING_TABLE_NUM > 32)
+#error "ZCL_REPORTING_TABLE_NUM must be no more than 32 for reportingDirty"
+#endif
+
 /**********************************************************************
  * FUNCTIONS
  */
@@ -78,6 +85,55 @@ _CODE_ZCL_ void zcl_reportingTabInit(void)
 			zcl_reportCfgInfoEntryClear(pEntry);
 		}
 	}
+
+	/* restored entries must be evaluated once */
+	reportingDirty = (u32)((1ULL << ZCL_REPORTING_TABLE_NUM) - 1);
+}
+
+/*********************************************************************
+ * @fn      zcl_reportingDirtySet
+ *
+ * @brief	Mark the reporting entries of the attribute as changed
+ *
+ * @param   endpoint
+ * 			clusterId
+ * 			attrID
+ *
+ * @return	NULL
+ */
+_CODE_ZCL_ void zcl_reportingDirtySet(u8 endpoint, u16 clusterId, u16 attrID)
+{
+	if(!reportingTab.reportNum){
+		return;
+	}
+
+	for(u8 i = 0; i < ZCL_REPORTING_TABLE_NUM; i++){
+		reportCfgInfo_t *pEntry = &reportingTab.reportCfgInfo[i];
+		if(pEntry->used && (pEntry->attrID == attrID) && (pEntry->clusterID == clusterId) && (pEntry->endPoint == endpoint)){
+			reportingDirty |= BIT(i);
+		}
+	}
+}
+
+/*********************************************************************
+ * @fn      zcl_reportingDirtyGet
+ *
+ * @brief	Get and clear the changed reporting entries
+ *
+ * @param   NULL
+ *
+ * @return	Bit mask of reportingTab entries
+ */
+_CODE_ZCL_ u32 zcl_reportingDirtyGet(void)
+{
+	u32 r = drv_disable_irq();
+
+	u32 dirty = reportingDirty;
+	reportingDirty = 0;
+
+	drv_restore_irq(r);
+
+	return dirty;
 }
 
 /*********************************************************************
@@ -167,6 +223,8 @@ _CODE_ZCL_ void zcl_reportCfgInfoEntryRst(reportCfgInfo_t *pEntry)
 		pEntry->maxIntCnt = pEntry->maxIntDft;
 		memset(pEntry->reportableChange, 0, REPORTABLE_CHANGE_MAX_ANALOG_SIZE);
 
+		reportingDirty |= BIT(pEntry - reportingTab.reportCfgInfo);
+
 		reportAttrTimerStop();
 		reportAttrTimerStart();
 	}
@@ -225,6 +283,8 @@ _CODE_ZCL_ void zcl_reportCfgInfoEntryUpdate(reportCfgInfo_t *pEntry, u8 endPoin
 			memcpy(pEntry->reportableChange, pCfgReportRec->reportableChange, zcl_getDataTypeLen(pEntry->dataType));
 		}
 	}
+
+	reportingDirty |= BIT(pEntry - reportingTab.reportCfgInfo);
 }
 
 /*********************************************************************
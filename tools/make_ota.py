@@ -7,66 +7,186 @@ import struct
 
 OTA_MAGIC = b'\x5d\x02'
 
+# OTA_UPGRADE_IMAGE_LZ_TAG_ID element, see tl_zigbee_sdk/zigbee/ota/ota.c
+OTA_IMAGE_TAG = 0x0000
+OTA_IMAGE_LZ_TAG = 0xF001
+LZ_CNT_MAX = 4096
+LZ_MIN_MATCH = 6
+LZ_CANDIDATES = 16
+LZ_TYPE_LITERAL = 0x00
+LZ_TYPE_COPY_NEW = 0x40
+LZ_TYPE_COPY_RUN = 0x80
 
-def main(args):
-    assert args.input_file != args.output
 
-    with open(args.input_file, 'rb') as bin_file:
-        bin_file.seek(0, 0)
+def read_firmware(file_name):
+    with open(file_name, 'rb') as bin_file:
         firmware = bytearray(bin_file.read(-1))
-        if firmware[6:8] != OTA_MAGIC:
-            # Ensure FW size is multiple of 16
-            padding = 16 - len(firmware) % 16
-            if padding < 16:
-                firmware += b'\xFF' * padding
-            # Fix FW length
-            firmware[0x18:0x1c] = (len(firmware) + 4).to_bytes(4, byteorder='little')
-            # Add magic constant
-            firmware[6:8] = OTA_MAGIC
-            # Add CRC
-            crc = binascii.crc32(firmware) ^ 0xffffffff
-            firmware += crc.to_bytes(4, byteorder='little')
-
-        ota_hdr_s = struct.Struct('<I5HIH32sI')
-        header_size = 56
-        firmware_len = len(firmware)
-        total_image_size = firmware_len + header_size + 6
-        manufacturer_code = int.from_bytes(firmware[18:20], byteorder='little')
-        image_type = int.from_bytes(firmware[20:22], byteorder='little')
-        file_version = args.set_version or int.from_bytes(firmware[2:6], byteorder='little')
-        ota_hdr = ota_hdr_s.pack(
-            0xbeef11e,
-            0x100,  # header version is 0x0100
-            header_size,
-            0,  # ota_ext_hdr_value if ota_ext_hdr else 0,
-            manufacturer_code,  # args.manufacturer,
-            image_type,  # args.image_type,
-            file_version,  # options.File_Version
-            args.ota_version,  # options.stack_version,
-            b'\x00' * 32,  # OTA_Header_String.encode(),
-            total_image_size,
-        )
-        # add chunk header: 0 - firmware type
-        ota_hdr += struct.pack('<HI', 0, firmware_len)
-
-        out_filename = args.output
-        if not out_filename:
-            head, tail = os.path.split(args.input_file)
-            if args.output_title:
-                name = args.output_title
+    if firmware[6:8] != OTA_MAGIC:
+        # Ensure FW size is multiple of 16
+        padding = 16 - len(firmware) % 16
+        if padding < 16:
+            firmware += b'\xFF' * padding
+        # Fix FW length
+        firmware[0x18:0x1c] = (len(firmware) + 4).to_bytes(4, byteorder='little')
+        # Add magic constant
+        firmware[6:8] = OTA_MAGIC
+        # Add CRC
+        crc = binascii.crc32(firmware) ^ 0xffffffff
+        firmware += crc.to_bytes(4, byteorder='little')
+    return firmware
+
+
+def lz_token(token_type, cnt):
+    if cnt < 64:
+        return bytes([token_type | (cnt - 1)])
+    return bytes([token_type | 0x3f]) + (cnt - 64).to_bytes(2, byteorder='little')
+
+
+def lz_match_len(a, ai, b, bi, limit):
+    n = 0
+    while n + 32 <= limit and a[ai + n:ai + n + 32] == b[bi + n:bi + n + 32]:
+        n += 32
+    while n < limit and a[ai + n] == b[bi + n]:
+        n += 1
+    return n
+
+
+def lz_compress(firmware, base):
+    """ Greedy LZ, copies come from the output so far or from the running image (base) """
+    out = bytearray()
+    literals = bytearray()
+    index_new = {}
+    index_base = {}
+
+    if base:
+        for i in range(len(base) - 3):
+            index_base.setdefault(bytes(base[i:i + 4]), []).append(i)
+
+    def flush_literals():
+        for i in range(0, len(literals), LZ_CNT_MAX):
+            chunk = literals[i:i + LZ_CNT_MAX]
+            out.extend(lz_token(LZ_TYPE_LITERAL, len(chunk)) + chunk)
+        literals.clear()
+
+    pos = 0
+    while pos < len(firmware):
+        best_len, best_src, best_type = 0, 0, 0
+        key = bytes(firmware[pos:pos + 4])
+        limit = min(LZ_CNT_MAX, len(firmware) - pos)
+
+        if base and len(key) == 4:
+            # the same place in the running image first
+            candidates = [pos] + index_base.get(key, [])[-LZ_CANDIDATES:]
+            for src in candidates:
+                n = lz_match_len(firmware, pos, base, src, min(limit, len(base) - src))
+                if n > best_len:
+                    best_len, best_src, best_type = n, src, LZ_TYPE_COPY_RUN
+
+        for src in reversed(index_new.get(key, [])[-LZ_CANDIDATES:]):
+            # the source must not overlap the output
+            n = lz_match_len(firmware, pos, firmware, src, min(limit, pos - src))
+            if n > best_len:
+                best_len, best_src, best_type = n, src, LZ_TYPE_COPY_NEW
+
+        if best_len < LZ_MIN_MATCH:
+            best_len = 1
+            literals.append(firmware[pos])
+        else:
+            flush_literals()
+            out.extend(lz_token(best_type, best_len) + best_src.to_bytes(3, byteorder='little'))
+
+        for i in range(pos, pos + best_len):
+            if i + 4 <= len(firmware):
+                index_new.setdefault(bytes(firmware[i:i + 4]), []).append(i)
+        pos += best_len
+
+    flush_literals()
+    base_crc = int.from_bytes(base[-4:], byteorder='little') if base else 0
+    return struct.pack('<II', len(firmware), base_crc) + out
+
+
+def lz_decompress(element, base):
+    out_len, base_crc = struct.unpack_from('<II', element)
+    assert not base_crc or base_crc == int.from_bytes(base[-4:], byteorder='little')
+    out = bytearray()
+    pos = 8
+    while pos < len(element):
+        token = element[pos]
+        cnt = (token & 0x3f) + 1
+        pos += 1
+        if cnt == 64:
+            cnt += int.from_bytes(element[pos:pos + 2], byteorder='little')
+            pos += 2
+        if token & 0xc0 == LZ_TYPE_LITERAL:
+            out += element[pos:pos + cnt]
+            pos += cnt
+        else:
+            src = int.from_bytes(element[pos:pos + 3], byteorder='little')
+            pos += 3
+            if token & 0xc0 == LZ_TYPE_COPY_RUN:
+                out += base[src:src + cnt]
             else:
-                name, _ = os.path.splitext(tail)
-            out_filename = os.path.join(head, '{:04x}-{:04x}-{:08x}-{}.zigbee'.format(
-                manufacturer_code,
-                image_type,
-                file_version,
-                name,
-            ))
-        with open(out_filename, 'wb') as output:
-            bin_file.seek(0, 0)
-            output.write(ota_hdr)
-            output.write(firmware)
-        print("%s was created with ZCL OTA Header." % out_filename)
+                assert src + cnt <= len(out)
+                out += out[src:src + cnt]
+    assert len(out) == out_len
+    return out
+
+
+def main(args):
+    assert args.input_file != args.output
+
+    firmware = read_firmware(args.input_file)
+
+    element_tag = OTA_IMAGE_TAG
+    element = firmware
+    if args.compress or args.base:
+        base = read_firmware(args.base) if args.base else None
+        compressed = lz_compress(firmware, base)
+        assert lz_decompress(compressed, base) == firmware
+        print("Image %d bytes, %s %d bytes." % (len(firmware), 'delta' if base else 'compressed', len(compressed)))
+        if len(compressed) < len(firmware):
+            element_tag = OTA_IMAGE_LZ_TAG
+            element = compressed
+
+    ota_hdr_s = struct.Struct('<I5HIH32sI')
+    header_size = 56
+    firmware_len = len(element)
+    total_image_size = firmware_len + header_size + 6
+    manufacturer_code = int.from_bytes(firmware[18:20], byteorder='little')
+    image_type = int.from_bytes(firmware[20:22], byteorder='little')
+    file_version = args.set_version or int.from_bytes(firmware[2:6], byteorder='little')
+    ota_hdr = ota_hdr_s.pack(
+        0xbeef11e,
+        0x100,  # header version is 0x0100
+        header_size,
+        0,  # ota_ext_hdr_value if ota_ext_hdr else 0,
+        manufacturer_code,  # args.manufacturer,
+        image_type,  # args.image_type,
+        file_version,  # options.File_Version
+        args.ota_version,  # options.stack_version,
+        b'\x00' * 32,  # OTA_Header_String.encode(),
+        total_image_size,
+    )
+    # add chunk header: 0 - firmware type, 0xf001 - compressed firmware
+    ota_hdr += struct.pack('<HI', element_tag, firmware_len)
+
+    out_filename = args.output
+    if not out_filename:
+        head, tail = os.path.split(args.input_file)
+        if args.output_title:
+            name = args.output_title
+        else:
+            name, _ = os.path.splitext(tail)
+        out_filename = os.path.join(head, '{:04x}-{:04x}-{:08x}-{}.zigbee'.format(
+            manufacturer_code,
+            image_type,
+            file_version,
+            name,
+        ))
+    with open(out_filename, 'wb') as output:
+        output.write(ota_hdr)
+        output.write(element)
+    print("%s was created with ZCL OTA Header." % out_filename)
 
 
 if __name__ == '__main__':
@@ -77,5 +197,8 @@ if __name__ == '__main__':
     # sync with g_zcl_basicAttrs.stackVersion
     parser.add_argument("-s", '--ota-version', type=int, help="OTA stack version", default=2)
     parser.add_argument("-v", '--set-version', type=lambda x: int(x, 0), help="Override version from BIN")
+    # devices must already run a firmware with the decoder
+    parser.add_argument("-c", '--compress', action='store_true', help="compressed image element")
+    parser.add_argument("-b", '--base', help="BIN running on the device, delta image element against it")
     _args = parser.parse_args()
     main(_args)
\ No newline at end of file
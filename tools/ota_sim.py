@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+
+# ZCL OTA server simulator. Serves a .zigbee file to a model of the OTA client
+# (tl_zigbee_sdk/zigbee/ota/ota.c) and counts frames, bytes, retries and airtime.
+
+import argparse
+import random
+import struct
+
+OTA_FILE_ID = 0x0beef11e
+
+STA_SUCCESS = 0x00
+
+# sync with ota.h
+OTA_IMAGE_MAX_DATA_SIZE = 48
+OTA_MAX_IMAGE_BLOCK_RSP_WAIT_TIME = 5000    # ms
+OTA_MAX_IMAGE_BLOCK_RETRIES = 10
+OTA_MAX_IMAGE_PAGE_RETRIES = 3
+
+# 802.15.4 at 250 kbps, bytes on air around the ZCL frame
+US_PER_BYTE = 32
+PHY_HDR = 6         # preamble, SFD, length
+MAC_DATA = 9 + 2    # header with short addresses, FCS
+MAC_ACK = PHY_HDR + 5
+MAC_DATA_REQ = PHY_HDR + 10 + 2
+NWK_HDR = 8 + 14 + 4    # header, security header, MIC
+APS_HDR = 8
+ZCL_HDR = 3
+
+ELEMENT_TAGS = {
+    0x0000: 'upgrade image',
+    0xf000: 'upgrade image AES',
+    0xf001: 'upgrade image compressed/delta',
+}
+
+
+class Stats:
+    def __init__(self):
+        self.frames_up = 0
+        self.frames_down = 0
+        self.bytes_up = 0
+        self.bytes_down = 0
+        self.polls = 0
+        self.lost = 0
+        self.retries = 0
+        self.blocks = 0
+        self.airtime_us = 0
+        self.time_ms = 0
+
+    def frame(self, zcl_payload, down):
+        """ one APS frame with MAC ack, downstream frames are polled by the sleepy client """
+        air = PHY_HDR + MAC_DATA + NWK_HDR + APS_HDR + ZCL_HDR + zcl_payload
+        self.airtime_us += (air + MAC_ACK) * US_PER_BYTE
+        if down:
+            self.frames_down += 1
+            self.bytes_down += air
+            self.polls += 1
+            self.airtime_us += (MAC_DATA_REQ + MAC_ACK) * US_PER_BYTE
+        else:
+            self.frames_up += 1
+            self.bytes_up += air
+
+
+def parse_ota_file(file_name):
+    with open(file_name, 'rb') as f:
+        data = f.read()
+    file_id, hdr_ver, hdr_len, hdr_fc, manu_code, image_type, file_ver, stack_ver, hdr_str, total_size = \
+        struct.unpack_from('<I5HIH32sI', data)
+    assert file_id == OTA_FILE_ID, 'not a ZCL OTA file'
+    assert total_size == len(data), 'total image size does not match the file'
+    elements = []
+    pos = hdr_len
+    while pos < len(data):
+        tag, length = struct.unpack_from('<HI', data, pos)
+        elements.append((tag, length))
+        pos += 6 + length
+    return {
+        'manu_code': manu_code,
+        'image_type': image_type,
+        'file_ver': file_ver,
+        'hdr_len': hdr_len,
+        'size': total_size,
+        'elements': elements,
+        'data': data,
+    }
+
+
+class OtaServer:
+    """ server side of the ZCL OTA cluster, returns ZCL payloads """
+
+    def __init__(self, image):
+        self.image = image
+
+    def query_next_image(self):
+        return struct.pack('<BHHII', STA_SUCCESS, self.image['manu_code'], self.image['image_type'],
+                           self.image['file_ver'], self.image['size'])
+
+    def block(self, offset, max_data_size):
+        data = self.image['data'][offset:offset + max_data_size]
+        return struct.pack('<BHHIIB', STA_SUCCESS, self.image['manu_code'], self.image['image_type'],
+                           self.image['file_ver'], offset, len(data)) + data
+
+    def page(self, offset, max_data_size, page_size):
+        rsp = []
+        end = min(offset + page_size, self.image['size'])
+        while offset < end:
+            rsp.append(self.block(offset, min(max_data_size, end - offset)))
+            offset += len(rsp[-1]) - 14
+        return rsp
+
+    def upgrade_end(self):
+        return struct.pack('<HHIII', self.image['manu_code'], self.image['image_type'],
+                           self.image['file_ver'], 0, 0)
+
+
+def simulate(image, args):
+    """ client model: the same requests, timeouts and retries as ota.c """
+    rnd = random.Random(args.seed)
+    server = OtaServer(image)
+    st = Stats()
+    size = image['size']
+    page_mode = args.page_size > 0
+    retry = 0
+    offset = 0
+
+    def lost():
+        if rnd.random() < args.loss:
+            st.lost += 1
+            return True
+        return False
+
+    # query next image
+    st.frame(9, False)
+    st.frame(len(server.query_next_image()), True)
+    st.time_ms += args.poll
+
+    while offset < size:
+        progress = False
+        if page_mode:
+            st.frame(18, False)
+            req_lost = lost()
+            page_end = min(offset + args.page_size, size)
+            if not req_lost:
+                for rsp in server.page(offset, OTA_IMAGE_MAX_DATA_SIZE, args.page_size):
+                    st.frame(len(rsp), True)
+                    st.time_ms += max(args.spacing, args.poll)
+                    # the rest of the page is still sent, the client drops it
+                    if lost():
+                        continue
+                    rsp_offset = struct.unpack_from('<I', rsp, 9)[0]
+                    if rsp_offset != offset:
+                        continue
+                    offset += rsp[13]
+                    st.blocks += 1
+                    progress = True
+            if offset < page_end or req_lost:
+                st.time_ms += OTA_MAX_IMAGE_BLOCK_RSP_WAIT_TIME
+        else:
+            st.frame(16, False)
+            if not lost():
+                rsp = server.block(offset, min(OTA_IMAGE_MAX_DATA_SIZE, size - offset))
+                st.frame(len(rsp), True)
+                st.time_ms += args.poll + args.min_block_period
+                if not lost():
+                    offset += rsp[13]
+                    st.blocks += 1
+                    progress = True
+            if not progress:
+                st.time_ms += OTA_MAX_IMAGE_BLOCK_RSP_WAIT_TIME
+
+        if progress:
+            retry = 0
+        else:
+            retry += 1
+            st.retries += 1
+            if retry >= OTA_MAX_IMAGE_BLOCK_RETRIES:
+                return st, False
+            if page_mode and retry >= OTA_MAX_IMAGE_PAGE_RETRIES:
+                page_mode = False
+
+    # upgrade end
+    st.frame(9, False)
+    st.frame(len(server.upgrade_end()), True)
+    st.time_ms += args.poll
+    return st, True
+
+
+def main(args):
+    image = parse_ota_file(args.input_file)
+    print('File: %s' % args.input_file)
+    print('  manufacturer 0x%04x, image type 0x%04x, file version 0x%08x, %d bytes' %
+          (image['manu_code'], image['image_type'], image['file_ver'], image['size']))
+    for tag, length in image['elements']:
+        print('  element 0x%04x (%s), %d bytes' % (tag, ELEMENT_TAGS.get(tag, 'unknown'), length))
+
+    if args.page_size:
+        print('Image Page Request, page %d bytes, spacing %d ms' % (args.page_size, args.spacing))
+    else:
+        print('Image Block Request, min block period %d ms' % args.min_block_period)
+    print('Poll %d ms, loss %.1f%%' % (args.poll, args.loss * 100))
+
+    st, ok = simulate(image, args)
+
+    print('Result: %s' % ('complete' if ok else 'aborted'))
+    print('  blocks received  %d' % st.blocks)
+    print('  frames up/down   %d / %d' % (st.frames_up, st.frames_down))
+    print('  bytes up/down    %d / %d' % (st.bytes_up, st.bytes_down))
+    print('  data requests    %d' % st.polls)
+    print('  frames lost      %d' % st.lost)
+    print('  retries          %d' % st.retries)
+    print('  airtime          %.1f s' % (st.airtime_us / 1000000))
+    print('  elapsed          %.1f min' % (st.time_ms / 60000))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument("input_file", help="path to .zigbee file")
+    parser.add_argument("-p", '--page-size', type=int, default=0, help="Image Page Request size, 0 - Image Block Request")
+    parser.add_argument("-s", '--spacing', type=int, default=250, help="page response spacing, ms")
+    parser.add_argument("-m", '--min-block-period', type=int, default=0, help="block request delay, ms")
+    parser.add_argument("-q", '--poll', type=int, default=250, help="client poll rate during OTA, ms")
+    parser.add_argument("-l", '--loss', type=float, default=0.0, help="frame loss probability")
+    parser.add_argument('--seed', type=int, default=1, help="random seed of the frame loss")
+    _args = parser.parse_args()
+    main(_args)
@@ -79,9 +79,12 @@ const fzLocal = {
             const value = parseInt(data);
             let volume = value; // * 0.001; //* factor;
 				    payload[postfixWithEndpointName('volume', msg, model, meta)] = precisionRound(volume, 2);
-        } else {
+        } else if (!msg.data.hasOwnProperty('instantaneousDemand')) {
 				    payload[postfixWithEndpointName('volume', msg, model, meta)] = 0;
 			  }
+        if (msg.data.hasOwnProperty('instantaneousDemand')) {
+            payload[postfixWithEndpointName('flow', msg, model, meta)] = msg.data['instantaneousDemand'];
+        }
 
         return payload;
     },
@@ -106,17 +109,21 @@ const definition = {
       const overides = {min: 300, max: 3600, change: 0};
       await reporting.batteryVoltage(firstEndpoint, overides);
       await reporting.batteryPercentageRemaining(firstEndpoint, overides);
-      await reporting.currentSummDelivered(firstEndpoint, {min: 0, max: 300, change: 0});
+      await reporting.currentSummDelivered(firstEndpoint, {min: 0, max: 3600, change: 0});
+      await reporting.instantaneousDemand(firstEndpoint, {min: 10, max: 3600, change: 10});
       const secondEndpoint = device.getEndpoint(2);
       await secondEndpoint.read('seMetering', ['currentSummDelivered']);
       await reporting.bind(secondEndpoint, coordinatorEndpoint, ['seMetering' ]);
-      await reporting.currentSummDelivered(secondEndpoint, {min: 0, max: 300, change: 0});
+      await reporting.currentSummDelivered(secondEndpoint, {min: 0, max: 3600, change: 0});
+      await reporting.instantaneousDemand(secondEndpoint, {min: 10, max: 3600, change: 10});
     },
     icon: 'data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAAJcAAACXCAYAAAAYn8l5AAAgAElEQVR4nOy9Waxl6XXf9/umPZ3pzkPVraquZnOQ2Go2mxQHDVYM2ZEFW5JjGYoSyAkCBIgDxMhLkMmBgDwkLwGCGEjsFwdJFEOCLSN24NiSFTtGSJMSB5E9sdkTu7rmuvMZ9/gNefh2XSoOi3J3U0EQ3/XS1ecW9j3n7LXXt9Z/WAWXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRmXcRn/ooZ40g/+4q/8GQBCCDjnWR8WPHVtl5/+k/8yo+EazgVcV0FwIDRSSIIAGzx4j5ECKQRdcAgkUnhCCCBE/G//6yUKoSQehyTEnwUQQRBkfIcSCSEQggcpCF4hJIRgiZcUKKkgBFzwCARSCqSUOOtBSrQWOOdxziGVQgJ4j5ASIcDjEUIjPfjgQEgQEPrfL0J8yXtPoH89QAjxOxJCIPrPFkJASgn95wlCooRCiPi5498D8HgfgIAUgiANLoAMPv5/cDjn0FoTBATvEUhAEoJDSo2Q8bpKCZQyGGNQUiKlQBAQTuou2P22a7a99ztN02wvFosbg9F4Z2//4De853edtd8nE/7wSPY//j1f1+//kpfx/3YIQAqB0gYpDUmSoU2CVgIpoets5pzbq5tqv2va7a5tdxbzxf6yLm/UTb1X1+3O+fls6+j0dM978k99+jPiky+88Ltl03LxvP8A4zK5/j8QQoCUEqENSioSCYnWCBmreJKmQx/cVts0G876g7ppDqpVtT/tzrc7Z3fni9nWdDbfrlbV9unp6cZ0WXJ0cs7x6ZTT6Tnz+ZJV2bIsa+qmRSrDbDZjZ+d/+bf/7M/9zH+glWw663/gn+syuf4IQwgAgZASow1KCbTWJMaAkCglUu/9Ztc2m865XevctdVqeXVWljtSsNt1zd5qtTxYldX2sixHZVlzPltwcjbl/GzO2XzBdFlydj7jfLbCI6nbFmcDUiVIrcjTlEynmHzA5kAwHg4oiozhMCe4Jvu1/+F//gUb+FtGfoBz8QlxmVzvM4QQCEAphVIqJo/WsdcRQikptzvbXbFdt+tC2PXW7TR1czArq2tN2+w2dbVVN/VWVbeT+XQhT2fnHJ9M6awFIfjWW7c4PV/QuY7zRUVVdQQkUmmMSRBSYZSiyHIGox1ubBiSRJOlKcMiZ5hnKAXWWrrOUrcNbdNQlg1ts6R2FXt7WyiZ/uy7R+d/64/iO7pMrj8QgdjXCCGQSqGNRmqFlhojNcrIVAqx7YPfbLtux3X2oGnqa+Vyuds0zY5zbrtt2626LLdXVbXZNI1azBfMVytmixWn53NOpgtOz8+pmpbpYsVs1eI9hCCQOmN9fUyRJ9jOMRxuUSSK7auaoUmQSrK/s02WJlRVjfeB0WiEtY6mbWmahtPzc6bn57z11pSzs3M629F2DUrGIWK1WnFtb4cPP32N09Nzrlzd/RkrBanR8Qt4H/HmvaPv+fq/OMkl+qSRMh5NWiOBNEtJjDEevy6l3vSd267qct9ae71aLfebttkJzu84Z680VbU/nc82yrpmOp3SNC2L1Yr7j06YL2vqsuLR2Tln8yXOBYLUtC5glEIbQ1YMGQ6GSLVGMhJs5h0HWcLB/i6j0ZAiM0g8hMB4OAIBy6pisaoILpArxRvv3OXB8RnXru4xGBT87b//j8B5BAEpBZ3rcJ3Du8B4PCJVEuUVg2FBYgxubYKUAR8CAsn6ZLKPEE9lRfGud++v7/r/dXI9ThoBGJ1glCFJNcYkIrgwEVrvC9yVuq73u7bd7rp2r1pVB21dHaxW5XbVlFt1U2/YLqjZbMH5+Tmrpma2WDKdLZjO5sxXNdPZnMpJbJBYHzBGI4TBZAMGeYoSGZO9p9k+gEGakBcZJjGsD3NGgwKjNVXVYJ1HSolSitlsTl1Zpqczbs0XTOdLjk5OWZYtZVnTdC2d80gl+czHP8LvfeMVZsuKjz495cruFqenZ/zQU9fYmAxJkxQlQClJmiRoo+m6jqZ1tJ2jaWqqpiIvRlRVjQC0lCid/NjaZO1d59wP9L68p+QSArRWCCF43zX0nzdC/IVSCow0SClQUiC1QggjTGJ2pPBbwLa13a6z7rrruoP5crZd1fVu27SbTVNvlWW5sSqrvKob5osFy7KkLFuOT85xXjBbLHlwfEzrBItVifUCnRhMljMaDTGJoUjXEQPB/s7TTMYjmqpmMCi4eX0PIyG0LZKANoYQIpZWlhVl3XE2W/Dyuw9YlhUnJ1NO5ks8guAjjrZYLqnrltAnXJZn1FXbV1iFlKCVom0bbt19yPpoxGAw4vj0HIljf3uT4aDAaEMQgWIwwEjNslwxX64ixqgkWWrQJmKKh48OSdOEvf0dktSweLj4/KJufl3/gO/qE5PrMdAZQiyhaWIYDQsSozHG4F3LB81zpRSpyS5A1CI1Msuy9eDDhvBsd77brpr6wLb2WtO0e01db3vnd1dVvbcsV3urxVKdnJ3Rth1V1TBdLDk5O2e+XDGdLanajkVZMZ0uCcogZJyg0jRDK8NobQNjCsz4ChuDgmtasLkxYmNjjRA8wyzDO8+4GCKAxWxJ09XMfEtTznnlG4fx+suS2XxF2XQsy4bWOqzzdJ0neEEIPsINQiFwKCEIPiABLTWjQiOkQCtNkiYMckvXdf3QIHC+o+0sV/e3sZ3llTdvs1qVPP9DT+O7hgePHnHz4AoSRW07TudT5vMF1lmkUqi+FVhfX2c0GDLLZzRth0AyGU/oqrdvvvztdzAf8H7+s/HE5Ho8mQZgWOQcn83+k3tfOPzjX33x7Zu/+K/8wm+/8Pzzf+nkaNWP298NIeLonSSGPE3BSKRQGMVYCrHpQ7gC4QDYWa7K3eV8sSekuCaVuHL44Gzj7r17m03dpQE4m844OZ+yXFZUdcvp2TnzxYokT5nNVtx98Ii0KLBOULUBqQxFMWBYFOikYFDk7G5kXL8ZJ7o8S1gf5STGkA8KbNtguxadaAgBAZydnXHr7bco6475omY6X9J2Hc5B1VhkkiCEwDkHQiCk6tmKLv6OwRq5eDwY9MC3kDjvsF1HsC6i/M7hfETiff+aEIK2aVFKI6UkeB+ZAKlJkxydaHa2xrz8+i3qumVVt9y8usvho0OsteRJSrksWZYlg+EQHzxt0yCEJITAdDplfW2N0XhCeXjIdDojzxO2t7c+P7x3lGRatu8HkDiu2/eWXGtrOwCkqeHk5PS/eOPte//p0fEpH37mJq+9/sa/d3Vv9zc+dOPql6umWlMy2dNKbdngd6qm3u6aZrdrqu2Hj04OzmbTq8Gz0zTNRlmVIyEVTdNyOp3x1tu3WMyXtN5ydLqgtfDw8IiucwQhsd6jdEoIIJVACoVWmr39MfnamKvJhEGRYZRmOBiTFymDPCHVGqUV1aqi7Tq0VljrmC/n3Do7YVnWNJ2jrGpWdUWQkrJsGY1GNG3LclWRpgaTJBijUWlKliRsFgXWOaQMKGXA0d/AFmttrIhaYa2nazuss5HqIdB1LUoqQgLOOVzXQdtE/khJAh4XfKR6QiAAUmuyLOuTTHA6XbK1uc7aaMD0fMrDo2NsWyOVwgXPqlphZIKzDoJnMhoxDwHnHS7AqqrorGM0HpNlGWfn52xvb7K+Nt4Y5eZHa+e/pH+AcNcTk6tyAiHAWiHvPTr9S3masL+7zTMfehrbOX7rt3/7H3/+M8/fni1WB2XdDU7P5hyfnLAsV9RNy3Q64/j0nOVyRVW3NK1lVTfUbYu1AWsdWZ4xHo9BSprOk6Y5+Wib9TTeVKM1o0HOsMh6EFKTZSlVXWFdy/Bgl+l8DkHgbMf9B+csVktWZcWyqimreNOVUgipIq8pQBB5QKMN2qRoqVnfmCBEIM1ytja3UVr0/CD9sSbBC3wXq4nQjseEXGIS0iSlGBQIIelai0s9VdNE7jP0RyES5zzeO1oh8d7jbBffDxqtFVorkAqhHSEElDForemc5cGjY85OZ5hE8RM/+iyr2YLFdMbe7hYuBKplSZY4pNKsqhqhFB4BUoF3aJPg6blYpfAhsCxr2s4htXm+69ovqR8gmPrEK/2FX/4FQKC0Gh7ef3CsvM8Sk7Czu0PZtjx8dMRwWHB4fMp8saJeVTgXYnnXCpShyDLSJKXtLFmRUeQ5BE+WJBRFztbGGsWgoGkbhAgIqejaBpAE61lVNVVT43ygrFoWZUndtLSdxQePCwJPvEkRCRd9IZBIIUjThCzPECIghUapCHxKqVBKEoLv/6xwrsPa2EU+JqGdcxhj0NrgnEOpSH575xlPxgTvkSr2S4g4qcbvIKBTw3yxIFhHcI6us3gumG66rmMxX8TjVAqqqkFrTZqn8UEA6romMSpiWV3L+ekp0+mUIle88JGnoYO6rXE4QFJVJcbEI7XrOqRSF6S+cw7vHUprnLU458nznDzPqKqKs+n8b8ok+WUj3ntT/9VX3/ierz+xcikVn3Sl1EQITOc6RqMhJ6dn3D86QakUk2ukyhjkgs21DZIkITEG6zrSLCPRCVIqdKKRgv6p9TRth/Oee/cf0VjLYrGibTu6EOhsR9dFNYDzgYAgCIFQCq1jNVMqHntGabRS/ROvLypSIPQVS/d9T0zcEMCHEJF0JbFdh1IaY1RfpT1aK9q2u0DeQ4CiKKiqCqUk3ncsV3PW1tepmpZUaRASISWdj59RSijLMiobjAKtEFpjrYUQFRDeB5y1+P76UiuapgMEiTF0XUfbNCAS8kFBUwls2yGCo64sJ2fnpCpWNKUkXWeRUtA08fhFgO8Tykv93Wkb8AhSk0aFiJQMBwXns/ln795/iFHqgwgk/vmSazmbxyTTOsOjCALnPUJr9ra3QSrGkzU2xkNm0ynrGxscHR/TBQ9ozk5n1G2LUhETWi1LyqohEGh7SsL12hUpY5mWSqG0wWhFkqUorZAy3nypJLKHJKSQsUrxuGGOlUNIieyrltbxCUYIXGf7oy1Obs62KJnhXKx4aZbjliu886TFgKZuEFqTJIa6bsizjKosOT05IxBompa6qqmqiiAFk8kGIYC1HQgPQSIReBGlQ847RC9Boh94HlcXgWA4GLLwsFyW5HnOYDBgVa4QUtLULVJpfPAsVkuyxPDjn/o4wXbcv/eANM3i8akk4/GY4+PTXh7UV9MkJTUJAiiKNCZfYfDeUTUNzjkmkzF5lj61uTG5ORgUt3x4b2Dq/dPz95ZcVw+uRXzFWjM9PQckWZqwajreufMAqTTp0RmrsiJLNNevX+dbb97izv2HyABKCrSRFHmB1joi1iImqFIKJTWif0qEEGhtECr2G1JFgBEEyujYM4nYA/7BROrrGiAvqpvSKk5HBIIPJMagtWIxX6JUr93yUVvWdR1CKdbMJmkWmC2WhKhroetaBkVOFSrmiwVSa5ARTlhbW6PtWpRSseooGcd+AY7Y14X+CPQuVlEpJZ4Qj1pp4jguYiWF79JOAGmR0zmLSTS2tZSrFUoJmrbl6aee4plnDrh/7xBrA1I6lJZ0bdSpjUYjFvM5EkmSpCgZMTKjDSFAnue0bQMEjNasypLEJOzt7vK1l//PT3Vw6z1l1veJJybXg4cPIYCUcihkFOspoWmbmmXZ4ENN151hTIJ1hm+++BKdDYwGA5q6osgysjyhSPML4VzjOmQQOBcQUkZ5SZpivSMxOdKo2LP1yRX6I0SIKH4LxKQSSkXhYIjNqtImViURCD0NEkJEqpVW+CCjiJEo2mu7FmUcJk3J8pwgA+kgpygLvIBiOMR3HYPhkCzPcQHyIicrMgKQZxlt19F1Nj44NlYAHyIn6Z3D2VitfHCIfjCQUuKci4yCjl9917Zx0CBQ5BlN21BWNdZ5vHMURc752SnBthBiv/fKt77DyeEx49GIVVmRJAlWONqmYW00xNoWHzydbfBeoWU8DNu2jVVxVQIwHE9YlSVV3WC951d+5VduPP2xjyN9956S6C//6q++t+QqhkWv5LRDf+pI+upR1REbGgyHeB8VjGmWM97a5uFbt3C2u5hEnHXINJBqxepCgSpjg61l33CqvukWKGNIlKRt44dTSvU0STxGnI80iNIKa2PdAhlrl4iju+gVmwDK6FjpQiAvcoSU5FmG6yzaaPI8R8nYswkJ23vbMVk6i/cuViWpCCL2R0oN8b26NPZtCucdBLAuIBEE4WNvBTjrLpSmHvA+IIWksxatDV3Xcn52zHA0YL5YcHD1GrPZKYuTe1RNi9EZ+/u7PLrzDuPCwN4OL77yKvNr++xubdA51w8m8T1525GkUdJT1Q3WOoTqj2cRIZDz83Pato2KVRFPmMVySec9//F/9O9/4iPPfvo9Jdb7Sq7hcIjSmqosxxHDifit954kTWmahq61nJ8f89yPPMu/8W/9Bf7h3/st/u7f+y1MmqD6ci9VIElUX70inSG1QOqENM0jJaF1X6Eet5LhAviTUl7Ih4WUWGtx3uN8wGiDUOJCjiwQsbl1DustJk3i1UKgKOLxnOV5PK58wOhYUWznQQSMkThn0VrRdZ5lWZKmCV3XXVxH9pPcY5jCW4f1jrZt6ZqO0B/7PoSLWVwKSZ6m1FXZV1bJsDCsjTNcqVk3lqACiYbNYUKoK/JMUFuPCJa9zRHzWcknPnIF35ywvbvL1tqQB3cf0JRNpKm0QStNmmqECATnyExKkuj+83RI6VG6P9bbltl0hkkSVvMlT928weZA/Utn73yFO3fuofQHp52feIXVaoVSirZpJrH/oUeUFQIZ33ySsruzTVXOOL79OrPpEcVwRJoYyv6LVEqR9LgVCIQSZMUQncSGHYg6eRGPjBACaZpircX7OF1KKfEh4L0jSVJMmlHX9UUvJpXs358jdC7q4enJbCnx1qL6nq2uqjhZPm6WZezXAh7nI/bV+JauaRFK0TlH07TxekpSVnWfMCKi4togpCBPEmQIeOfI0hQpRV/BAm1rsV2NEo7ORtqlXrUc7G2Su4q2bnj25hazrsSbhEVZU2QFP/n5Pb7x2gPSZIO6WbCxs8V//h/+An/jb7/I2uYWWMfm5jazxYLb9x5hVzVrTXwQtJYX7UiSJBGcxWOM6ftVT9e2SCmYjAe0Vclf/+v/07Vf+sVffObgxkffbsvyjy652s4hPTSdHfvenEAgjshtg3eOq/s7bG6t882XX8Y7z6qy5FmK1orl0uORJCYhTwyJSdBpQsTOEpSO2AvEKuDF/3NCCf67R4wPHusCSZLjnb+YBp1zuNYjZMS36CdPZRTCBzy+78W40InLvm8DsD7ebB88rvEI4vEhRZzuEiUxRUbXtBit2Jps0FQVBMGqrHDBRaTeOqS3GKOxXU3wnq6zcbAIAe88BB+PKWtRMuP4ZMpTe0MOj6Y898lnyHPHf/9rX+X6jT1aJ/jYR3d59PAhZ6uUazeu8OJrt/jQtecoCkOWpzzzwnN84Qtf5o3X3iYEz87mFrtbE3z/YEa0H3x8dOIDgqBelZgkIc1TpFAMBwPOz8/5z/7Lv8Lzn/mJT/7MCz/59urswQcybXzf5LJNfKpdZwdCKKSIWEnbtti2hRAYDBLwNZtrE77z7j2sE4yGA4SSpFmsPlVnoayoWouUcZLz/aT2GD1//EXI/th73NPQDxKhr17GSKzrsN4hlcCHCHRK4nAge1eN7t06ddMghMA7j8NCEki0oa0rtNFxQg3gXYfRBpMY8B4tooqgrmps5QjB09Q1nRBgG5qmoW0tnfe0ztKbelACjAbrOgiB1MjHWCEaAcJFl5R3JEnGu2+es/PDN/n4s7vcvnOMc6d8+nPPMxxkvPSNb/K1l+c89+N/hmrW8ZUvf4mvvfgSP/Gn/xwf//E9/re/+Zv8O7/6l3n06AFusaRqHQ+OzwDBMM/xPoLVne0ol4u+t9R0ocN2EW9L0xQfolpVJynrhea1N779+T/hut9EGz6oRuKJyZXqBKU03rncuZaAwfeVpKktz378BjcOJhwfn3F1b5PzynP33iFBwPbONiEElvMlJ9OSMCvjk0tAmwQhBUJyUa7btqXrugjCJglpmhKIVZIQLpDmtm3xLo711vW9ug8YYwjWMV+VGKUwgyEuRJrl8cSZZhlNXdFRYbRC+ASci8xA8NjW4YlQhfOOcuVw+AtgFSIY2zqLVhqTagapiQ+LcwiIdi8EeWYiFkesWALiBCwSbNvhCLiu4ZOf/hRr165zcnSbw/NjXvjc59jY3uDtb73NqMjJRvts7O9y++FXCAiuHxxw79brTFJNVbb8t//Vf8O/+ed/nmcPrvDrf/d3WCyXIAQb62OaLhYAJeNEbZKEEAJagRrktG1MsqwoOJueY31gd2+Xl1597acCkrRYiwPbH0VyVU2HUp6uc6m1Fu/cBRQgpSRNNXmaslxVDIcDbmxdQZqMt996h/39fSaTNTrrqasGH/yFmC9OfxohieN8VUXerr991jmSAHVTU1c1CEHSKxG8s2gV5SPBe5rO9nKSWCEKmaGFxPvYlKNUj0IrpIA0iXorrRU+RFpGKUEIAtVXFJ1oMl3En4eA0ZEsD973g0O4mLKC7ydHk14k3+OzV8p+irN94vkQf6Q0RmnK1Yq967vsP/URQFIcrXh4OCMLJ9jllIPrN3njlW8yffQtfvrHn+XN7xzziY89w/z2O9yZTrl27Tqvvv4mDw+nrOUKLSBRhrP5nIOd6+R5Tl3XGJMSaOi6lsTovh3xF01+8J4sTUl6eOVjz3zoWa1UUS3Oyw/qN3tico3WxxiTcH52ui6CJE3jKO+9pygSlvMVjx6e03YenRhm8zlaJ7RtQ13X0awpJWmekmUp5+dT6qpGJxlJmkakGmi7liRJMFrjXeQMy2qBFooiS3ojqEdJhZCR7hFCYDITjx2pAI8SEeR1IURTKx4p45epZOyj0jRBCREnQ616GqZXhUoZJ1kZPYBKJr18KIr14hcd0XUBZEmKdTbSOM7irYuwhCeyCf20G/rn5nF109HAQZ7nnB89wp1IXvrq1xlPtvnC//4Fnv7lzzIaFrx9Z8EgS7l16xGvbO1S5Cl5ZmhSw/HJMYMsIU8NrXXoZMz+7i7v3D3i8OiM+vp+/CwigsFpYhAiVlMfoLUtzlqyNEUIj1aao6Nj1tYm/Gs//yeS6v7Ln5rPZl/87vT+A06uk5OTOPq3jVQ6Er2y1yUFJJNBRp4ITk7nzOYVD4+n7B7coCgK5vM5SuuoCy8KCJBnOcvVCm8dWgbqriFPFKnO0UpHgDAE0iSBEEgSg1KGqi4RxAnVOYt3FoUkOI2WMuYWkfIxKuqrfBAgIjeoVYRPMGBE6GECh5Gxr1MyIUIfgIQ0TVFCxWlUQJEXtNbSVvUFrWS7llm5igOEj9fp2o4kixVMhl7kFyzBhe9WPKnwztLaFh8CEoX3BQ8fHjMcbrC7vck/+Icvc/Pm0wTXsba1wetvfYe//9tf5tMvPBvhmL7deLd9l9n5lPPpnCJRrKol1w72sG2HMpGIj3iaJEtTsiyjqkoEgmwwREhBXVcMBwVN05GabYISvPHtb7Oa7/+xzrov/pFVro21DYxJODk5dNOuxVlH3TZ0NpAmks98YgdHyktv3Keqa4ajEVUVx9f5fM5wOGB/b4+iKLh//x6DYoAWgbKuGI9y1NKDkCRZim0bkjQhMVEgp7Whbh1aBIZ5irORWhHK4Ly44A+D8LF/o5+IQoMOBiM1AUeiBUpqvIxofWJ0TAgSlJZRBOg7BnkGPtBYS1vW2K6jriqsczjbUuQFk/Eatmu4ffsdhJTM51OuX78GwHAwYnN9DecsTddGqst6fIh2/UBAikDbNXgHRiuUiWDw17/5Bk3T0VYrbhzs88UvfZm6iVV2MT9nY5xzfj7l9OSE7fUJmVH85Gc/iZCC/f1tKKeoMORTz3+cb7z4Bq+9/Q5tY9lcX6NpjpFCRdJdK7I0QSIuToqFVBgdq7JSkvX1Ib/xG7/Om2/d/dybd4/J1QfKrScn12QyIcsLFvOps10XexcbKRhjBD/6yZu8+p1jntkbsr71FK/dn1M1HU0dyem6rjg7OabOC+pyRbWYUVcNG5vrGBEYD/K+CjQEaRiNBhilWJZlPMKMgGCjUlRppBaAQAjfI/fEKuVASYVKIhrfti3WNozHQ5SStE2LEETap8fGANzS4nvjQ0fEw0JnmZ6dsbu7S1dVWNsyGhS0TctwmLJctDRtzXg0om0qiiLHec9sMWd9fYPFfBmPWaUJwuGcJYRIAbm+OhZ50is4AvPlilu3b3P1yhW0kti24kM3Drhx4zq7+7t01jNZW6ezjmXZ0rUVg+GQNB+iuiUmzXjxjXucLjoGhWZjkHC1LJmfnHHl2j7BexarOVlesFpVaK1QSmCdJ00jZKSkJMlzXnv9LbL0BuPRhCx79GMnq1Iq8B8kv56siqiiQrRqahtCRLDTNCPPM9rKkg9GrG1UrCWGvWLA6+6IItWR57IWvEcpmIwG1OUCZyHRisQoBnlG27Y0bQU+MMwLZIDVqrzoTQgeYxLyJMWGiIcF5xEq3pjHtI7sCWCJQEmJMJoiL/De0TV1VAgEgZaSe/cfYIxhWBSkScJkNObs7JSH52fs718hNQZUQCWSJDUcHR8ynoxpmoazszPW19fZ2txia3MD7xyL2YLReIR3lvkitgIKqOrorPHe47yLClQfkyvuN/EYo1ks5jw6OsFtbuKFZlVVbG9fQ413+c6jJWXVsHjjEXXTcXZ6ynJV0nYt0/MZN/Y3+diNHX7/Gy/RBVjbWueFp3b5qbUJc+cReYbUiiAkdd1SNx1BgnCeuqwxxpAXGZPxiPW1NYbDIbfv3ONDN6/zsY99eOPO/aPPn8/KL2XJH55e95fNe0suW9dI7/G23YiItsB5S9tEUZtSCTu727x065AXbz1ivLXJ3tU97j56g7pu0HfMNfIAACAASURBVIOMVEs21wb4bkLXWhrb4YJnMV9gu5bxeMx4MqFro2I0z3NWq1VPVciLKbFZxd8JIHo5iPQK31cDpQVNW9PZjs31dfCO2XQa+TOlSJOEtqrJTIKQUbrtnWNZzelcTWcrEI7OeoxSHB0+QkrJxvoarm2ZDIdYZ1nMZ4wGA5xzXL16tZc2p4ixYLVc4AlopTDGsFyu+kFBkKcJCmjahq6uMGnCyekps/mSre1t0ClndaBuYfnonC9+9ZUeKFZkWUqW5XTOsbmxjveerc0NXL2ibjo2NiZ4NGVbc1zW3Njf482y4t7xMfiAVBIfIv53enjCeDhic2eLuiypyprjoxOuX79Glhe0NqpE1tcmDPL08/dPFl/S6v3vkHhycrUtMgJsQ60lSgk6GxHnqmm5f/cENRhQKcPR4TGfuX5AXUe15GRtws7uFrs7O2xsrGGd5dHDQ5bzOaPxmNFwgHMZWmvqssT2ik+l1AX1E0JgPo+aMq3UBVL/mGMMeJSUOOuwPV+npYzAZ9dhhEIJQdM02KbFOUeeZYj+QVxbn1Culuxs7USaycX1TJPxiKhRiM19CIHVagmIKN6DC1eNd5FTlD3Y62yHaxu2Nw5YzGfMFyv2dnbJE03XVJSLKUJKTs6mHM0qvExQxYDlqqJpligpaZuSza2NCJmoKO0OBBJAa40PoIJjOj+LU5+HRVWxtT7EpwltmjM8n/HG+ZzUhQscbrlYkWU5n/38C3zoxgGL+ZxVWfPa629hnaNuSsajIYgIEU0m48+Ju8eE8P4nxicmlzYGlRi896PgA1pKvJS9s1dy+3DO9laCASbDAmMSbt++R2okW2sjNscjTo5POD87pWstZVkymUxwztF1XVSk9lXQ9yqGruvwRKbfWndBDoseM7LW9v0KPQ/Zy1isQwowStM10YkS1agwHo0jjqMNaZbS9fIYoxRr43FUoHZtr46N762uK2xnEVKiewYhKg8iVAE91SQk1nb9kEDUxtcVTV1Trkrq1ZKHDzq8UKgs4fB4ymC0zaqynCwcUrYMC4mWhmyU4Xy44FcjwR0J/5j8Ed0Hj1CGxgbyLOXZj17jnXcf8CMf2aGUgm8fLhnNVyRbY5Iip14skVIyGOS88MmPs7e3wT/+4ld5dDZnf2udmzeuMV+V3Lt7Dz3IydIMbx3r65NP50UShQV/GCRRf28e8onJFRt4i/dhTStFmiY0zuNsXLg2rRS6ElhnGY9HZMWQNJlRJJqd9TVSqXnt7bdZWx/zM3/qT/Hqy69y//4DylVJmqWsr62R9JXhsXCPPi2atiFJUoSQ/zfrWlz00X/hwbNaLaNcBomUPmJgBDprUVJTl0uMlkzGQ7q2o5yuWJUlXdvge5hACjAmUiNaR+VHlqZ0UjGfzaKQ0Rici7pzrSRd3VHXZVQf+LiETilBnuU413F6dB8tIrd6vOqovKc+LvFecv809n3j4YA8z/tVOPFDir4i6n6RXiD2bSJmLsboKB7oNfEiGfNn/+QnePkrX2A8HnL3pEJf3acrK2RZwyAHH2n8q1f3uXZ1lzfevs3/+k9+FyEMIXT87E9+hmc/cg3nr7CYzSMOiGc4yG/kJrlSNd2DRL+/tv6JydV1Hd55rHODPM/RSrFqu4tdCw9nNcMrGT/8Ix8lV5qT6ZKqrMjTlPPpFO8df+yzn+Dnfv5P89yP/hh/9a/+NR7cf8Rzzz1LmqbcevcWzby+MEWkWUaWZUgpSBIVOb8Qydbg46icKI11jrZr8dayu72BNoamaVkulrRdjZCSui5Z31hnZ++Au3dv8+DhXZq67RWqAtvZXjkBwbuo90oTlBQkWjMoMgaDnHa1YLFYUhQxEfIsJUkUo4010iwhCEjzAqkMTRdoOo/UmsPjQw7PT1i2CQgVl4HUniwzbG6sIUTsJ1WSIFQEZePDFV3WwkcV7WPzYwCU6ZW6IZLxW+sTvvy1VzjYHTMZTXj06ARsSruW0AWQZcXmUwdoo6nqhqZtODubs70+4YUf+SFee/s+dRV74DxLmUwm1Kua1WrF+sYao9EATfhsWTV/B/MDTq7xZIxADMXRwwPnQpQk9w2LCJ7B1hZ7H32Oj+1v8+JXv8brb91id2+Hne0ouFNasrE+4u07D/g/fu+vMV+s+OhzzzEajWjbFpEMgIbr13awXYNtO+qqZrFcsD4ZU5YrghS9XCdB9cdXZ1sCMJmMGI+GzBZz6rpEKcFytSBJUoJ3TE9P8F3HcrbkfDqNgKsIDIqC8ThDS0maKtbHI9ZHY6QU3Ht0xHA8xCQpOzvbCCGprKOqLEoaRJJS1hUhSViGwHJZU81LOutZlh3z+ZKyXNHZluTxaiUjybMiOstlBHml6pPLRLmO79Uh+kLsGFdXBiBYojnFaKQxUaJPR+ccwTV8643bfPipDb757Xv8+V/4Wb7wlZd4elUzTAfMqviwDwcFb797j6w44ide+CF+4kduMtCe7fUf5oXnPsb9R0ccHp0SXMCHeJoMioLxZPhTR7Py72gtvz+F3X1v7/0Tk+ve/QdIKdedc2PTH0daStq2ZVFXbK6t8/HnXuDBl36Lr7/yBvnaNnvXbtA0HbfvPqJuW+bLJfP5orc1gW0b6njUsrWxTpJm+LQkSVVcUTQYMUhTuuDJR5q2qmlWFQ1VFAUSEFKQpinT6ZTvvPUmw+Gg5xoD89mc1BhMaqjqlunxMUWR8tOff55BkVG3NUUxwKgkgp0+EITCBcGDoxP01lXyzS3u3HvAu985IdEJrXXMFiXWumgssS1da+msI1GSRJsLv6F3nkGRMR5ux50PtqOt2++KHQUIEcFTqVUktwVYPEmaAJHf9MITQrS+Yegtc1HFYJSmquPf395c56VvvcHXv1nxmU9+nLap+MLXv8XPPv9D3Fmt+PayZjCMsEtWDPn6q29hheS5jz7NL334GVZVzRu3HvDqW3d45so2RsJiWTIej9BKMxoVL0jxWEf73hv77wuihhCycrmIojygs46mi8K577z5NkeH75KPDV0QvPrWLV585XW8h7qqozGit4BJ2S/DyHNyKePyMqVwAe4/OIoNo4hDRJalDAcDhnmKNQoXGrSIKs00MdR1xfTsmL2dLX70+WdxLuq8rHMcXL2CSXOkSWhsx3A85vjkjMPakSOYl4LudMGqaqmsxQdB0/mIxDtP256AfyfSNCGCtUVWkGUpaZZhQkDKAUoLlNAXzmYhRNTMI0iLHKV1dIsrzWBo4uwpxAXf+NiZY22v2lA66s5cQGkD1gIS51qMSgjSYftBKA5AIYo2+x5zUEzYLAyFafnEJ25Snp6zESzniyXXxwN8Z0mzhLKu+crL71CbLSRT7r57i4cPDhE4ntpeI89TmgBtZzHGsL25/knFu5l3opbvg2d8YnLdvXsXrXXyeOOx1KpXF0gEnju33+X1d+6Qr5Z87OYVBms7/KN/8nvkacZoa3AxAdKL7pC9pUpptElBSoySFwYMpR5PXJ7VcsVsvsCHuD/LKJCtxziBt4Zssk+xtc9SGU6mMxrr8CFKnd2sxLolddeg5JSm6WgaS15UMcmlwNu4FVkoov9R69jIDgasra8RQqBtWpyz/b7SqKPXxiBV3KScJElvNolTJSEedbaX+cQ1WyFq7glRdRvonVDRl6mk7Ok7hcbS+Q6lNR5642qg6+p+c45nOp2SZhmL6RTXtWhlkFIzGRq+/e23+XO/9JP86xND9Vf+Ac/c3GMjMwzXhijnGSxr6tazuzWks5aHjw45PjoD7ynr6FDfnAxZVSXlqiTRmu2tjeGwSD6zqu0XUiOflCrvPbl2dnYQCH18fIgIASMVZVnGDcKF5t033uIT4i4vPzrkd7/6KntXr8alaklCmmWUdQkhYkWPvYWhd/EIJTAmuVjn/Qd18iGA1IoE+rXX0ZjaOsvSdlinmJWee9+6RddGKXKaZqRZGlUPKhogZFB4FxgNByixQknf660UUoW4flyKfvV4lJ3UTYNUkuFwyKpcobSgyPIoTenlwsEHXC+/ji60qD2TPa2kgkQgSUyKNprFatkPJOqCmH+sXwu9F8D5iJrXdcVq1QswAogQjSxplpNow+bGJpvb29y7fZuj+3dZLlYcHFxhfy3hm7//KtNqxb4RFGPDupYMFnPOy5KJVNw82ORDh9u8e7pAmDsE67DWsqoaNicDDvZ2CMFSVyXbW+sIKRmNhozXhp8+e3T+BSO+b9f13pLr6OiYNE3SKJ6LtiRCxKYQksQYvvrl3+fwdIaQUNUtUkgGwwGt63jq6adJlOHo6BDv4liOkCB7f14IPdQg+uVtKlI7Miov+g4L22960UaTZmkc//vd70rIKGeWIionRKxEwXmWiyVVXYJIyYucpo3SHu89aZZdWNcSY6C3oSEDWZ6R5SlSRSWDSVLSIsMYg2stAY/Wvb7Mu5jUOmE2nxGA8XiCdb0Mx3sQgq7rqKoqgsPeX6hwYwPt8XiMUQwGmxFGURotFME7hIAkTbBNR8Ajg2djMmR2mlBXLUZLTGKYbGzy+uvvcuOHtzAbBTvDAaPzFcuyQgLbO1v88c8/xytv3efO0Yxl2TDINTubO3zs2haZhs5Gn0HTtozHE9q2Zntj46fuPDz/r98PUP/E5MqLAjzau7p3B1uk0dRNjdCCIs/5nX/6OjcO1njmQwc8OqnprMWJqDYdFMMIOdy+jfeBLMsJ3uFsPCicdmQyuzCMaq0xykSfYRc/yWMPIxdVLVx4GIELg4azjhC6PnkAqRlvrDMMY4o08pjL5RLT2+Qfu50DAd1b/qu2xbtAlmYMhwMCA6zr6GzHeDSOzXQSEzFYx2g4oqyreJ0AWV6glKSqW6qyB1LLuHzNeseyLJkMR5xOT7HWXgCTvl/6prXCyhbbdlTNIlbHzhKcBRGNH857ltNT1oYpqRbkg5SuqwihYHN7wsvfvMMoLXjh2h4GjT5dkKY50rZ0nefKzg5XdjY4X9Qsy5K2WpGnhhACR0enDIcjkiRhNp2xu7OL7SxFbn6sMLpf5fSko/F7+xyfmFy7+3uUZbXW1BVpkpAkOu5ZMPoCp9nZGZMPR6xvXqEJx7Td6zRNy3Aw5M0330JKHVUB3l+YQZ1z/WTEBRrtvSMxCd476sZFVDyE6HD+g9ayXtwnel2V9w6hNEFK6I8YQX/8yYTBYBQ1aG0TNVUhLkrxwVPkOaPRKDblvQv7sczaWksxGCCtQBuNd4GqrLh9+w5VWZEYw3I+Z7lcMhgMQQisd4gAXWNpWxtVuyIeuULF6rJYLpFAniYXy/XQvu+9Ar6uSLViNC7gQqItEcLjfFQyjPKURCkW8xm1DbS+oapaqmXJc8//OG8+WPLSi3f4ymjEFx8e8zMvfAJhJfPFjMEgZ20yYnMQmKQBszthviypm461tTHOBdbW1jg5Obl4aNYmo600UR9Z1e2byXvs6Z/sWxwMcdYNvfMETy+Ii55BBWxsrLGsG779tdf58EclXiYkRmObjvGVCSZNOT8977cQfncHqNKa9Y115vN51HRrTds2seHVot+t4PsFufIiIR4nmO99gSHEY1MQm2TdG2gjqa4uODmpFFtbO8zVGcaY+D60wltHuSwZjAe0dYPwgsQknJwd07UtWhs8vk++uATk/r2HSIg2/7rqlZ4OozU6iXr6LEsYFNFKp5WKaw0kpEnSJ4qgtV2UfodoqUNEe6+3jiAia+CtwwePltHRGqtISpokeG8xOjqYylXFrGup65Zvvfxt/t2/+Mv8j4eH/HdffZHNzTWEcxRZxvHpKYRAXdfkadR4DYcDIC5kGQ2HlFVDnudMp9O4Taco2FzfQEv1uap1bz4WDXzg5Do+PqUuy/wxtkSIJVwRp7/VcsVwNODkvObBP/06k7U1NtfXEUqzt79L3TSsVnEPQdM0zOcLstSws7/H+vo6dV3xnXfuoJTmyt5Wv50mLhhRAh4v0X1cUUySIEVc6qFVBCKFMr2Ro0YZTaJM7LuUImCpqxrvPHle4EPg9OwMo/SFJ3I6ndF8pyIvMgb5gPPZKdbbfsGbjhtfRNx5kRjDM08foLXBKMmgKKJOv9fkRzl2YFgkcVeGEljbIhGIEPpNhNE1HoIiBHXhKF+tVnG4SSMDIYUAE4HL4H0USiaS0SDrpeaR3z09OWd9PGSgBYeHR7iH9/nN3/wdfulf/Tl2tgbcv3PMu3cf8IkffgaQLBYLhBDYQYaSkrpu+pVL0LYNVV0yGa8jhODk5IQb16+T5SmjteHn7k6Xv+Z5/G8W/bPxvZv9JyZXf3yMtFJRleBsJJ3bBgYDrl3d4+j4OMqO++ViQQaMSrh9+zb/F2lvGmRpepbpXd++nX3LfanKrMpau6v3biS11EgdAgRCigEbsw5jgvCAYRgxgwMisMcmbE+MZxgTYYeNfwCOAcwImZYYENq7RbfUpd6ruqprr8o9z8k8+/Lti3+8pwsi7NbQpv5VRFVEZp4n3/d5n+e+rzuXE3KaLE0wQoPhZISmyxSLRaGhz2RsPUVRIuI4RdF0UNTpygOk6bM9TiLSNCGJI6JUXA9uHJHECbaTExiiNGEcD5Cmxto4Cu9/DwBxIhpv09DR7RxkKY5lUsg5ZGl837ggp4no56Z8Um2KZhIadCGnURQJKc3QFLGDSxPxGFFVTVxfcYoqy2RpjKYJmEqaihmYND2VVEW/b69XVFAckzAIhZFVE9jbNEvxPJ8oiTEtnYJtYxqGEB7GGQVDo5Y3WVuZxTYUWkdHxGHCiy++xFNPP8La6gpvvfYOulxD10XgVJrGhGGIK4sBrabImKaBZVkEgz6KLGPZhuhdp9REBZn5+cZD17daJFMn1d/1z3sWl2lp+F7qCBNCgqbqhFGEbZlIMkxclzCMMEyD/tAlZUQul8P3xgL6IcnYlkMcJ+TzCSoxk0CAY51MYjia8LEPrfPhjz/Bv/rXf8mgP8LOWQJ1NDW7pkkqTBtJMu3b4umcCfI5m36rdX/3JjBCUxqOLFDZiiyh6RqKIoh+5VIBTVWIIhlVkdE0lTSdmifiGF2XcWyHYi5Pmk1PkOkDQpYhnTLlUylCmsaYpUlKkvhEMeiGIXawkxGyLKEpKmkckWSirWCqPYvjSEBS5Gyq4kiRJeG/lGXxAYZRShi4lAsFisUCcRiQxkI2pOd0FmbHAvutij70xNoqr712CVWRmZld5dEfeIaL336Z/shFlhV0TSMIM3xfiAJM08CdjO8Xi6ZpmKaFqoJmqEzcUChjyCgViheiLMtFMeP342V8z+IaDocEQZhTVdEnSdOjX1E0Zsp5FhpFbty8SyWnc2ZjmTevbuF5PralU81bSKqK57koqk6aZqyWLba6MJ64AtimK4x7PheffwPbEkqIJPwbZlWapURRCJIwvGb3hXiCfTBTLzMYjMWgVVcxpsJC09DvO37UqS2MLGPijomiCY5dQNKNqUwnQTc0dN0hS2KxMJckFGI0RRXT/zicegDFQ0CYNGQ83xNSHk1FkcBzXTQpwws80fTrBmgCUJemCZ1Wm0qljK7r9HptFEnGdmziOBEnpARSFhNHgorjex6aKmPoGnEQ4gchZAGkoscr5/PMVIskccrufpOPP/txNEnhm996lWKpyMnzjyBpFl4wIc4gSWN8358OcWMsqwRpguu6BFFApVzG0HWSKKZWKXHU7rO73yKWFHrj0PyVz3zmicXl1a9nyf9bdfrPf/Wfv7/iajRmOWweGv3xhDgRsA1kCTcIKNg6q/N5PvX938N3Lr6FEnuUCg4HR31KpTwztsyd9iGSlcPRTXqDEY+cL6HlHN7ZE4vmYbfDBz/1QZIs5sWXrxEkMZZtMXX/oSkKlplDUSQ0Vb3Pm9DkKZ4ySZhvlFFlRcx/ZGnKc5hS9dIYRQYpFXmF5VxO4IpScdSLQlWmZEIZSdOI44gkjvF9j2wqrU6TZOr6joWlzNIxFIckjZHjjCwTljfb0Ih8n+279yiWS8zUaoxHI+I0Y2dnh8ZMg/ZhmziOOL66wn6zSRKoglroumIMo8mYusl4PEGXZCRVZTQcYug6nu9j6Dq+L+aOWZJxbG6O/cMmk9GIVrNJMW9xbKnGl/7D5/nal/6KfnfM2tIcg14PyzQZDIZT5YlMr9e7fy3KknACSbKMY1sCaqKqRHHETqfPyTPn+O3/7lefkJzG18H7+xfX/v4uoR8aiqqSZWLwpygS5bzBXNUkTSWau1t84Ik1dnsBd48maLpB+6jFL/7kBZKXtrh7kGBWdTzfZXFlCe0o5rUbh+StCoatcmtrn0Gvxwc+8Sz7By697X2KJVFQqiJh67owYkyFgNL0ZZVlIJvK1C0dizdjMl1TpRKZLJFFKUkUYVg6EhmBJ0y2sqKgTS1pYQS6pmGkgqCsyhLFYo44CAjDAFVV0NCFgTSOBQwlSQlcF0PTpmucmDgVSg3LsiiXymiqylHzEMdxODpsI2cKpWKJ3b0mhXxhihGQGA4GFHIO6fRlGUUxqiIcS17gUyo6YmQhTcWPUUQiy6hZRpLF5G2L8XiCY9k4jkV/MKDeaHDlrTfxXJf1E2t4Y484hdWlOXr9wfRrFs75VFcp5W3CwCf0QyxdQ5MtiiWHUsEgTjVmyyqr81WCTvPDN7/11//Du4j0v8uf9+bQi6ZP01QZRVUZjydUHIOV03NsnGyg50tsPr/L9//gButxkXduHbG916FUdOj3PYJRhyTN4+ga586cRK+doHvvEpWCTcHUyZcanPrIp/mLP/0THl5axaqovLW9hW3I9xtnsc5694crmA0SAnorSdkUpZSiKyqqrKBIU8tZJlJSI98jZxtkaYxMgmkqGIZ1nyuWxAmeO2Y8EKMBRZbp91Xy04l85Ad4cYSUgTJNjhXuoex+sWmaOrW2QRz61KpFVE3j7t0tHNvCNg0m4zGdboelpQU67Q7D0YCcbdM6HBIEHrqmTw22Id4khCkcOIoCkiQVdjtFLMq92MUwVHKOjWma9Ls9mvt73Lx5g8ZMgyzN6A9GHHU7+EHIxA/wXI9SzuT48tz97YYkCyEBaULm5EQEjKbS82P8LMVNTSajMdWCzbB9SOuo/2htdkmK0zgTvNG/R3FVKnW6yaHjjQdicRrF6LrO6nyO8+dOcnN3yNPPPEJz/4jNw0MefvJhLl+9zcLqGTZ+4B9xtfsn7L12jTQOKOcsakvHOB07dIffIYgTCorCZPsS+Vye3lvfJsssdNMW7mpk8WGSQSp+EDLTv2cZuqqQpBm+52OoOqoiC/16EopCjAUD1fVdwqaLHwSkU8GhKMwppXD6zEeCJImxLZsgkDhsHlCvVmnUSqSSxN7uHvNzc2i6JmTSUXT/6kiTeKpmUKZsCjEjVBWZVuuQxYVZjg5b5A0dzXDYGmxRO7POwV4TXVOwLJ0gCMX8ThULcM/zkSQFGYnheMhkPJ5CWqaubQUkxFbixMYJVtfXqVZKvPitVxi5ESdPrNHutvF9YeR1k4zWJGGMRZjBeOITRjEJE4IoFgGfqk4mK4zGE1IUWq0RS/mU07UKN2/e4p/+6n9V+Z3f/T9OLW88cA238/crrmGvTxB4maapGIq4NgJkPK3KvZ0OtqHwsU/+KB1XZUaBP/zffhfDMJDTgMnkkOWTJ+jutYmjkJJjsPv6Rb720h3m52foDl1qZQN39x1e/fo7/OxPPIoXhpBKaJJwzGiKjJSJmYQkS8jZdKgqIZIo0oTZWmWK+U4YjjyGg8EUBCIeEf54QhhF97OpNVW/P5AFppATcVLGUcw4GWEZ2vTaiBgMh1imRc5xCEKPXN4mGoiF/LvbgjiOp8wrMbCdTFySOKZQKtDrdskXDJaXF2g2mxSKBVaWZ9na3IIs4dixxWmxpxiGJqgzcYxjady62+TytX3CwKNYKKJpCsVyBc3K05wkdOOEgdshyWS8IOJCeYa5+TkO3rrKYDTi+LFj3L1zB0WCRLN4ZWvE3s4eYSyw5cIUEkzRA9J9tIEiK5iWThLHhOF0a2GY3L59l7ev3356aeOha5nu/P2Ky7Zt3MmgkGYpiiaKq98fUjl+mu5wh6zXYV512O81uXX5bZRQxgtiNhYLKDcv8he/903WT53CjyK8yZjINJiMBjT3EhaXFnEHA262x9RnKjz/4l0aM/PUS0XBy5LEpF4SOxQgI55q3iUyJu6EcqFI4Lns7u+IIKfxhJzjYFkC6y0IOgpB4IspOxKpJBxEsqzcn4GlSYIfxdi2iT7997qhYzsOk9GAXrtLPpdDkcW1pGkmiirQAvGUe4qUkiZgmQYePjt7B2xsHKOU13HHI2YaJUxTwQ8CHNsgCITLKIwiTF2nUa0ynkzo9QcMhj7tzpgoyTh28gwfe/ZjzM7N48cJq8fW2Nza5ef/8S/heSmSouAFHoZhcuPaDR4+s8LswhzXb29Sq9UpVmcY9DsMxgGDfofA9wRvTIW5hTJFWxfCECCXM1FlCVtXmZmpUK+X+dIXv8FB6wgrl2Ovecjbl6889QM//KO/K6k2ohH4/1lcTk7n6DAtK9MQAFM3yKQef/X5L1Ir6hxbneO5P3mOK2/fpNdqT8MCIPEjDo98oijjzo2bnH/gPO3WPp3DjJMnT3Dp0ltYtkrR0UGv4uQk+r029RkNaboSIUmJk0jYwKQMwnRaDFOAWhJzdHSILMtUyxWyLMOcX8QLfHrtDrqmIGkKpqERhQppImFbDv3+gHqjjixLtJotVFWbMsgiMA2iMBQ4S0WiedBEViSkNGE4HuH5Pr1OFyfnYJrmVFWqoIgvkjiJGYw8Jm4gtF1TKmEUxfS7PQzTwDYKpGlCuV5F1TUCP2Q0HHPQ7LF7OGD7oMudzQNyts2//lf/gmq5iJHLc/rceWqzcxwetmnMzPLjP/YP+L3f/7/I2zaNegXbsWk395AkmaPugMEoYHP3HRaXFvDdMUuyxeMPnqboVLENjSyOqVbyaHJKEIQ4OQdiwbPPl/KoIHjDgwAAIABJREFUqkYuZ/NawRC/KKdOka/UaXb6D4nqkID/uK7+vRFKXkgUpZFm6VOkNSKIe+wxHphU5+dwRyO2b96lMdsQchtD4tbWEa2ex/LiHDvbO9y8+g6yJlFvzFKpFDl1aoPOUYtyIUehWGI0cVlcPI0mmwwGIgEiTTIyYmQkZCkjjkLx7cgCl0mW4bpjCsUilmniup4wIHS6qBKUijkhEUpTNFkmTJMpVknGdcckcYwkQ5JEhJFQaXQ6bXRNo1gs4boeUpaQLxYwNAspy9ANcaXKmhiLyJKYyRWLeSbjEWPPRzdNVFujVKiyPx7f50QgZUjuRHD2NYO72y16/RHtnst+d0xn4BKFMUVb4ckPPUypUuR3fu8PuH79DsPxiNlqjV/+hZ/nwx97hjCI+Kf/5Jd4+8o1vvLVFzl79iy+59Hu9tDNszRqNe5uNsk5Fs3dPR6+cIb5WpG6FZElHlpm48cBUaASAP1en+5giIJgaQy8ANIMU1dZmJ+hP/IZ9AecPr3Bp7/v6XOD5t36eNw/+o9W1ncrrsnYIwyjxDY1VEXBD0PCIGTsjqktzFGZPc6ge4Wjdp+PfvRp8rkcaZrRqFdpH/UoFC2eeupx9vZ3mZ+bQzd1ms0WtVqNUikPmURvMGbsh9B10ZRwap0Kp06YFMswSLJU6JpgCvQQe75qpcRRu83t23emfK+MuZkZZmdqjCdjQZGR/0aSM45HmIaBIoPhWOQLOSRJwvhbJol8LifczVGEpirkHXvKkk9JydA0hXy+QK83YDIeUqnm6XU7BEnMRImJUo9ylmGNXaTxGCuTMBSVJAqozFWJE3j1Ozc4OOoy8AX9aVbXmJUkanMVvu+HP87Gxmle+dZrdPf3uWDpYFa41WnzW7/9b9jvHnLu5BnOnFhlcbYGmVhu204OVdfx/YBKsUTOcVBkicFoSN52MAyDzshHVzM8f4iuG3hBhG2b2I7NYDhGkxUs0yCLxGkbhRGzjQbbu2129vZZWT/OI6cX5M0rL38gjNPPS38HTf17Fle/3yNNs4Kumdi2QzSaEMQJw5HL9z77DGcefohOu8nxY3McHh7huiG6bhKGQnKSxAmGrnD65AmiNOHW7bsEfkSWMl2tyHT6A1pHbXqaQbmUp1YpEEcBtmOjqyqT0RhVlVEkCUUSV082VRbIwEytTt7JEScZ9WqVctFh2O+IUYaqEAQBjXoVy7IETmjavFuWJVJbJy6245CmCXHoMx67xL5wHk8mE1oHA0qlEr1en8FwwEMPPYA7GnLl8mUCP+DpjzzOraMeRCnPVgyWdlucbsxQbixRfKAxnd4rECdklgFhxE/NHUPRJKJ4usyOAhLXR8oyomaLvZdf45nxhE/O5DBUDVXXOBgXuRgnlNbXOf3IIxDG/PIv/mNefuUyg+EIJ+eQxgkTP+TksTVy9k2GowEAQRiBJLO71+KBM2vs7OxTKDho0xRZ3/eJwoggDZAUQZ3WDZ0ojNB0lVzeoVwW7cbVG/c4fWL9Scu0Pp+kf4+eazAYIEtSQVYUZEXD8wLcicexYysc7u7RcyfYhTxLiwvohsHu7gH93oDmgU8QBqiaysH+Pkkc44Uh7XZf5OwoquCSpjHdboc4FCaE0WhMqWChIKbvSZaRTYspkSBD2NLTLJs6nIVcp1EpTqXUGd32oVhSG/p9A6tpaJiaSjAZ0x2NKZQKDHtdDg8PMXSDycSjWCyQy9sM+hMMXaHfOaLfHzAZTTh2fJVSqYCKjS7LHE5j5JYWl9iZROjtLj8tw0dLS1QefQpKJSJJIZEkvMGQ2I+Ejl71UJIQW1HQFBPIsIoOUhSQSQOyyYjIHXGuXCA0NdpHh0RhgOo4nMiV2Eg99r7zEoNT5/BnRFxhmiXEcUTgediWyeZOi6POgLE7pl6vkysUyTQVrAKj/V00RcPJ5+kOBtiWOQ24iu9TEEejMaPRhFq9MlVjSCIXKc2YrRb57B9/lrHrPj32MtS/Q5TrexbX8rFjamtvt5GmEYP+gGbriCyJUWU42D/A229ScAyiKKSgSCRRiJSlLC3MI2UiNb5YEVzNIIxYXFnDT0IhtwlCbly7hl0soFsx3aMOmiIzLhgYssxw0CMKIiQ5w7EtTFMshLOp3AdAVYRRxPcDfM8VmndF5BMmsRgRRHFEq9kiS1IcS6dWzaOqMmoqUy3kyOUcSmvHRIOuKNincwxGI7w44Vy1JrKhM/DDkPyMxrXumJYLK6sbbOk6hy9d5Lc0mSfW13B1g3du3OS1zV32gpB2GDHIxFqpNx4zGIyxdIUkSFgoWszWSqRhAHGGZlnopoZuO0RxiGU5zD/5DFaxRH9/D/nmFeZ9n+gLz/H6YYfJb/4L+rfvsLuzh6rqBDmLhfl5dnd3OWwdUK/VmVtYZDwe0x9MOBrc4vzqPGEQUi6V6XY7hFGEYwol8Lvyb9cVFrrxaEK5XERRVdQp8txxbOI44tbNOxe+cemODvx/J3j+XYrLC72Gqqn1MAgJwhDX91FUlcAPWFlaRjd1tu/doVCuIOkWq6fO4HseYZSgmAZeIGKB4zQlSmIy30dVJNpJiGVZHH/wHI5pEQYB927eprm9QxDGGDmbRqlI3rZBUdja3qZ91MUwTDRDm07EJZJpQSdJSpbEVKoVgtAXj4VSGUWWMW2bfKlAlGRoqsHG+hJHnQ6VeoNWu83AC3ANm3YQ0B8MUPsuGSquH1CRJmSSzNUbNxh7Hk6hROugxWjY583dPTq9Pv+TlPLEExfY6nb51l6TL0Qqm84MTcmll47I2TbjiUt5aYUTH5rnnVt3OX1qg8+++RaK5lBtHGP37m3icUTUi1heqtI9GmLnZX7zB36U9RMbxLtbbH39OdjeZP3DH+X00iKa77K0tMj62jHefvttCgUHxxG8jjSJ0RQJXVMIo4CFxUXube1z6842qzWHNEqYn5tBU2Xyhfz9MIM0TUX03lT7L9gcEfVama3tA/wgIOc4PHjhAWtrZ/+p8Tj4pmGI/7s9ep9Jse5waMdpIiWpcKysHT/GaOIJQjEyul3FSw94/e0bQsSXgWrohHHM0B9RmJ5aydSapikKhZxNpVJBzqYsClWmaBV59KnHGZ/awPM9DN2gVMjh2BaqYRBYNs2dfdIoxg0jsihEyjJqlSIXzp+j0+0wmXjMzc+BIhPHGUmSoig6YZIhGSqRH3D97j3amkmk6ESbbUbumLHr0utvkaUhUpSgIaEjE6cx1+7eFDtNzaBWr6EbFlJSIYt9vCzmp9dX+UlDYfuwxdtBzO/V17l4cMiKLLFQtvh+J2P1wgaXvIxg5PLImRXaWUCxUSQ6tcG17T2yOKZx4gzuzk1UKyEu26yeuYC3t8tw+w56pcBDs1Ue/7lfptGoUi7XUZAJ+k2MUp1nP/o0b116i+FADHtVTaWQr6MR09y9x8SPuBfFhGGG508IwpgoCqnWyzi2BpJIsBU+BiFc9FyfJEkoFfNIWYptGlimyVG7gyzL1OtVcvnCBw76h99E/u5X43sW1+kz58xLb745tYtpmI5DkmbMzy1w/cYdnr/4OZIoZHFpiaXja5w6e4axJ9zFN25eotnaolwq3Z9iv5tYn8QtkmKR0LKZjAYYqkGWJOQcBzLo9/ts7+wwHAyRMqiUS5RKFUGQCUK8iUsWx4SZQdtNcNEZhAF3X7uKZpooisagPySIAsIoZDAekygCT6CUCmDaRGGEY1lgZFSWCwSBx7DbIXAnxKSkikK5MoOkKOQLRfLFEqPRBKsI8t4uo8u30BaGVJ56gFf2D/hypqMUJBbiIfO2Q6HgMO5HfPvqLZphhqWrfOXFDvlGjqt//h8oOhXWnnmUpFjiB9aWeOL4j2NIE/70W3e43LDZ3tc4GraoFwrUyyU6vR43LjXpdo4Yj4cc7O9TKZfodTpUy2XCMGZ/b49ypYKpa9SKJaIgwPO77G7vEsYJpzfWUFSNMAgY9Ac4Vo1isYCMRL/fR9E0Qj/CcwPSTPA4QMKyTcIoZOL5TDyXJWOenOM86KYZWvDdm/r3LK7r1666ZAmGpmPqOgedDpKqYpgmzd6EE2urdI+O+J6PPotdqVHKF7D8gE67x4n1c9zbvoEZWah/KytHmvKzDv1DJpaJhoSKmMTHYSRgZX/bjBEltIajqVtGRlKE6pM0o9PucO2da1NwLZimga4J40OSCTvaTL1OoZCnOxkiKzKb9+5SqNao1hqCszrNbiRVcHJlFEknCYVDKRpHpHHAuDVkO76Dqus4OZtMUmmsLPLhpx6kdXBA3rD4zr07tPSIB5YXOOz0iCKPISKFTI18CrkiqSaz4w85fnYNjkKaozbrGw2eKg5YL+S5evlNHohiLn5xl62jW1zNbfInB03cIKTVHXJw2GY4cRn7Ipfbm3jM1md55MnHaB20GHT7+J6HrpaZnZ3hzu27RHFKznKQNYOj9gA3iigV8xy2O4yGLvONOmoxPwX7ZYRBD0iwbVPg0YXOmnwxjxclU/5/QrlSfPTdZf10gfL+issP/FhWFFRNoLhVVZ+qKaWpsUIDJC6//gonzj/EW6+8wtzcIoqisLi4wNmzF7h37waqOd1DSSI7R40VQs8jCkMsWUaJRSGRiiJRmDp8pq6fd9FKiiwhpyL4EwXKlYIwGGTcj9BL4hjbtun1+8RZShCGTEKRl2haNhkyvjTicBgSxglxEhMEPqqmYNo2mamQmRooqsh5dExM26RoKmSWypkHzqD+5cusqzqXmm3WD7osL1T42Zka/3WrS/nRDxBcu44mKXhKSL1eYnaxxI27u5xYPQaRyiOLK2xf3uOgHiFJfX7tM39CHihWdVbPPs73Lszy8eOrDBKZN7Z2Oej2GPmBQE+lMlIQoAUBBcPBa7W52e3i6zqSlUcyHdwMbt26y9HREZmk3ze5jCYu/aHLQrVInCS0DtvMzVRFnI6iousKnmliORaGpqKrArg3Nz9LsZDn3laLUiEkDEPmZmrHTTgWZ9k97bsIJN5b5mza1SwVXrkkSVAliW5vSOF8AddPOLi3h2nb3L5ymfVTp1k/c4rb16/j2A6WbVIu1bibXBf29jSFNEWWxAcnp7LgfBkyqq7jTSbIEsLbmGSYuk6aZXhBALKEqRtCwqwpKAjZcZQKDKYsS4ReTBDGeL4ITIjihESW8FpHAlhn6OiFAk6lQKpJ9KUUzcqRKxRYrJQ4dPtEWopWKeGnYGiwOD9L3lBwA4+ZxUXkFN7ev02dCHYH/NvWNk898xDLl+/xQ4UKSpjw1bvXeW27ycbiKiMrZqwqHOy32NnaJFUyPDng//zqK8heghMvoY9THnrqWWbX1qnOzuJmsLm3w93b99jZbpL0B9TJOKtqzCgKNUtntmhTlFOUKETKdFwZ9odjticu9xSLm+Mx16IITBMtgSyJMFQRRej6oj3JOQ6qJotHmsSU7pgSJzGGoePY1v1cJW8yZnfvgIkbIacZR0dt5mdmKebMDx55wT0FeC8Jzndx/7SlRq2GY5qYukZ/7BGnElv7R0LtmQmVQaVa553XX6PcmCMIPaqVCmEUcu/GbYLumEhxkaZT7izLqFVr5J0CW1tbaKUChixyC1VhcSbKEqSpZy9OxenTH02I03SaGRQiKxqSrBCnEfpUTaBrOuXZGo1qEV2T0U2VYqFAueAgEdGsOXw9GqLmdC4sn2BJLXNn9w6rq8eZ98dEcUax3+XBaI+iHOEEY+op7EYNbrzeYm79OEeBQWe/SbDrs/wLH+YP5nLUX7zO2TmHT68ssnzvHnNBzNdfexl7YZZoIvOFv74IwO39Jqdny3zw8cc5/9B56rkSipFjKGm8/PoVNi8+T3trl0KcsF4pcdbOceLsEqdmKthqhGbJKDmZ8vIMkaXgGiL6b+3amIKXEvZaNLs9buwdci3QeGMccimVuBSEZIMhKCpeINgXuqaRkOD5AQXbQUISsiQpE7/Ikrj+5CgSN16WEcs6K2cfYdi8x1yjxNxc7WPNW7v/bvLeB9d7F9f6+rre73TE4HIaz5LPO2zuN8nShEK+gOv51KpVosDn2huvMLu0Qq1SFU/9nU12vVDIoyUZKRW9kG+4YpWiagyGE9yJN0U2CBuZHwt8pGB8qWi6SrlSxbZtdEXCsTUq5RK1chHb0JDkhGq5ME0FS6iV8sShx2y9ytxsjTjwWFtc4A//8susVFd5PthnAxsnNbhjSZQ1jdPZLOObm6zlTX7s3ALD1haqYaMoCTOxzbe+fIm2N2Tl/AqXdg+xRyofKOS4ebvNP7y9z/9ialyoFPjI6VN8n6mxubPPC5tNnvvORR4/tcwnPvVDnDx/Bjk1abVGXLp7g+e++TzNgyZ+v0Vdj3nywTOcf+Jhjh8/TrFeRinn2O3u8vydN6mvzDF/fAM3CXnt7i2KxQKGY1GaP87rf/V5Vt45YGWhxmKlwkKxzEdCn/FozM3+iDcqGl/d7/Jcp8el2/f44IOrqHJG6Ie4E5e0VCbLEJGBiJD1NBHjpHw+j21ZnFhd4OV3XuevL21yYbXKnZ0WjfrMhX/7sz+HZRr8F5/59fdXXJqqlbNUWJyQJEFeSYUHMIpC/CggCET24Nmzp2nMNbh0+R36/S6FcpXxZEhKgmmaxGGMLANxxsHuPpokQHK5mTK1eglNFUvTStHBcSxyjoVjmmiahG0Y5G0DU1dIIg+VjLxtoWmCpaBpYgeYzzlkmaDHFPKLyKqEbZsMk4D9wZBcoYROzE/Vdf7wlS9jLm/glG2237pEY+EU/UGbQ8NmK3MYJmV2D32K+Rx3OgNOP/th6jMNnu9tEdkGw9aAg+euIHsBt8n4R7f3+WfzHvU0YDOGaG6O2o98mp955CGUXIEbWzt84RvfYTTps3C8wEg94qHvnWVl7QIL1RLL8zNsdvbp+i73bIXFWZut7W2u3r3KP/yRf0K31+TS1ss4ToH9l66TGEv80A99nG++9G0Kj61xcxLQvnGP+mWfhxo1Vg2VBVPlfK3M+UqRn1locHc44o/32jT3m5hFB9s0kYFev4ssKdi2KbIgp2bkNBUD6mbrkKXFOrYu8Z1vv8ruvTo3rl/hv//Nz5z+lV//bzTSo+h9F1eSJFYYxyBJwi2sKkRphJ7EGIaJ600IoxA/8Dk4OABZTMybm5scWzjBY+eeonf9Nq3DXRw1RyxnqJbB3MIMsS6TZBE//elnOLO6xNibYNsWoetjGipSIuZjuqZAkqCpGrIioat5ZFki51gcHh4ycj2WFpc5PGxy/NgCjXIFw9DodNocdA5JkpA0iglkH9MweOHad/jIUp5P1Nc5ufEAv/XCn3FdH1IYOfzEM5/kbm+f567u8dk799CWamTv7HF27jRPP3CcYiDRudmk+NQqydFt3njhOrl6gTNrx4izlH9n6GysrWPOr2DP1rl1sM/Bv/8Ke7u77L39JnPAf/Krn+QHf+OH2X17m+bWAbdv3WB+8VEu7+/SiHROGAv8xTcuslm9jaFIrPpFSh2dJ87/p+zfvszu7U3+5X/+S/zRH3yBtcoanjzk6u1b1B5YJz5xkj/43Jd4IYp4dqmOut9icfeQx0p5Ul3FTzN+dm2V3x6OUOdrmFFM4LuoqoJtW0RhhG3nmUwmGJYl+F+SNM0ygmOLM3TdI1zPZXZhhTu372i/8Qs/8VO6of3ee9XQe4py1o6vPDiZuD+Sswzq5SL9icuNrR00RcGxrOmSOsD3PKIwEhKfJEM1NXqlhB13H+YM5p/YoPT4cazHlpj76Hns71lj/Og8zvEKP9xYYKVSQSJl0OtSLjicO7lCErnEwYRKMUchZxFGHooCpUIeVckIQw9ZlSgUc+QciyAKydk50jRlPBkRxhFxmNCozRCGEaPJhInns+OPKBg250snONs4xhduvYq7UkKPZBasMtvDDlvBhAMlYrExh1Gw6NDlZusWX995jSt7N5h//DTFpRqTex2CgctoOKA/HjGMUlzNpNlu8/Lzz9NuHjGzssZjG3Osn5xj6cJTWMs1XnnlZbJbPhtOmSfWzuOGA1596zJPVk6Rj1TOzyxz0N5n+XidX/nJn2N3a4s7V77FUArQyiZqHPHY+XV2O7cxFiq4bsS1b75J3cyRhCFxFnHyiQfZLVb47FaXNzp9XvVCfme/ixKBXcmT1IuYsshZLJcK5GxbYKRMC3cyQZJkHMeZog9UhuMJmqrwyWef4thsnsfOrDBTMviz574YfvYrF//0fRfX+TOnnxiNhp+slgoUHQc3irjbbKLbFlrOIE5CAjdAl1WCMETTDQqyRbRWYPwBCxY1rAcXSY9XCGZtkqqDb8s04wmdJCDpDDk3UdAVhaNul06nR+BPGA+6uL5HqVhmc3MXWVHRDYM4Fk4bTdNwo5AgTMg7eRIU+t0B9UqZXM4izkTUbj5foN/tE4Y++UKJ7nDAV+5e4cxcmZlcjbFmcfHe26R+zDAJ+NLRG3yt/QZD3eN//6Ffpy8H+OWYl4Jd3pYOObQTnpxYjMkYHa+iL5TolzMe+eCHOLl4ksbsDPValerxMh/82OP8gx/7CXILNWqqx+x8jdbyAu24z4Iu8cG1U5xenmNhts7t1g619RVuvX0NB4UTp1ZRSjZGqcDEG3H2gQdohQd0JZfF5RV8W2doamxGI/qqghuEcOgxOBowcT1OLM9TcSxmcgZRmnLFi9mKEqr1Gm/1BgQyHD82SymXJ/B9HNOiUCzeJ+9EkbgaDcMgSdLp5F6ifdRhvl6lUtBZWZyhWMqTpXQnk9HvtwfvExU+HA4lXdUwDZ3QDxi4E9TZHGatSJCmcCR2elEkgsrDIMDRNDBViuUSBwdH9Do7aJKInovTBEWSMVQNXQZ9ar2fTMb0+wOe+ciTdLpHNA9anFg7jmU5HHYHjCYefhj/DecgFPMp3xcmBk3TKRRtpGmqWppAMJmAJDH2xmimjqwp5HRTEAOziP3DAx4/8TAn6nO8dnQNY26exC5ia3XsyOH3X/1TLl57i3jk88jSLLXVVZasBRaCQ/7Iv8H2N6+Q7I/QCyptr8OphTUaKydJjJT25g0uv/5NXr3yOjujLp84uU4hb/OHey9Q3nf59M/8GJXFKu2uy2azTWFllka5QqNaR4oS3lb7+PU8QRDx/P49nrv2JpluoWsmN+/uCGdO6JMlGXG7Rzp0OW5ZFGZsbm3tUsgXaTSqHB222FioYssS125tUi047Gk6A1NjtlQgyyRUVWHiedjuZEpQFC50NwimVKJpGpymicMkimk0atze2iaKM1Dkc96g+14l9N7FhSznk1QA0xRVJZUl5JxBZkgkgSgU27QZhgMUJOIoZJJMKBdXUVGp6CZ52SLNMuIkRNc13DBmEgbEWSKQTF7CcDgmiRMuX76GbVv4Pnz75Uu4nnvffJFlYBg6ubwQ+KmyRmO2CiDCzWWZcejR3+5gagYn108y8ickckYhl2fsBqiyRBJlGHkbeaQQpRK2oSOlUBwm/Ej9A5zXHV788te5un2XH//Qx3nz2kucT1M+deIkn7u0g7Uyg/LWt5h84U20AM48do7Wqxd5gW+Tq5RISFCiCDOReerJs8xmJs3tAyoPL6HPV4m2emy3O2jLdZrqCI+UdBDgtg6JZIlx4OEHIUmciZM6TSGVIAtJGQikkiyjSVPvpaYgoRIHHoakMjdboVzO0RtM+OM//ToPnDlJrV7FUGXyRYfjeZ3rd7Z45fIdnnjwJI7jMBqNGHsuhqYjp6lAQskysqyKqGZdQ5FklhcX2dlv8uWvvYhlGzz0wDlaB53yf/kb/+OFf/Zrv/bW+yqufr+HKkGUJGIprcrIZKRRiqHpeKErPvBCgTgIicmYrVdQHJ1tb4Ipq6RyQhDHjLwJM1oJU9MYhz6yoqIlISQpfihWOwd7R6KJ18XcqtGYJUnj+6Htqqpg6Np972CWpUKOLEnEscgisvMao5HL5u4e/f6AJJMYDHziJEWSU3KKQa1cpb/fpjsYMXIDVE3BSU2iKy1Wji8xKtbpJyFWJKFbNo0HL+DPL9PavEddClA2fT71wYd4bGORr3z9CuuNOcG1TxKyVMGPZJBlnlxbZnP7gL989SrnV2s8Xq9x29/n4s4+d+yUQX8igHZpNpVwC5iJPEWFg4D6Koo0tcKJrG9BAVIFV0LT6IUDBu6IvFNhdXmBuUaNr3zzO+z3hhwLU+T+UCSGqCo5O8f1m7cxpJAnHz6FaZlMXBdFFpuX/nCIaVlomiFc4IZJFgT4foCkKFy/dp1GrcHKygL9bockDfnBH/z+T7zv4irk85rvjjJZkqQojhiPx+iqhjmFtGmaRjQROcqyqjBfm2WxPsNdb8wgM+n7PkqWIqUpMRluJEIGZFJkTSOJIkxVQ9FUwiChUCyKJXckQLe6rokcayRyOQfXnUzT5sUHIjhdMrmcQxhGXL50G01TCcOI8WgMmUSxVCAjZXFxEcd0kEkZBSMsW6VarrC6sEjYv0lve5f640/hlmvMPfg4evdFvu1vkfvQGtr6SeLaOmeOdwl3ruMPJhRncuRyCjMLDfKFIr1ulzhJyCSJMiK7+/c/+w28MMCySsidjAtOjb68QBLLJEmGjoqsSGRKBtOYGXm6h0XJhLs7TYnIBN4y+ZttieB2qVipQ388Qh/0WCtU2W32IFHoDScUykXKlRLN3T0Oj9rsHw3YOHUaTYIPPfkwQRjQOuySpAmd/hApy8QqbOwzGAwJvADV0EUYVhgTpzA3t0ChUmO71WEwGnI4CpLNe3ffUxrx3j3XeOw4piEpU5iHYmj4kyG6qpFIKbqp4xEQJyGmaWEZOr1Oh3jWQZEkwixGSlOUTJBhdFkhSGMkVSUaDCEMUUsmiR+IH2Ic3/cR6rouBnyZ0K0LyowybTDFHsyyTDRNxfPErC3LIIwjIVIsVESssJLS7w3pd4fkZhx6kyGdSciqqnHY2mO03ya1JPy6w150xLxXRy/Psf1Eka3cCLd5la++epnKSC7jAAAZeElEQVRHWhss1WZYr1uUVZ3nX7rO21dbrK3OUcjZ+J6L67pEcYKVz5MlMcVSCTOKaQ5Sco05bty7R+vOFscffYBYSomyBA2VOBYY8DQT8Xlpmgn+fJZh6Sa6qqEpipB+KyI8Im/blPJ5Ck6eyeoaL7zzRT7/wqvcvnOPxYVZvCimWiwjZym1okPpgXO4XkCjYvCLP/59OGrM1tY+o4lPmmbEUUoqKyCraJrEJACUAmkkg+Ig2xqqphIbJkeJglrOky/EnFnIosP20f/8votLkiU5fffYFqHPxEmMlAnazNgdQhygayqaKrO7s43mhjhnz1I3DIxcES8MhFhQiQXNOInexW9NWe0JqipTsHOEUYw78TFNQUyOopiJ6yHJGaahYTsizMCyhHpyOByRpsKPOB6PURSVer1OmiY0W23SJKZUKiCrEuPJEFnOo8k6fpQiZRmtdh9DVYlJMc6scuv1txjevk50aoPjjXlynT2SvSZxTke3TAaDPlqq4hRLqO0B+UKOW3e2uHN3G1mWKZUKzNYqAgRnWDhOgYXlObb2W5w7v0HOsnnur1+hn8YowxFxkJIoKkXLwlQdJBSKeYdKLodlmChI5B2HQrlAGgsWrOu6RL5PMJrQbvbYydoUqiUix2F3EvPYBx5lbbaBqSsYukoUp0S1gghtl2Vcz0OSwM1k+pGCl+kkGdSXZvGChCBKSXUd2zAwTGvKFJsWiiKgfCCJHKXJiLXjSy/l8iX/fReXKskFGel+ZEgQxWimRUSGEmcYkkw4TRLTVYVSzmKxUWGc03AVhWHsM4mE+iDNUsaRj4wsirPgEIcK/sglZ5hIksRg0Md1fTxfpHXYlsHqSoP5xQWarTa7O/tYlsnB/gGGaVCrV4mmKbDFgoNtGeRyGkEccvrsKnKWEScZjUadnGnSbR2gIhOTImsOoamSj4rU4wKHWzt85uRT+HtNXtvaZjaBy7vX+W8f/wSJbfBmDF/93J/xfU8/y2Pf8z10XJdHn7hAp+OxvLTE4sIMnhuSpCndTps0g+XVZXqjIfH2Dn/+2c9z5Cj8yK/9IutlnXPrVQrlMv5kgq2byLKCFwRkScJ4MGAShBiOw53rd7n79l1GsYcbhRzbWKfbGzDquUwij92jPc6fOsu4N6LeqLB6+gxut093GONGPhM3QLFyyJqCZehYdnG6UjMx8inGNI8xSRMcS6WgyKSZyNGWpgA6sqnvKspAlklJCYMAyzIZj8b/5rVXX32vEvpueYtR3jQEySVC6NFVTUE2FMJJQNFyaGdjwiBgbXGOxdkaJxo1vm0N2fc9OqGHnAlrvpLKyKpKJkMWxpAKYouiqlOM9oRPf/r70TSJ1159HcMyObuxTqNaIlMMjjoDBv0Bmibx0COnqFZLxL5YQS0vz9Oo1RiOJxzsHdLt9jh2bIk4jOh2howHI/zhCENVsTQLZCjYGte7LjnHwbYc5MNdKjWffL3AxeuvoM47rGsZxXzMYTbiha2rXJh/kCtvvoqmqSytrGBXFpBzCaMg5qvfvEhtfplxnPLi175MqeSgvWKyvSWEer3ukE/9/Ceo9I544aU3MD/9DPvPv878QoPDQY8oi/Fdn+17e5QqNV597TVOnTiJrlvs7hyy8eAZXvrc52geDTj+0Hka55eoNKqYr7+BJZmcfuQJ/uKzX+TKrQNWV9dQCwolWaaIoBy+ix/IphTZNE5QyMSDCRlVksimHs530e3vIg8ySejtUiBBpH7YlsV4Mth98861Lxm68f6Ly7DNXBiJhPeFah21f8Bw3GbWqOMlEYPRmI0zGxzu7xOFgUBwA6ZuEIchYRAIU+t0niINXDQ/IcybpKYieFSJjG4oyKbO3t4B+ZzO6vIMjmnhTQZ8453rXLmyOWXDW3zw6Sdp1HM0Dw7p9fqMfZ80ydjfaTFyPdyhhzt2ae4f4rkuhqEhSwnlgsMjD5zEcUxGbsAkGXLq+AdQZI/2xa/xUx98DC3e47PvvEXt3DyFmsG8UuFffu1/5anlj3B6/VGMdYetF3p89Y//HC0rcjCMabUOuHb1HUhT/rOf/RkefewC//e//yM2d/dpzMyytLzC4nydK5fepDH26F26iDMYE7zyDt61A16aLZDN1di7doPl9TWKq6ucOHuarh8w7o9YW1pi+fxpqv9Pe2cSY9l13vffOefOb66qV1U9VZPd7G6RbJGiKMmOJMdBEMMwYEAOggTJKgHiTbLIgOyyyybIMsgiBoJkEQQIkEVWzmBrY8eBZUqUyUi2qCa72eyu6q6qN9WrN97xnJPFuVVSYDctIkZAIO+/qq4e0LfwvXO/8w3/X7/PePB1xien7gTyFLLU7Pf3mB2dcHjylMCPiHyf7V6P+XwGtqptEUztY+quoZWuastvccn7Bv6EW7ZSCmMsxlSu/Selsw0tK0I/IM+zf58XhXPd/qzBlaZZp9tp0241UZ5itUqRNd4tCHxWq3POp+ckzYQyrzibnPMky5G712kEIc3mlvOCMprCardOX7ot5LIyZHlBI0kQwrCaL/n2b/0Pmp2YX/rlr/P0+YB2t4vGc56koTMoe/ed99wQnLZ1OaLigS7pdrr0tnps73S5decmrW6XIElASTq9LVqNDtJ4JN/+DsamJC2Jb8+YLTJ2p4qXvQZXbl9hZzxjND5nko7x2h5vf/PnOfnhkNF/PefBLcO93T5ngxWYFWmeUuUZgedz++WXYXrKyXu/y1/68l0accJbr9/h5Rt9VtMRf/VLfwWM5taNNym14KPHp3QOAh6ePObWV9+ggSTTZb2WP6C/32dQZEzHY1ZFTppntLa7aGHRxhK3Oi5xtQFh2MOqNcZAr9e7RPxdePZbXNBIITBW1L6xzp79Au1srRvCtPaizOM80Jzp8U9gq1Y7EPwqXdJsN//DmztvYS38t//y258tuEajcXLl6jWi7av427sEjz9GzBYIIQkjnwzJo48esn91j+1mm1Wasf/SAePQY1hmdKwkNyW6KlmtU6J2B6IOstR0lOK1XoPlZEFZ5MxXKZ4vufXyAd/7zvs8O3xGFDWIY4eR63Zb7F/ZxxrN62++QbvXpd3q4keR22P0PMIoJi8rRpMBw8UMOx8zm81YzFd88HTIOz94xJPzY/7G37rPbDAgH/6QL7z9BjdswX/6N9+Gb32F125d5Y+LOb/8F+4zGMxYTZfMl0/5peZtrk+WnKYf80/+zrcIPI9mIuk0YzrNFr1em8HJMVm65mv3vkav2+F8sWR+fsaygFmqOZ+uOFyOmGcVR2cZjaRFx+6xF20RHvicT0Yc3LxOaQ3XDq4RhT66gP2rN2iEbXaSfT4uH1CMNB98/L84Gw7JzlNUabna69Noten1tsmy7PL0cYsqCm00trYcB4mU1LfvEiE8N91rHelWKa920dbUg8wYKzC6Qldups73xI+3up0PlfJcXvZZT67K6GfCC8hlbJv96+Kl23f44DsfuU3dokR6EoWHsII4CJgtV8yXSwoSzqqMPHOmIkpIrOc7e2trKIyhsygohmsauy+x3d2n0W7T7raJkgZFCc1225nvCu/Sb2Fde43OFyuGR0Nm04csVksEcHJ8zNl4wmR0xsOHH5Km9YPVg97TEvr72/zNX/k5Tn805bcnZ/z6X/sySVryZdnjVHmIhyX5szVfSW5z8puPWC0LEtXkrebrNKKAb6YNos5Noq0maZqzzAuWWUluKgZn58wrhUn6fHimGT8ZEDW3kMEWhbCUoUbvaB6cz0mSDge3W2SLFVdaEdZ4rKZrRK44/vEAtGU1mjIZjVidL3muPoZ1iS4q0qVbuy/WKcvlkk6nRafX4eiTQ7rdXeI4Zj6fOw52DYJQyncoGGqsjeGnEMfO7afSNWzIOpM95yUsaqM459GqpHtlYkEb+2/HZ+cu+f+Utf5PcblpP0mzlMcffcizx09Zm5XbmKkN+KWSSE+yWq5oHVwjlF1OTkcI7yoyDKGqoeQCUJYwSdxGic1Y6JypZ7j/c1+n1ehyPh+zyjKGp3OW65TF6jGTyZjxYMjZeMzsbMxwPKaqNLPzDN+DKPLxfUUcxTQaTXzPI0livvrW226a0veII4fhxUoOruzQb3tsj3zSK7v859/8fYos49V7X+DNm3d58PApORErH06mS5CSdteAksxWE6rS0Gp1sEc5pREgfMKkTRyFnJyccDadkxYlZ9M52Tql02mxt9/ni/e/yHYjYTQasL/dwVMSKQxR7DMeDPn93/iPRH5Itkqp1gXNICQKFaEfsB1H+HKNJyw3b2yxt3cbTym0rigry/F4TmNrj0fPx1jrbC/Lsl5mweVMWmeAI3mY+nVZVRpj8p8ixTkLc6EUusjd1ntt0nuxw+hqkSXdXusH999481+HoZv/+jS9MLiCwP/jxWJFUSIGp0PCKKSz1yYOIopZernnlmUZi8UctKbheegqo1EU7KMQRqOLEpPntEvB6GzMajan3+7gG8E//Wf/ArtcU1lNlqVQVWhdEvi+GyZMGnS7HeKwwZ2Xeo5KJhVhFLqFDSmJPJ+kERMEoXM/9BVBGJKX2g2/SfB9j+PxlKNpRK+/T7HOYLtDEsRMogYn04qx7Lv+KQr/yhYCyVJK/CBGxRVoS2acHSa1CXC73eZ3f+d3ePe773D9xnXuvHKbUMDjo6ccHRoW85t8+KMHvPmlN7l79w7rdUqaF0RBQBBFBNKnTcjB/vXa/6sgDn06rSbWGlqNEKE1VbHi2k7Clb0e5/OU0bQAFSLCJn/00RFx3KS/t8MiXWONI8wWpsRYV5eUQmKs8+MXSlJWpety4CBcldZIpRBaY4w2QjABMRdSHflR+CTw/dMsy05MKT66dv3ab3U6HbdX8Wewr18YXF/92tv//cknz5men2OFa6CqQjAZjFkvc+aDIXaR0et1HaZEV7T3d5h/csprXom3LMmyAl1obKbJgd1K0y8tzXCOzA2eH9O80nVzRb02EijyHOX5BEGI5/nEUYKUAi00xtZAAd+nMiCkQguYC4UpJEJG+MKHUpKWFdqEeCqkETaodnZBCCZaYoIWKEmWV6xnBgN0+/sIA/PJOeenZ3RaHZI4IUk8cmEpbIX0RT2ladnrb/H9732f777zB/zCN77B7VdukaZrdnf73Lt3h/H4jOcnJ4yHI4c/abSxQGgj50FmJVlWoIKAZqtF7PtMp2fkZcHzwRCB4DkWP07IspxH44KdkaTUhrRwhLV2Y4vdvZhSl47NuF6iK1OPKBWU2nm/XiAJpVJLKnPqh+GZlPJ4neWDKImOeu3W4WQyPVFBOGzEyXi9WkyUJ/JWy5kHR0HIajlntZyjlEeWXXRFPt0b9YXB9Qu/+BfP/Ojdf/nDH37wj27cvMF2b4vh+YhHzz7kbq9H60u7lJnziddFjhWCJ4MR2ZMUX0q0tfgGEuXjSWdmEUduFNm3AZ1eF78VkRWlI3RZQRBGjg0dJI6ciiEXHtIL8IKAMAiw9ZGthNuDtDX6ROCABtbamq7hXKitsVQVBGGCAkpdIZTEGkuUBCgp8XyFkpKHjz5i5S/ovNzm6ewRovTYW15jJ9rFD3wqa1w+o5T7Gsu9u3c4OLjB0yefUFUlxhi2d/pEScK1gxu89ZW3aTabvPdH75MXJUVeuFZPZcBomo0Ws/mKzPcRfkyrkTgTFgue8rFCsd0PMUCW5kgMSQxFVZEXGSoIsMarVlkx9DzvTIbe4XS5eJRE8VmctE7jVnOkEcMqz0dx5J/O5+vZ7pV9PCU5PDqm0WyytbPFfLlyH+oopMjW7jVpLbqqqITjA+kaNnHBYfqz9MLgWi7XfOmNL/5jz/P+9vls3ettd4ibDYKqYFtZ4kaTs8XK1Zr8yO0FSugYg7ASL45cQ9aTCE8RBDFhklCVBcpTdaBZIgGm7hsqpIOKC4Gx+nJjSEnHUhQ4Y1zXezMEXuAort7FIq1xtAol8YUL8ErglmmFQwErz7+8WgspCaKY0cmAj48/QL2qOZwdcdC8ydHiKbdvv8SPfu99bgavcvsLtzFl7tiOQrGYr7lz71VazTZeGLLV32W9XhFEIVs7e7Q7Xfr9Pg8++DFPDp+5JRRP0O1u0Wg2EcLgeZ6DiGYZ0gpXP6pKSuvsuHVRYq3Jl9lqKARTqdQzK9QnURyfdOJkcL5cHivEUSDVsJSr8fbOnvbCkLOHP0bGEZ1Wj0anSV5pVrO589uXwhkoV+5nqLVDtljjXKNNTZK7dH3+DDiWnzm4kkaTOIq4f//+t777ve//3nA4Yndvj/0bt1jOzyhkSLy/w1Yc49f0CnvhklzTXt1tgsuKrzaauK69uMQTV9gry9rmG3TuvOKlqCvJSiCMuYQpyXpv0UpJZSyexHl24byoLua7fOWwdHh1T7P+P7gUtoY2WYd/iZOY+WTO3eQOzf0GDx58wN07d7nXfp1GZ8DO1h55WWK0W87VuL/nBz4vvfIKVVWydeUqlXY91KqqSPOMJ0+f0ui0aLZbzk8DQ1VqN0akS4qiXORVdWIRJ8rzR2mWPpeeehbGrcd5uhr3b9wYBVE8HAxOJlWVEcoIIwRbvS2ajRbZ8TNsXjhqWuF416aq3DMaZxpcFgWVNhjjIPYXNbCf1Uv+/0Yv3v4JAkpj2N3b/5+vvfbqv3v/vR/83cVsSavTJWo5dxQphHNWttZ5RZVuFNmxEx1qRHkOy6trbK9wz4dVDn0nLjatPel2K4XC4gp9SripAem5oK3qT5WumYkXVebxeExe5HS6XeIodp9O6bZYhLXuNUPtJS+Fu8UCAsk6S0naDb7x9b/M/HjJvb03uPvWm4Q2ZPoop791gPLdUCIWcuNOFQGs1ivO5zOUUuQ1VqZ+SCulGlhrJ9baoR8Ew7I0z31PHQa+OpovF8dbO/1JuspOhbALPwzY7u+zXpyjraXZ6DAfVzQaLZTvo6REw2WyXpUFeZ5d0j0ubnS2/jB/XvTC4LJ1cSzLUg4Orv/6dDr9tcOj420v8x3LUDvogHso5+HkKYXvuX4kVroNkvqsuOD5WISjnOm6nlL/vtZg1U/+HLgrs6078QiojAN8IqRD8ykHTPIDn6Pnz/B8n51+n6LIqQF7IEDa+sptbW0/7v4Ni7MAmM0WBEFAkiR88ofHxEmD2fQUFSnC2Kdc5DWn2sMiSiEYGGuHcSMZWeSj9Xp10mg2xkLKQVlWh3HSOAnDYDibzrXvSZqdDvN5SuAJGpHPKs+I45iq1MjaklNXpdsPtc4D1tQnDz9jfvN51AuDqyjdDFhRVERRxEsv3/rV4fjsDxaLBe12i6KoZ6ylxBoQVlKW9ZVWuGapFm42SRhXtKvqH1L98gRc0/2C+lqVuibRukCwqg5EBFZwmbAbYy6RuBZHtW00m45DXVU1G0FQarfu71IsF6wXuDk3dOj2MT3lLC6tEAtCcbTI58ed/e4wW6+PzxeL097O9lG72X62nC1GcRxPlVTj4WTE9t4uRe4Amd1uBwOsV44k6/v+5ZvHTalqjBZUlYD6EmLrE+fzdNr8eepT6lzx5dfGwvb23juvv3b/X33/3Xf/wXqdEQYRvu/gAEoppKewFe6TJtzsj7YGa10+ZKyzmayKnFJXeJ7bhdQY8qokzzKsEATS1PTUurpfG5O4RqqhKFxv0xpDVVm31gZ4nk9elo5+Vi8X6LryrDx/hhATixgKwalQwQAhxq1W85lAHQ4Hpydb21vnO7v749lsuhiNh1y5fpXBs2PmyxXNVodOu02R5q7qLeucsMb2gVvTMtScSmMuLw3/P+vFUxFR9JNfWNcyePnWrX84Go3++sePnlxxNApdn1y1wZvv19b3DqMirMsTjJAu0TIaUSf6eVVgtTvyy7JASWeEq3XpzF69AK0sebZCl9oFFM5kpCgrhBII5KqsqglCjJTS574fjtN8/TAM49OiqCZh4p9EYfhc+sGxkqylVFRFju8FZNrS2e4gNIxHQ8Iocg1yKRE47O9lj66qKMvyMmh+FifjjT5tQWOx/D9+bbFEUcyNW7d/9fh0+Ier1ZJ22w2faWMQWmO1GyjTGKw1SKVc0imFAwZoQ5pnzrHP8+rZcYFSbn18tVy6Lr6U2XKxeG5gFCfxJGzGz5fL1XOjOW61m2frdP1Js9Gda1ONZCnnWVbQbzVpNNqMzgyNRhu7XBPHgaOrComwLjDsxRy6NrUnmHs+o/Ul0H2jPx+9eLVM/MnSfpYXtNqd9+699tpvvP/uu38vKwt8XPKvpAQFZelmuwy2BmmCFbrGA1dTIexcKDWar9Pn6To91kYPt/s7mdH2MM2yh/v7e5nw5PH48GhiSsveteu02k3WT56gq5IoTtBGEwQBRWkvXYexP2EjXtTC9EXAyIviw0b/L/Vif65G8qd+XyjFS6/c/vvHJ8dvHT09/Plmq4WnPL1Yr45Ka6ZhEMzjKJ4E0jvM8vxE+d7R0eHTjxbLxdCgJq++cnsto4hPHp8yG48Jw5C9q9fwQklWlu51LCye8l2QGOOIF7jSzAWS+Kev3xt9PvUpJ9ef/m1tHIy82Wn/88Vq9U0ZBF6vHaX5Sj9apOmkvxPOGq3WmVLBcX4+PVO+T5qlpHmKVJFL/pVrt/ie55rUcHlrcq9R+Cws5Y022mijjTbaaKONNtpoo4022mijjTbaaKONNtpoo4022mijjTbaaKONNtpoo4022mijjTbaaKONNtpoo4022mijjTbaaKONNtpoo402+nzpfwNODIXg01U7aQAAAABJRU5ErkJggg==',
 // Should be empty, unless device can be controlled (e.g. lights, switches).
     exposes: [e.battery(), e.battery_voltage(), 
               exposes.numeric('volume', ea.STATE_GET).withUnit('L').withDescription('Hot water').withEndpoint('1'),
               exposes.numeric('volume', ea.STATE_GET).withUnit('L').withDescription('Cold water').withEndpoint('2'),
+              exposes.numeric('flow', ea.STATE).withUnit('L/h').withDescription('Hot water flow').withEndpoint('1'),
+              exposes.numeric('flow', ea.STATE).withUnit('L/h').withDescription('Cold water flow').withEndpoint('2'),
               exposes.numeric('hot_water_preset', ea.STATE_SET).withUnit('L').withDescription('Preset hot water'),
               exposes.numeric('cold_water_preset', ea.STATE_SET).withUnit('L').withDescription('Preset cold water'),
               exposes.numeric('step_water_preset', ea.STATE_SET).withUnit('L').withDescription('Preset step water')],
@@ -13,7 +13,7 @@ const definition = {
     },
     extend: [
       deviceEndpoints({"endpoints":{"1":1,"2":2,"3":3,"4":4,"5":5}}),
-      iasZoneAlarm({"zoneType":"water_leak","zoneAttributes":["alarm_1"]}), 
+      iasZoneAlarm({"zoneType":"water_leak","zoneAttributes":["alarm_1","alarm_2"]}), 
       battery({
         "voltage": true, 
          "voltageReporting": true,
@@ -39,7 +39,7 @@ const definition = {
         "access": 'STATE_GET',
         "cluster": 'seMetering',
         "attribute": 'currentSummDelivered',
-        "reporting": {"min": 0, "max": 300, "change": 0},
+        "reporting": {"min": 0, "max": 3600, "change": 0},
         "unit": 'L',
         "description": 'Hot water'}),
       numeric({
@@ -48,9 +48,59 @@ const definition = {
         "access": 'STATE_GET',
         "cluster": 'seMetering',
         "attribute": 'currentSummDelivered',
-        "reporting": {"min": 0, "max": 300, "change": 0},
+        "reporting": {"min": 0, "max": 3600, "change": 0},
         "unit": 'L',
         "description": 'Cold water'}),
+      numeric({
+        "name": 'flow',
+        "endpointNames": ["1"],
+        "access": 'STATE_GET',
+        "cluster": 'seMetering',
+        "attribute": 'instantaneousDemand',
+        "reporting": {"min": 10, "max": 3600, "change": 10},
+        "unit": 'L/h',
+        "description": 'Hot water flow'}),
+      numeric({
+        "name": 'flow_max',
+        "endpointNames": ["1"],
+        "access": 'STATE_GET',
+        "cluster": 'seMetering',
+        "attribute": 'currentMaxDemandDelivered',
+        "unit": 'L/h',
+        "description": 'Hot water max flow since reset'}),
+      numeric({
+        "name": 'flow_min',
+        "endpointNames": ["1"],
+        "access": 'STATE_GET',
+        "cluster": 'seMetering',
+        "attribute": {"ID": 0xf010, "type": 0x22},
+        "unit": 'L/h',
+        "description": 'Hot water min flow since reset'}),
+      numeric({
+        "name": 'flow',
+        "endpointNames": ["2"],
+        "access": 'STATE_GET',
+        "cluster": 'seMetering',
+        "attribute": 'instantaneousDemand',
+        "reporting": {"min": 10, "max": 3600, "change": 10},
+        "unit": 'L/h',
+        "description": 'Cold water flow'}),
+      numeric({
+        "name": 'flow_max',
+        "endpointNames": ["2"],
+        "access": 'STATE_GET',
+        "cluster": 'seMetering',
+        "attribute": 'currentMaxDemandDelivered',
+        "unit": 'L/h',
+        "description": 'Cold water max flow since reset'}),
+      numeric({
+        "name": 'flow_min',
+        "endpointNames": ["2"],
+        "access": 'STATE_GET',
+        "cluster": 'seMetering',
+        "attribute": {"ID": 0xf010, "type": 0x22},
+        "unit": 'L/h',
+        "description": 'Cold water min flow since reset'}),
       numeric({
         "name": 'hot_water_preset',
         "endpointNames": ["3"],
@@ -84,6 +134,69 @@ const definition = {
         "valueMax": 100,
         "valueStep": 1,
         "description": 'Preset step water'}),
+      numeric({
+        "name": 'leak_time',
+        "endpointNames": ["3"],
+        "access": 'ALL',
+        "cluster": 'seMetering',
+        "attribute": {"ID": 0xf020, "type": 0x21},
+        "unit": 'min',
+        "valueMin": 0,
+        "valueMax": 10080,
+        "valueStep": 1,
+        "description": 'Continuous flow for the alarm_2, 0 - off'}),
+      numeric({
+        "name": 'leak_gap',
+        "endpointNames": ["3"],
+        "access": 'ALL',
+        "cluster": 'seMetering',
+        "attribute": {"ID": 0xf021, "type": 0x21},
+        "unit": 'min',
+        "valueMin": 1,
+        "valueMax": 1440,
+        "valueStep": 1,
+        "description": 'Pause without pulses that ends the continuous flow'}),
+      numeric({
+        "name": 'battery_capacity',
+        "endpointNames": ["1"],
+        "access": 'ALL',
+        "cluster": 'genPowerCfg',
+        "attribute": 'batteryAHrRating',
+        "scale": 0.1,
+        "unit": 'mAh',
+        "valueMin": 0,
+        "valueMax": 65530,
+        "valueStep": 10,
+        "description": 'Battery capacity for the battery life estimate'}),
+      numeric({
+        "name": 'battery_consumed',
+        "endpointNames": ["1"],
+        "access": 'ALL',
+        "cluster": 'genPowerCfg',
+        "attribute": {"ID": 0xf000, "type": 0x23},
+        "scale": 1000,
+        "unit": 'mAh',
+        "valueMin": 0,
+        "valueMax": 65535,
+        "valueStep": 1,
+        "description": 'Charge consumed by the model of the device, 0 - a new battery'}),
+      numeric({
+        "name": 'battery_current',
+        "endpointNames": ["1"],
+        "access": 'STATE_GET',
+        "cluster": 'genPowerCfg',
+        "attribute": {"ID": 0xf001, "type": 0x21},
+        "scale": 10,
+        "unit": 'µA',
+        "description": 'Average current of the last day'}),
+      numeric({
+        "name": 'battery_remaining',
+        "endpointNames": ["1"],
+        "access": 'STATE_GET',
+        "cluster": 'genPowerCfg',
+        "attribute": {"ID": 0xf002, "type": 0x21},
+        "unit": 'days',
+        "description": 'Estimated battery life, 65535 - unknown'}),
       ],
     ota: true,
     meta: {"multiEndpoint":true},